@@ -11,9 +11,12 @@
 #include "sl_sleeptimer.h"
 #include <stdio.h>  // for printf if UART is retargeted
 
-// Use float arrays to match sl_imu_get_acceleration/gyro
-static float accel[3];
-static float gyro[3];
+// Last sample taken from the queue
+static sl_imu_sample_t sample;
+
+// Print the latest sample at most this often; every sample is still consumed
+#define APP_PRINT_INTERVAL_MS   100U
+static uint32_t lastPrintTick = 0;
 
 void app_init(void)
 {
@@ -31,21 +34,26 @@ void app_init(void)
 
 void app_process_action(void)
 {
-    // Check if new data is ready
-    if (sl_imu_is_data_ready()) {
-        // Read raw acceleration and gyro data
-        sl_imu_get_acceleration(accel);
-        sl_imu_get_gyro(gyro);
-
-        // Print acceleration data (X, Y, Z)
-        printf("Accel: X=%.2f Y=%.2f Z=%.2f\r\n",
-               accel[0], accel[1], accel[2]);
-
-        // Print gyroscope data (X, Y, Z)
-        printf("Gyro:  X=%.2f Y=%.2f Z=%.2f\r\n",
-               gyro[0], gyro[1], gyro[2]);
-
-        // Small delay to avoid flooding UART
-        sl_sleeptimer_delay_millisecond(100);
+    bool newData = false;
+
+    // Drain everything the data-ready interrupt queued since the last pass
+    while (sl_imu_is_data_ready()) {
+        // Accel, gyro and timestamp of the same sample
+        newData |= sl_imu_get_sample(&sample);
     }
+
+    // Rate-limit the UART without blocking, so the ring never fills up
+    uint32_t now = sl_sleeptimer_get_tick_count();
+    if (!newData || sl_sleeptimer_tick_to_ms(now - lastPrintTick) < APP_PRINT_INTERVAL_MS) {
+        return;
+    }
+    lastPrintTick = now;
+
+    // Print acceleration data (X, Y, Z)
+    printf("Accel: X=%.2f Y=%.2f Z=%.2f\r\n",
+           sample.accel[0], sample.accel[1], sample.accel[2]);
+
+    // Print gyroscope data (X, Y, Z)
+    printf("Gyro:  X=%.2f Y=%.2f Z=%.2f\r\n",
+           sample.gyro[0], sample.gyro[1], sample.gyro[2]);
 }
@@ -17,10 +17,37 @@
 #include "sl_sleeptimer.h"
 #include "sl_gpio.h"
 #include "sl_clock_manager.h"
+#include "sl_core.h"
 #include "em_device.h"
+#include "sl_icm42688p_timestamp.h"
+#include "sl_icm42688p_drift.h"
+#include "sl_icm42688p_resample.h"
+#include "sl_icm42688p_merge.h"
+#include "sl_component_catalog.h"
+
+/* The edge is captured on SYSRTC group 0 CAP0, the only capture channel of
+   the sleeptimer's SYSRTC, fed from PRS consumer SYSRTC0_IN0. The sleeptimer
+   uses compares 0 and 1 of that group. When the HFXO manager is present it
+   claims CAP0 and SYSRTC0_IN0 as well (PRS channel 2, HFXO startup timing),
+   and with the power manager PRS channel 1 carries the HFXO wakeup request:
+   the driver then falls back to reading the sleeptimer in the GPIO IRQ. */
+#if SL_ICM42688P_EDGE_CAPTURE_ENABLE && !defined(SL_CATALOG_HFXO_MANAGER_PRESENT)
+#define EDGE_CAPTURE        1
+#include "sl_hal_sysrtc.h"
+#else
+#define EDGE_CAPTURE        0
+#endif
+
+#if EDGE_CAPTURE && defined(SL_CATALOG_POWER_MANAGER_PRESENT) && (SL_ICM42688P_EDGE_CAPTURE_PRS_CHANNEL == 1)
+#error "SL_ICM42688P_EDGE_CAPTURE_PRS_CHANNEL: PRS channel 1 is taken by the sleeptimer's HFXO wakeup"
+#endif
+
+#include "dmadrv.h"
+#include "em_msc.h"
 
 #if defined(_SILICON_LABS_32B_SERIES_2)
 #include "em_eusart.h"
+#include "sl_device_peripheral.h"
 #include "em_gpio.h"
 #else
 #include "sl_hal_eusart.h"
@@ -30,6 +57,173 @@
 /* Local helpers */
 static void sl_icm42688p_chip_select_set(bool select);
 static void sl_icm42688p_hw_delay_short(void);
+static inline int16_t sl_icm42688p_be16(const uint8_t *buf);
+static sl_status_t sl_icm42688p_spi_session(uint8_t cmd, const uint8_t *tx, uint8_t *head, uint16_t head_len, uint8_t *data, uint16_t len);
+static void sl_icm42688p_spi_session_release(void);
+static void sl_icm42688p_spi_session_gpio(uint8_t cmd, const uint8_t *tx, uint8_t *head, uint16_t head_len, uint8_t *data, uint16_t len);
+static void sl_icm42688p_spi_session_fifo(uint8_t cmd, const uint8_t *tx, uint8_t *head, uint16_t head_len, uint8_t *data, uint16_t len);
+static sl_status_t sl_icm42688p_spi_session_dma(uint8_t cmd, const uint8_t *tx, uint8_t *head, uint16_t head_len, uint8_t *data, uint16_t len);
+static void sl_icm42688p_spi_session_dma_done(sl_status_t status, void *context);
+static sl_status_t sl_icm42688p_spi_read(uint8_t reg, uint8_t *head, uint16_t head_len, uint8_t *data, uint16_t len);
+static void sl_icm42688p_dma_init(void);
+static uint32_t sl_icm42688p_spi_set_bitrate(uint32_t bitrate, void *context);
+static sl_status_t sl_icm42688p_autotune_read(uint8_t reg, uint8_t *data, uint16_t len, void *context);
+static sl_status_t sl_icm42688p_autotune_write(uint8_t reg, uint8_t data, void *context);
+static sl_status_t sl_icm42688p_dma_start(const uint8_t *tx, uint8_t *rx, uint16_t len, void *context);
+static bool sl_icm42688p_dma_rx_done(unsigned int channel, unsigned int sequenceNo, void *userParam);
+static void sl_icm42688p_dma_lock(void);
+static void sl_icm42688p_dma_unlock(void);
+static bool sl_icm42688p_bus_busy(void);
+static void sl_icm42688p_int_handler(uint8_t int_no, void *context);
+static void sl_icm42688p_drain_kick(void);
+static bool sl_icm42688p_drain_done(unsigned int channel, unsigned int sequenceNo, void *userParam);
+static void sl_icm42688p_drdy_kick(void);
+static void sl_icm42688p_drdy_done(sl_status_t status, void *context);
+static void sl_icm42688p_edge_capture_init(void);
+static uint32_t sl_icm42688p_edge_capture(void);
+static void sl_icm42688p_timestamp_restart(void);
+static void sl_icm42688p_drift_update(uint64_t sensor_ns, uint64_t ticks);
+static void sl_icm42688p_resample_output(const sl_icm42688p_stamped_sample_t *sample, void *context);
+static uint8_t sl_icm42688p_fresh_fields(const sl_icm42688p_raw_sample_t *raw);
+static void sl_icm42688p_merge_output(const sl_icm42688p_stamped_sample_t *record, void *context);
+static bool sl_icm42688p_fsync_untag(sl_icm42688p_raw_sample_t *raw);
+static sl_status_t sl_icm42688p_wait_status(uint8_t mask, uint32_t timeout_ms);
+static bool sl_icm42688p_warm_check(const sl_icm42688p_profile_t *target);
+static void sl_icm42688p_boot_mark(sl_icm42688p_boot_event_t event);
+static sl_status_t sl_icm42688p_calib_flash_read(uint32_t offset, void *data, uint32_t len, void *context);
+static sl_status_t sl_icm42688p_calib_flash_erase(void *context);
+static sl_status_t sl_icm42688p_calib_flash_write(uint32_t offset, const void *data, uint32_t len, void *context);
+static bool sl_icm42688p_shadow_cacheable(uint8_t bank, uint8_t reg);
+static bool sl_icm42688p_shadow_matches(const sl_icm42688p_reg_setting_t *setting);
+static void sl_icm42688p_fifo_sync(void);
+static void sl_icm42688p_shadow_store(uint8_t reg, uint8_t value);
+
+/* Register shadow: last value read from or written to every configuration
+   register of banks 0-4, so read-modify-write and decode paths skip the bus */
+#define SHADOW_BANKS        5U
+#define SHADOW_REGS         128U
+#define SHADOW_BANK_UNKNOWN 0xFFU
+static uint8_t reg_shadow[SHADOW_BANKS][SHADOW_REGS];
+static uint8_t reg_shadow_valid[SHADOW_BANKS][SHADOW_REGS / 8U];
+static uint8_t current_bank = SHADOW_BANK_UNKNOWN;
+
+/* Longest auto-increment write sl_icm42688p_apply_profile() merges */
+#define PROFILE_BURST_MAX   16U
+
+/* LSB to unit factors, kept in step with the FS_SEL fields as they are
+   written or read so conversions never need the bus */
+#define SCALE_RESET_DEFAULT { ICM42688P_ACCEL_SCALE_16G, ICM42688P_GYRO_SCALE_2000DPS, \
+                              1.0f / ICM42688P_TEMP_SENSITIVITY, ICM42688P_TEMP_OFFSET }
+static sl_icm42688p_scale_t sample_scale = SCALE_RESET_DEFAULT;
+
+/* Bytes per FIFO packet in the active streaming format, 0 in bypass */
+static uint16_t fifo_packet_size = 0;
+
+/* LDMA backed asynchronous transfers */
+static const sl_icm42688p_transport_backend_t dma_backend = {
+  .start  = sl_icm42688p_dma_start,
+  .lock   = sl_icm42688p_dma_lock,
+  .unlock = sl_icm42688p_dma_unlock,
+  .context = NULL,
+};
+static sl_icm42688p_transport_t dma_transport;
+static unsigned int dma_tx_channel;
+static unsigned int dma_rx_channel;
+static bool dma_ready = false;
+static uint8_t dma_tx_fill = 0x00U;   /* clocked out when tx == NULL */
+static uint8_t dma_rx_sink;           /* receives bytes when rx == NULL */
+static uint16_t dma_len;
+
+/* Auto-CS sessions that do not fit the TX FIFO go through LDMA, which keeps
+   TX fed whatever the CPU is doing. The burst is staged in one buffer: each
+   byte goes out before its reply comes back in over it. */
+#define SPI_DMA_SESSION_MAX  (3U + SL_ICM42688P_FIFO_READ_CHUNK)
+static uint8_t spi_dma_buf[SPI_DMA_SESSION_MAX];
+static volatile bool spi_dma_done;
+static volatile sl_status_t spi_dma_status;
+
+/* FIFO watermark drain: INT_STATUS, FIFO_COUNTH/L, then packets, read from
+   0x2D in one burst into alternating ping-pong blocks */
+#define DRAIN_HEADER_LEN   4U   /* command echo, INT_STATUS, FIFO_COUNTH, FIFO_COUNTL */
+#define DRAIN_BLOCK_LEN    (DRAIN_HEADER_LEN + SL_ICM42688P_FIFO_DRAIN_PACKETS * SL_ICM42688P_FIFO_MAX_PACKET_SIZE)
+static uint8_t drain_block[2][DRAIN_BLOCK_LEN];
+static const uint8_t drain_tx[DRAIN_BLOCK_LEN] = { ICM42688P_REG_INT_STATUS0 | 0x80U };   /* command, then zeros */
+static volatile bool drain_enabled = false;
+static volatile bool drain_in_flight = false;
+static uint16_t drain_bytes;    /* packet bytes per drain */
+static sl_icm42688p_fifo_block_callback_t drain_callback;
+static void *drain_context;
+static sl_icm42688p_fifo_drain_stats_t drain_stats;
+
+/* Data-ready acquisition: each DRDY edge is timestamped and the sample
+   burst read over LDMA, so no SPI traffic happens between samples */
+static const uint8_t drdy_tx[ICM42688P_SAMPLE_FSYNC_BURST_LEN + 1U] = { ICM42688P_REG_TEMP_DATA1 | 0x80U };
+static uint8_t drdy_rx[ICM42688P_SAMPLE_FSYNC_BURST_LEN + 1U];   /* command echo, then the burst */
+static uint16_t drdy_len;          /* bytes per read, command included */
+static volatile bool drdy_enabled = false;
+static volatile bool drdy_in_flight = false;
+static volatile bool drdy_pending = false;   /* edge deferred by a blocking session */
+static uint32_t drdy_edge;
+static uint32_t drdy_edge_index;   /* edge count at drdy_edge, one per sample period */
+static sl_icm42688p_drdy_callback_t drdy_callback;
+static void *drdy_context;
+static sl_icm42688p_drdy_stats_t drdy_stats;
+static sl_icm42688p_raw_sample_t drdy_prev;   /* last read, to tell fresh fields from held */
+static bool drdy_prev_valid;
+
+/* FSYNC tagging */
+#define DRDY_FSYNC_OFFSET  (1U + ICM42688P_REG_TMST_FSYNCH - ICM42688P_REG_TEMP_DATA1)
+static uint8_t fsync_ui_sel = ICM42688P_FSYNC_UI_SEL_OFF;   /* FSYNC_UI_SEL the shadow saw written */
+/* Raw word whose LSB carries the tag, per FSYNC_UI_SEL */
+static const uint8_t fsync_tag_word[8] = {
+  0, SL_ICM42688P_RAW_TEMP, SL_ICM42688P_RAW_GYRO_X, SL_ICM42688P_RAW_GYRO_Y, SL_ICM42688P_RAW_GYRO_Z,
+  SL_ICM42688P_RAW_ACCEL_X, SL_ICM42688P_RAW_ACCEL_Y, SL_ICM42688P_RAW_ACCEL_Z,
+};
+
+/* Sample time: FIFO TMST of each packet, anchored to captures of the INT
+   edge on the sleeptimer counter (see sl_icm42688p_timestamp.h). Written
+   from the IRQs only once acquisition runs. */
+static sl_icm42688p_timestamp_t timestamp;
+static uint32_t drain_edge;
+static bool drain_edge_valid;   /* burst kicked by an edge, not a re-kick */
+static uint64_t drain_ts[2][SL_ICM42688P_FIFO_DRAIN_PACKETS];
+
+/* ODR drift against the sleeptimer, measured on the same edges and packets
+   as the timestamps; DRDY samples can be resampled onto the nominal grid */
+static uint32_t odr_nominal_ns;
+static sl_icm42688p_drift_t drift;
+static sl_icm42688p_resample_t resample;
+static bool resample_enabled = SL_ICM42688P_RESAMPLE_ENABLE;
+
+/* With accel and gyro at different ODRs, DRDY samples can go through the
+   merge instead: aligned records at their own rate (0 = off) */
+static sl_icm42688p_merge_t merge;
+static uint32_t merge_period_ns;
+static sl_icm42688p_merge_mode_t merge_mode = SL_ICM42688P_MERGE_HOLD;
+
+/* Bring-up timeline, and the interface setup init writes */
+#define INIT_INTF_CONFIG0  (uint8_t)(ICM42688P_INTF_CONFIG0_I2C_DISABLE | ICM42688P_INTF_CONFIG0_FIFO_COUNT_ENDIAN \
+                                     | ICM42688P_INTF_CONFIG0_SENSOR_DATA_ENDIAN)
+static sl_icm42688p_boot_trace_t boot_trace;
+
+/* SPI bit rate in use and the outcome of the last autotune */
+static uint32_t spi_bitrate = SL_ICM42688P_SPI_BITRATE;
+static sl_icm42688p_autotune_result_t autotune_result;
+
+/* SPI bus activity, updated on every chip-select session */
+static sl_icm42688p_spi_stats_t spi_stats;
+
+/* Set while a blocking session owns the bus */
+static volatile bool spi_session_active = false;
+
+/* Chip select: driven by the EUSART with bursts queued through the FIFOs,
+   or by GPIO around byte-at-a-time exchanges */
+#define SPI_FIFO_DEPTH     16U
+static bool spi_auto_cs = SL_ICM42688P_SPI_AUTO_CS;
+static const sl_gpio_t spi_cs_pin = {
+  .port = SL_ICM42688P_SPI_EUSART_CS_PORT,
+  .pin  = SL_ICM42688P_SPI_EUSART_CS_PIN
+};
 
 /* ----- SPI init ----- */
 sl_status_t sl_icm42688p_spi_init(void)
@@ -40,18 +234,26 @@ sl_status_t sl_icm42688p_spi_init(void)
   EUSART_SpiInit_TypeDef init = EUSART_SPI_MASTER_INIT_DEFAULT_HF;
   EUSART_SpiAdvancedInit_TypeDef advancedInit = EUSART_SPI_ADVANCED_INIT_DEFAULT;
 
-  init.bitRate = 3300000UL;
+  init.bitRate = spi_bitrate;
   init.advancedSettings = &advancedInit;
 
-  advancedInit.autoCsEnable = false;
+  /* Auto CS stays on in the EUSART; routing the pin decides who drives CS */
+  advancedInit.autoCsEnable = true;
+  advancedInit.autoCsSetupTime = SL_ICM42688P_SPI_CS_SETUP;
+  advancedInit.autoCsHoldTime = SL_ICM42688P_SPI_CS_HOLD;
   advancedInit.msbFirst = true;
 #else
   sl_hal_eusart_spi_config_t init = SL_HAL_EUSART_SPI_MASTER_INIT_DEFAULT_HF;
   sl_hal_eusart_spi_advanced_config_t advancedInit = SL_HAL_EUSART_SPI_ADVANCED_INIT_DEFAULT;
 
+  uint32_t freq = 0;
+  sl_clock_manager_get_clock_branch_frequency(SL_CLOCK_BRANCH_EUSART1CLK, &freq);
+  init.clock_div = sl_hal_eusart_spi_calculate_clock_div(freq, spi_bitrate);
   init.advanced_config = &advancedInit;
 
-  advancedInit.auto_cs_enable = false;
+  advancedInit.auto_cs_enable = true;
+  advancedInit.auto_cs_setup_time = (sl_hal_eusart_cs_time_t)SL_ICM42688P_SPI_CS_SETUP;
+  advancedInit.auto_cs_hold_time = (sl_hal_eusart_cs_time_t)SL_ICM42688P_SPI_CS_HOLD;
   advancedInit.msb_first = true;
 #endif
 
@@ -79,7 +281,115 @@ sl_status_t sl_icm42688p_spi_init(void)
   GPIO->EUSARTROUTE[SL_ICM42688P_SPI_EUSART_PERIPHERAL_NO].TXROUTE   = (SL_ICM42688P_SPI_EUSART_TX_PORT << _GPIO_EUSART_TXROUTE_PORT_SHIFT) | (SL_ICM42688P_SPI_EUSART_TX_PIN << _GPIO_EUSART_TXROUTE_PIN_SHIFT);
   GPIO->EUSARTROUTE[SL_ICM42688P_SPI_EUSART_PERIPHERAL_NO].RXROUTE   = (SL_ICM42688P_SPI_EUSART_RX_PORT << _GPIO_EUSART_RXROUTE_PORT_SHIFT) | (SL_ICM42688P_SPI_EUSART_RX_PIN << _GPIO_EUSART_RXROUTE_PIN_SHIFT);
   GPIO->EUSARTROUTE[SL_ICM42688P_SPI_EUSART_PERIPHERAL_NO].SCLKROUTE = (SL_ICM42688P_SPI_EUSART_SCLK_PORT << _GPIO_EUSART_SCLKROUTE_PORT_SHIFT) | (SL_ICM42688P_SPI_EUSART_SCLK_PIN << _GPIO_EUSART_SCLKROUTE_PIN_SHIFT);
-  GPIO->EUSARTROUTE[SL_ICM42688P_SPI_EUSART_PERIPHERAL_NO].ROUTEEN   = GPIO_EUSART_ROUTEEN_RXPEN | GPIO_EUSART_ROUTEEN_TXPEN | GPIO_EUSART_ROUTEEN_SCLKPEN;
+  GPIO->EUSARTROUTE[SL_ICM42688P_SPI_EUSART_PERIPHERAL_NO].CSROUTE   = (SL_ICM42688P_SPI_EUSART_CS_PORT << _GPIO_EUSART_CSROUTE_PORT_SHIFT) | (SL_ICM42688P_SPI_EUSART_CS_PIN << _GPIO_EUSART_CSROUTE_PIN_SHIFT);
+  GPIO->EUSARTROUTE[SL_ICM42688P_SPI_EUSART_PERIPHERAL_NO].ROUTEEN   = GPIO_EUSART_ROUTEEN_RXPEN | GPIO_EUSART_ROUTEEN_TXPEN | GPIO_EUSART_ROUTEEN_SCLKPEN
+                                                                       | (spi_auto_cs ? GPIO_EUSART_ROUTEEN_CSPEN : 0U);
+
+  sl_icm42688p_dma_init();
+
+  return SL_STATUS_OK;
+}
+
+/* ----- SPI bit rate ----- */
+sl_status_t sl_icm42688p_spi_autotune(sl_icm42688p_autotune_result_t *result)
+{
+  static const sl_icm42688p_autotune_link_t link = {
+    .set_bitrate = sl_icm42688p_spi_set_bitrate,
+    .read        = sl_icm42688p_autotune_read,
+    .write       = sl_icm42688p_autotune_write,
+    .context     = NULL,
+  };
+  static const sl_icm42688p_autotune_config_t config = {
+    .start          = SL_ICM42688P_SPI_BITRATE,
+    .max            = SL_ICM42688P_SPI_AUTOTUNE_MAX,
+    .step           = SL_ICM42688P_SPI_AUTOTUNE_STEP,
+    .reads          = SL_ICM42688P_SPI_AUTOTUNE_READS,
+    .margin_percent = SL_ICM42688P_SPI_AUTOTUNE_MARGIN,
+  };
+  sl_status_t status;
+
+  if (sl_icm42688p_bus_busy()) {
+    return SL_STATUS_BUSY;
+  }
+
+  status = sl_icm42688p_autotune_run(&link, &config, &autotune_result);
+  if (result) {
+    *result = autotune_result;
+  }
+  return status;
+}
+
+uint32_t sl_icm42688p_get_spi_bitrate(void)
+{
+  return spi_bitrate;
+}
+
+void sl_icm42688p_get_autotune_result(sl_icm42688p_autotune_result_t *result)
+{
+  if (result) {
+    *result = autotune_result;
+  }
+}
+
+/* ----- Chip select mode ----- */
+/* With the CS route disabled the pin falls back to its GPIO output, which
+   idles high between sessions */
+sl_status_t sl_icm42688p_spi_set_auto_cs(bool enable)
+{
+  if (sl_icm42688p_bus_busy()) {
+    return SL_STATUS_BUSY;
+  }
+
+  if (enable) {
+    GPIO->EUSARTROUTE[SL_ICM42688P_SPI_EUSART_PERIPHERAL_NO].ROUTEEN |= GPIO_EUSART_ROUTEEN_CSPEN;
+  } else {
+    GPIO->EUSARTROUTE[SL_ICM42688P_SPI_EUSART_PERIPHERAL_NO].ROUTEEN &= ~GPIO_EUSART_ROUTEEN_CSPEN;
+  }
+  spi_auto_cs = enable;
+
+  return SL_STATUS_OK;
+}
+
+bool sl_icm42688p_spi_get_auto_cs(void)
+{
+  return spi_auto_cs;
+}
+
+/* Average cost of one sample burst (command + 14 data bytes) in each chip
+   select mode, measured with the DWT cycle counter; results land in the SPI
+   stats. The mode in use before the call is restored. */
+sl_status_t sl_icm42688p_spi_benchmark(uint16_t iterations)
+{
+  uint8_t buf[ICM42688P_SAMPLE_BURST_LEN];
+  bool auto_cs = spi_auto_cs;
+  uint32_t start;
+
+  if (iterations == 0) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  if (sl_icm42688p_bus_busy()) {
+    return SL_STATUS_BUSY;
+  }
+
+  DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  sl_icm42688p_spi_set_auto_cs(false);
+  start = DWT->CYCCNT;
+  for (uint16_t i = 0; i < iterations; ++i) {
+    sl_icm42688p_spi_session((uint8_t)(ICM42688P_REG_TEMP_DATA1 | 0x80U), NULL, buf, sizeof(buf), NULL, 0);
+  }
+  spi_stats.cycles_gpio_cs = (DWT->CYCCNT - start) / iterations;
+
+  sl_icm42688p_spi_set_auto_cs(true);
+  start = DWT->CYCCNT;
+  for (uint16_t i = 0; i < iterations; ++i) {
+    sl_icm42688p_spi_session((uint8_t)(ICM42688P_REG_TEMP_DATA1 | 0x80U), NULL, buf, sizeof(buf), NULL, 0);
+  }
+  spi_stats.cycles_auto_cs = (DWT->CYCCNT - start) / iterations;
+
+  sl_icm42688p_spi_set_auto_cs(auto_cs);
 
   return SL_STATUS_OK;
 }
@@ -87,58 +397,82 @@ sl_status_t sl_icm42688p_spi_init(void)
 
 /* ----- Core init ----- */
 sl_status_t sl_icm42688p_init(void)
+{
+  return sl_icm42688p_init_warm(NULL);
+}
+
+sl_status_t sl_icm42688p_init_warm(const sl_icm42688p_profile_t *target)
 {
   uint8_t who = 0;
+  sl_status_t status;
+
+  memset(&boot_trace, 0, sizeof(boot_trace));
+  boot_trace.start = sl_sleeptimer_get_tick_count();
 
   sl_icm42688p_spi_init();
+  sl_icm42688p_boot_mark(SL_ICM42688P_BOOT_SPI_READY);
 
-  /* Soft reset */
-  sl_icm42688p_reset();
+  /* After an MCU-only reset the sensor may still run target: keep it */
+  boot_trace.warm = (target != NULL) && sl_icm42688p_warm_check(target);
 
-  /* Wait for reset */
-  sl_sleeptimer_delay_millisecond(100);
+  /* Soft reset, then RESET_DONE instead of a fixed wait */
+  if (!boot_trace.warm) {
+    status = sl_icm42688p_reset();
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+  }
+  sl_icm42688p_boot_mark(SL_ICM42688P_BOOT_RESET_DONE);
 
   /* Read WHO_AM_I */
-  sl_icm42688p_read_register(ICM42688P_REG_WHO_AM_I, &who, 1);
+  status = sl_icm42688p_read_register(ICM42688P_REG_WHO_AM_I, &who, 1);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
   if (who != ICM42688P_DEVICE_ID) {
     return SL_STATUS_INITIALIZATION;
   }
+  sl_icm42688p_boot_mark(SL_ICM42688P_BOOT_ID_VERIFIED);
+
+#if SL_ICM42688P_SPI_AUTOTUNE_ENABLE
+  /* Fastest verified rate; on failure the configured rate stays programmed */
+  if (sl_icm42688p_spi_autotune(NULL) != SL_STATUS_OK) {
+    sl_icm42688p_spi_set_bitrate(SL_ICM42688P_SPI_BITRATE, NULL);
+  }
+  sl_icm42688p_boot_mark(SL_ICM42688P_BOOT_SPI_TUNED);
+#endif
 
-  /* Disable I2C and ensure SPI-only */
-  sl_icm42688p_write_register(ICM42688P_REG_INTF_CONFIG0, (uint8_t)ICM42688P_INTF_CONFIG0_I2C_DISABLE);
+  if (!boot_trace.warm) {
+    /* Disable I2C and ensure SPI-only; keep the big-endian data and FIFO_COUNT
+       reset defaults every decoder in this driver relies on */
+    sl_icm42688p_write_register(ICM42688P_REG_INTF_CONFIG0, INIT_INTF_CONFIG0);
 
-  /* Power up: enable accel & gyro low-noise mode and enable temperature */
-  uint8_t pwr = (uint8_t)(ICM42688P_PWR_MGMT0_ACCEL_MODE_LOWNOISE | ICM42688P_PWR_MGMT0_GYRO_MODE_LOWNOISE);
-  pwr &= (uint8_t)(~ICM42688P_PWR_MGMT0_TEMP_DIS);
-  sl_icm42688p_write_register(ICM42688P_REG_PWR_MGMT0, pwr);
+    /* Power up: enable accel & gyro low-noise mode and enable temperature */
+    uint8_t pwr = (uint8_t)(ICM42688P_PWR_MGMT0_ACCEL_MODE_LOWNOISE | ICM42688P_PWR_MGMT0_GYRO_MODE_LOWNOISE);
+    pwr &= (uint8_t)(~ICM42688P_PWR_MGMT0_TEMP_DIS);
+    sl_icm42688p_write_register(ICM42688P_REG_PWR_MGMT0, pwr);
 
-  /* small startup delay */
-  sl_sleeptimer_delay_millisecond(30);
+    /* No register writes for 200 us after a power mode change. Data is not
+       waited for here: sl_icm42688p_wait_data_ready() polls for it. */
+    sl_sleeptimer_delay_millisecond(1);
 
-  /* Configure default FS/ODR (Bank 1) */
-  sl_icm42688p_set_full_scale_accel((ICM42688P_ACCEL_CONFIG0_FS_16G >> ICM42688P_ACCEL_CONFIG0_SHIFT_FS_SEL));
-  sl_icm42688p_set_full_scale_gyro((ICM42688P_GYRO_CONFIG0_FS_2000DPS >> ICM42688P_GYRO_CONFIG0_SHIFT_FS_SEL));
+    /* Configure default FS/ODR (Bank 1) */
+    sl_icm42688p_set_full_scale_accel((ICM42688P_ACCEL_CONFIG0_FS_16G >> ICM42688P_ACCEL_CONFIG0_SHIFT_FS_SEL));
+    sl_icm42688p_set_full_scale_gyro((ICM42688P_GYRO_CONFIG0_FS_2000DPS >> ICM42688P_GYRO_CONFIG0_SHIFT_FS_SEL));
+  }
+  sl_icm42688p_boot_mark(SL_ICM42688P_BOOT_POWERED);
 
   /* Interrupt pin configuration: PC6 as input + ext-int rising edge */
   sl_gpio_set_pin_mode(&(sl_gpio_t){SL_ICM42688P_INT_PORT, SL_ICM42688P_INT_PIN},SL_GPIO_MODE_INPUT_PULL,true);  // true = pull-up, false = pull-down
 
-#if defined(_SILICON_LABS_32B_SERIES_2)
-  /* Use EMLIB to configure external interrupt on rising edge */
-  GPIO_ExtIntConfig((GPIO_Port_TypeDef)SL_ICM42688P_INT_PORT,
-                    SL_ICM42688P_INT_PIN,
-                    SL_ICM42688P_INT_PIN,
-                    true,  /* rising */
-                    false, /* falling */
-                    true); /* enable */
-#else
-  /* For older series, also use GPIO_ExtIntConfig if available */
-  GPIO_ExtIntConfig((GPIO_Port_TypeDef)SL_ICM42688P_INT_PORT,
-                    SL_ICM42688P_INT_PIN,
-                    SL_ICM42688P_INT_PIN,
-                    true,
-                    false,
-                    true);
-#endif
+  /* External interrupt on the rising edge, dispatched to sl_icm42688p_int_handler() */
+  int32_t int_no = SL_ICM42688P_INT_PIN;
+  sl_gpio_configure_external_interrupt(&(sl_gpio_t){SL_ICM42688P_INT_PORT, SL_ICM42688P_INT_PIN},
+                                       &int_no,
+                                       SL_GPIO_INTERRUPT_RISING_EDGE,
+                                       sl_icm42688p_int_handler,
+                                       NULL);
+  sl_icm42688p_edge_capture_init();
 
   /* Configure INT pin active polarity open-drain / active low if desired by writing INT_CONFIG */
   /* Set INT_CONFIG: active high default; set to active low/open-drain if board expects it.
@@ -147,61 +481,137 @@ sl_status_t sl_icm42688p_init(void)
   return SL_STATUS_OK;
 }
 
+/* First valid sample after power-up, polled on DATA_RDY */
+sl_status_t sl_icm42688p_wait_data_ready(uint32_t timeout_ms)
+{
+  uint32_t start = sl_sleeptimer_get_tick_count();
+  uint32_t timeout = sl_sleeptimer_ms_to_tick((uint16_t)timeout_ms);
+  uint8_t pwr = 0;
+  bool accel_on;
+  bool gyro_on;
+  sl_icm42688p_raw_sample_t raw;
+  sl_status_t status;
+
+  status = sl_icm42688p_read_register(ICM42688P_REG_PWR_MGMT0, &pwr, 1);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  accel_on = (pwr & ICM42688P_PWR_MGMT0_ACCEL_MODE_LOWPOWER) != 0;
+  gyro_on = (pwr & ICM42688P_PWR_MGMT0_GYRO_MODE_LOWNOISE) == ICM42688P_PWR_MGMT0_GYRO_MODE_LOWNOISE;
+
+  /* The data registers hold the invalid marker until a sensor's first
+     measurement after start-up */
+  do {
+    status = sl_icm42688p_wait_status(ICM42688P_INT_STATUS0_DATA_RDY, timeout_ms);
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+    status = sl_icm42688p_read_raw_sample(&raw);
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+    if ((!accel_on || raw.data[SL_ICM42688P_RAW_ACCEL_X] != SL_ICM42688P_FIFO_INVALID_DATA)
+        && (!gyro_on || raw.data[SL_ICM42688P_RAW_GYRO_X] != SL_ICM42688P_FIFO_INVALID_DATA)) {
+      sl_icm42688p_boot_mark(SL_ICM42688P_BOOT_FIRST_DATA);
+      return SL_STATUS_OK;
+    }
+  } while ((uint32_t)(sl_sleeptimer_get_tick_count() - start) <= timeout);
+
+  return SL_STATUS_TIMEOUT;
+}
+
+void sl_icm42688p_get_boot_trace(sl_icm42688p_boot_trace_t *trace)
+{
+  if (trace) {
+    *trace = boot_trace;
+  }
+}
+
 sl_status_t sl_icm42688p_deinit(void)
 {
   /* Put device to sleep  */
   uint8_t reg = ICM42688P_PWR_MGMT0_ACCEL_MODE_OFF | ICM42688P_PWR_MGMT0_GYRO_MODE_STANDBY | ICM42688P_PWR_MGMT0_TEMP_DIS;
-  sl_icm42688p_write_register(ICM42688P_REG_PWR_MGMT0, reg);
-  return SL_STATUS_OK;
+  return sl_icm42688p_write_register(ICM42688P_REG_PWR_MGMT0, reg);
 }
 
 sl_status_t sl_icm42688p_reset(void)
 {
     uint8_t reset = 0x01; // Set SOFT_RESET_CONFIG bit
-    sl_icm42688p_write_register(ICM42688P_REG_DEVICE_CONFIG, reset);
+    sl_status_t status;
+
+    /* DEVICE_CONFIG is in bank 0, and the sensor may have been left in any
+       bank (an MCU-only reset, or init after a failed warm check): select
+       it whatever the tracking says */
+    current_bank = SHADOW_BANK_UNKNOWN;
+    status = sl_icm42688p_set_bank(ICM42688P_BANK_0);
+    if (status == SL_STATUS_OK) {
+        status = sl_icm42688p_write_register(ICM42688P_REG_DEVICE_CONFIG, reset);
+    }
+    if (status != SL_STATUS_OK) {
+        return status;
+    }
     sl_sleeptimer_delay_millisecond(1); // Wait at least 1 ms for reset to take effect
-    return SL_STATUS_OK;
+
+    /* Every register is back at its reset value, with bank 0 selected */
+    sl_icm42688p_invalidate_shadow();
+    current_bank = ICM42688P_BANK_0;
+    sample_scale = (sl_icm42688p_scale_t)SCALE_RESET_DEFAULT;
+    fsync_ui_sel = ICM42688P_FSYNC_UI_SEL_OFF;
+
+    /* RESET_DONE is set once the reset has completed, and cleared by the read */
+    return sl_icm42688p_wait_status(ICM42688P_INT_STATUS0_RESET_DONE, SL_ICM42688P_RESET_TIMEOUT_MS);
 }
 
 /* ----- Register read/write ----- */
 sl_status_t sl_icm42688p_read_register(uint8_t reg, uint8_t *data, uint16_t len)
 {
-  sl_icm42688p_chip_select_set(true);
-  sl_icm42688p_hw_delay_short();
+  sl_status_t status;
 
-#if defined(_SILICON_LABS_32B_SERIES_2)
-  EUSART_Spi_TxRx(SL_ICM42688P_SPI_EUSART_PERIPHERAL, (uint8_t)(reg | 0x80U));
-  for (uint16_t i = 0; i < len; ++i) {
-    data[i] = EUSART_Spi_TxRx(SL_ICM42688P_SPI_EUSART_PERIPHERAL, 0x00U);
+  if (len == 1 && sl_icm42688p_shadow_cacheable(current_bank, reg)
+      && (reg_shadow_valid[current_bank][reg >> 3] & (1U << (reg & 7U)))) {
+    *data = reg_shadow[current_bank][reg];
+    spi_stats.shadow_hits++;
+    return SL_STATUS_OK;
   }
-#else
-  sl_hal_eusart_spi_tx_rx(SL_ICM42688P_SPI_EUSART_PERIPHERAL, (uint8_t)(reg | 0x80U));
-  for (uint16_t i = 0; i < len; ++i) {
-    data[i] = sl_hal_eusart_spi_tx_rx(SL_ICM42688P_SPI_EUSART_PERIPHERAL, 0x00U);
+
+  status = sl_icm42688p_spi_read(reg, data, len, NULL, 0);
+  if (status != SL_STATUS_OK) {
+    return status;
   }
-#endif
 
-  sl_icm42688p_chip_select_set(false);
-  sl_icm42688p_hw_delay_short();
+  for (uint16_t i = 0; i < len && (reg + i) < SHADOW_REGS; ++i) {
+    sl_icm42688p_shadow_store((uint8_t)(reg + i), data[i]);
+  }
 
   return SL_STATUS_OK;
 }
 
 sl_status_t sl_icm42688p_write_register(uint8_t reg, uint8_t data)
 {
-  sl_icm42688p_chip_select_set(true);
-  sl_icm42688p_hw_delay_short();
+  return sl_icm42688p_write_registers(reg, &data, 1);
+}
 
-#if defined(_SILICON_LABS_32B_SERIES_2)
-  EUSART_Spi_TxRx(SL_ICM42688P_SPI_EUSART_PERIPHERAL, (uint8_t)(reg & 0x7FU));
-  EUSART_Spi_TxRx(SL_ICM42688P_SPI_EUSART_PERIPHERAL, data);
-#else
-  sl_hal_eusart_spi_tx_rx(SL_ICM42688P_SPI_EUSART_PERIPHERAL, (uint8_t)(reg & 0x7FU));
-  sl_hal_eusart_spi_tx_rx(SL_ICM42688P_SPI_EUSART_PERIPHERAL, data);
-#endif
+/* One write session: the address auto-increments after every data byte */
+sl_status_t sl_icm42688p_write_registers(uint8_t reg, const uint8_t *data, uint16_t len)
+{
+  sl_status_t status;
 
-  sl_icm42688p_chip_select_set(false);
-  sl_icm42688p_hw_delay_short();
+  if (!data || len == 0) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  status = sl_icm42688p_spi_session((uint8_t)(reg & 0x7FU), data, NULL, 0, NULL, len);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  for (uint16_t i = 0; i < len && (reg + i) < SHADOW_REGS; ++i) {
+    if ((uint8_t)(reg + i) == ICM42688P_REG_BANK_SEL) {
+      current_bank = (data[i] < SHADOW_BANKS) ? data[i] : SHADOW_BANK_UNKNOWN;
+    } else {
+      sl_icm42688p_shadow_store((uint8_t)(reg + i), data[i]);
+    }
+  }
 
   return SL_STATUS_OK;
 }
@@ -211,14 +621,22 @@ sl_status_t sl_icm42688p_masked_write(uint8_t addr, uint8_t data, uint8_t mask)
     uint8_t reg;
     sl_status_t status;
 
+    /* Served from the shadow once the register has been seen */
     status = sl_icm42688p_read_register(addr, &reg, 1);
     if (status != SL_STATUS_OK) {
         return status;
     }
 
+    uint8_t old = reg;
     reg &= ~mask;   // clear bits to be modified
     reg |= (data & mask);  // set new value
 
+    /* Nothing to change: skip the bus entirely when the shadow vouches for it */
+    if (reg == old && sl_icm42688p_shadow_cacheable(current_bank, addr)) {
+        spi_stats.shadow_hits++;
+        return SL_STATUS_OK;
+    }
+
     status = sl_icm42688p_write_register(addr, reg);
     return status;
 }
@@ -227,54 +645,163 @@ sl_status_t sl_icm42688p_masked_write(uint8_t addr, uint8_t data, uint8_t mask)
 sl_status_t sl_icm42688p_set_bank(uint8_t bank)
 {
     uint8_t val = bank & 0x07; // Only bits 2:0 are valid
+
+    if (val == current_bank) {
+        spi_stats.shadow_hits++;
+        return SL_STATUS_OK;
+    }
+
     return sl_icm42688p_write_register(ICM42688P_REG_BANK_SEL, val);
 }
 
-/* ----- FS & ODR configuration ----- */
-sl_status_t sl_icm42688p_set_full_scale_accel(uint8_t fs_code)
+void sl_icm42688p_invalidate_shadow(void)
 {
-  sl_icm42688p_set_bank(ICM42688P_BANK_1);
-  uint8_t reg = 0;
-  /* FS code expected 0..7, we place into FS bits (shift) */
-  reg = (uint8_t)((fs_code << ICM42688P_ACCEL_CONFIG0_SHIFT_FS_SEL) & ICM42688P_ACCEL_CONFIG0_MASK_FS_SEL);
-  /* default to 1 kHz */
-  reg |= (ICM42688P_ODR_CODE_1KHZ & 0x0FU);
-  sl_icm42688p_write_register(ICM42688P_REG_ACCEL_CONFIG0, reg);
+    memset(reg_shadow_valid, 0, sizeof(reg_shadow_valid));
+    current_bank = SHADOW_BANK_UNKNOWN;
+}
+
+/* ----- Configuration profiles ----- */
+sl_status_t sl_icm42688p_apply_profile(const sl_icm42688p_profile_t *profile)
+{
+  uint8_t burst[PROFILE_BURST_MAX];
+  bool power_changed = false;
+  bool fifo_changed = false;
+  uint16_t i = 0;
+
+  if (!profile || !profile->settings) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  if (sl_icm42688p_bus_busy()) {
+    return SL_STATUS_BUSY;
+  }
+
+  while (i < profile->count) {
+    const sl_icm42688p_reg_setting_t *first = &profile->settings[i];
+    uint16_t n = 1;
+
+    if (sl_icm42688p_shadow_matches(first)) {
+      spi_stats.shadow_hits++;
+      i++;
+      continue;
+    }
+
+    /* Run over the following entries at consecutive addresses. An unchanged
+       register inside the run costs one byte, a new session at least two,
+       so only unchanged entries at the end of the run are dropped. */
+    burst[0] = first->value;
+    while (i + n < profile->count && n < PROFILE_BURST_MAX) {
+      const sl_icm42688p_reg_setting_t *next = &profile->settings[i + n];
+      if (next->bank != first->bank || next->reg != first->reg + n) {
+        break;
+      }
+      burst[n++] = next->value;
+    }
+    while (n > 1 && sl_icm42688p_shadow_matches(&profile->settings[i + n - 1])) {
+      n--;
+    }
+
+    sl_status_t status = sl_icm42688p_set_bank(first->bank);
+    if (status == SL_STATUS_OK) {
+      status = sl_icm42688p_write_registers(first->reg, burst, n);
+    }
+    if (status != SL_STATUS_OK) {
+      sl_icm42688p_invalidate_shadow();
+      return status;
+    }
+
+    if (first->bank == ICM42688P_BANK_0) {
+      for (uint16_t k = 0; k < n; ++k) {
+        uint8_t reg = (uint8_t)(first->reg + k);
+        power_changed |= (reg == ICM42688P_REG_PWR_MGMT0);
+        fifo_changed |= (reg == ICM42688P_REG_FIFO_CONFIG || reg == ICM42688P_REG_FIFO_CONFIG1);
+      }
+    }
+
+    i = (uint16_t)(i + n);
+  }
+
+  /* Everything else in the driver expects bank 0 */
   sl_icm42688p_set_bank(ICM42688P_BANK_0);
+
+  /* No register writes for 200 us after a power mode change */
+  if (power_changed) {
+    sl_sleeptimer_delay_millisecond(1);
+  }
+
+  /* Packets queued in the old format would confuse the parser */
+  if (fifo_changed) {
+    sl_icm42688p_fifo_sync();
+    if (fifo_packet_size != 0) {
+      sl_icm42688p_fifo_flush();
+    }
+  }
+
   return SL_STATUS_OK;
 }
 
+/* ----- FS & ODR configuration ----- */
+sl_status_t sl_icm42688p_set_full_scale_accel(uint8_t fs_code)
+{
+  /* FS code expected 0..7, we place into FS bits (shift); ODR is left as is */
+  return sl_icm42688p_masked_write(ICM42688P_REG_ACCEL_CONFIG0,
+                                   (uint8_t)(fs_code << ICM42688P_ACCEL_CONFIG0_SHIFT_FS_SEL),
+                                   ICM42688P_ACCEL_CONFIG0_MASK_FS_SEL);
+}
+
 sl_status_t sl_icm42688p_set_full_scale_gyro(uint8_t fs_code)
 {
-  sl_icm42688p_set_bank(ICM42688P_BANK_1);
-  uint8_t reg = 0;
-  reg = (uint8_t)((fs_code << ICM42688P_GYRO_CONFIG0_SHIFT_FS_SEL) & ICM42688P_GYRO_CONFIG0_MASK_FS_SEL);
-  reg |= (ICM42688P_GYRO_ODR_1KHZ & 0x0FU);
-  sl_icm42688p_write_register(ICM42688P_REG_GYRO_CONFIG0, reg);
-  sl_icm42688p_set_bank(ICM42688P_BANK_0);
-  return SL_STATUS_OK;
+  return sl_icm42688p_masked_write(ICM42688P_REG_GYRO_CONFIG0,
+                                   (uint8_t)(fs_code << ICM42688P_GYRO_CONFIG0_SHIFT_FS_SEL),
+                                   ICM42688P_GYRO_CONFIG0_MASK_FS_SEL);
 }
 
 float sl_icm42688p_set_sample_rate(float sample_rate)
 {
-  uint8_t odr_code = (sample_rate >= 1000.0f) ? ICM42688P_ODR_CODE_1KHZ : ICM42688P_ODR_CODE_200HZ;
+  /* Both sensors run in low-noise mode: 12.5 Hz to 32 kHz */
+  const sl_icm42688p_odr_info_t *odr = sl_icm42688p_odr_nearest(sample_rate, SL_ICM42688P_ODR_LN);
 
-  sl_icm42688p_set_bank(ICM42688P_BANK_1);
-  uint8_t reg = 0;
+  if (!odr) {
+    odr = sl_icm42688p_odr_info(ICM42688P_ODR_CODE_1KHZ);
+  }
+
+  /* Update gyroscope and accelerometer ODR; 0 if the bus refused either */
+  if (sl_icm42688p_masked_write(ICM42688P_REG_GYRO_CONFIG0, odr->code, ICM42688P_GYRO_ODR_MASK) != SL_STATUS_OK
+      || sl_icm42688p_masked_write(ICM42688P_REG_ACCEL_CONFIG0, odr->code, ICM42688P_ACCEL_ODR_MASK) != SL_STATUS_OK) {
+    return 0.0f;
+  }
 
-  /* Update gyroscope ODR */
-  sl_icm42688p_read_register(ICM42688P_REG_GYRO_CONFIG0, &reg, 1);
-  reg = (uint8_t)((reg & 0xF0U) | (odr_code & 0x0FU));
-  sl_icm42688p_write_register(ICM42688P_REG_GYRO_CONFIG0, reg);
+  return odr->rate_hz;
+}
 
-  /* Update accelerometer ODR */
-  sl_icm42688p_read_register(ICM42688P_REG_ACCEL_CONFIG0, &reg, 1);
-  reg = (uint8_t)((reg & 0xF0U) | (odr_code & 0x0FU));
-  sl_icm42688p_write_register(ICM42688P_REG_ACCEL_CONFIG0, reg);
+sl_status_t sl_icm42688p_set_sample_rates(float *accel_rate, float *gyro_rate)
+{
+  /* Each sensor at its own ODR, both in low-noise mode */
+  const sl_icm42688p_odr_info_t *accel_odr;
+  const sl_icm42688p_odr_info_t *gyro_odr;
+  sl_status_t status;
 
-  sl_icm42688p_set_bank(ICM42688P_BANK_0);
+  if (!accel_rate || !gyro_rate) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  accel_odr = sl_icm42688p_odr_nearest(*accel_rate, SL_ICM42688P_ODR_ACCEL_LN);
+  gyro_odr = sl_icm42688p_odr_nearest(*gyro_rate, SL_ICM42688P_ODR_GYRO);
+  if (!accel_odr || !gyro_odr) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  status = sl_icm42688p_masked_write(ICM42688P_REG_GYRO_CONFIG0, gyro_odr->code, ICM42688P_GYRO_ODR_MASK);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  status = sl_icm42688p_masked_write(ICM42688P_REG_ACCEL_CONFIG0, accel_odr->code, ICM42688P_ACCEL_ODR_MASK);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
 
-  return (odr_code == ICM42688P_ODR_CODE_1KHZ) ? 1000.0f : 200.0f;
+  *accel_rate = accel_odr->rate_hz;
+  *gyro_rate = gyro_odr->rate_hz;
+  return SL_STATUS_OK;
 }
 
 /* ----- Enable/disable sensors & interrupts ----- */
@@ -289,8 +816,7 @@ sl_status_t sl_icm42688p_enable_sensor(bool accel, bool gyro, bool temp)
     reg |= ICM42688P_PWR_MGMT0_TEMP_DIS;
   }
 
-  sl_icm42688p_write_register(ICM42688P_REG_PWR_MGMT0, reg);
-  return SL_STATUS_OK;
+  return sl_icm42688p_write_register(ICM42688P_REG_PWR_MGMT0, reg);
 }
 
 sl_status_t sl_icm42688p_enable_interrupt(bool data_ready_enable)
@@ -309,7 +835,7 @@ sl_status_t sl_icm42688p_enable_interrupt(bool data_ready_enable)
 
     /* Enable Data Ready interrupt if requested */
     if (data_ready_enable) {
-        int_enable |= ICM42688P_INT_STATUS0_DATA_RDY;  // Set mask for Data Ready interrupt
+        int_enable |= ICM42688P_INT_SOURCE0_UI_DRDY_INT1_EN;  // Set mask for Data Ready interrupt
     }
 
     /* Masked write to INT_SOURCE0 register to enable DATA_RDY interrupt */
@@ -321,21 +847,18 @@ sl_status_t sl_icm42688p_enable_interrupt(bool data_ready_enable)
 sl_status_t sl_icm42688p_accel_read_data(float accel[3])
 {
     uint8_t raw_data[6];
-    float accel_res = ICM42688P_ACCEL_SCALE_16G; // Current resolution
-    int16_t temp;
+    sl_icm42688p_convert_f32_t params;
+    sl_status_t status;
 
     /* Read the six raw data registers into the data array */
-    sl_icm42688p_read_register(ICM42688P_REG_ACCEL_DATA_X1, raw_data, 6);
-
-    /* Convert the MSB and LSB into a signed 16-bit value and multiply by the resolution to get the g value */
-    temp = ((int16_t)raw_data[0] << 8) | raw_data[1];
-    accel[0] = (float)temp * accel_res;
-
-    temp = ((int16_t)raw_data[2] << 8) | raw_data[3];
-    accel[1] = (float)temp * accel_res;
+    status = sl_icm42688p_read_register(ICM42688P_REG_ACCEL_DATA_X1, raw_data, 6);
+    if (status != SL_STATUS_OK) {
+        return status;
+    }
 
-    temp = ((int16_t)raw_data[4] << 8) | raw_data[5];
-    accel[2] = (float)temp * accel_res;
+    /* Big-endian triplet to g with the current resolution */
+    sl_icm42688p_convert_f32_init(&params, sample_scale.accel, NULL);
+    sl_icm42688p_convert_f32(raw_data, sizeof(raw_data), 1, &params, accel);
 
     return SL_STATUS_OK;
 }
@@ -343,21 +866,18 @@ sl_status_t sl_icm42688p_accel_read_data(float accel[3])
 sl_status_t sl_icm42688p_gyro_read_data(float gyro[3])
 {
     uint8_t raw_data[6];
-    float gyro_res = ICM42688P_GYRO_SCALE_2000DPS; // Current resolution
-    int16_t temp;
+    sl_icm42688p_convert_f32_t params;
+    sl_status_t status;
 
     /* Read the six raw data registers into the data array */
-    sl_icm42688p_read_register(ICM42688P_REG_GYRO_DATA_X1, raw_data, 6);
-
-    /* Convert the MSB and LSB into a signed 16-bit value and multiply by the resolution to get the dps value */
-    temp = ((int16_t)raw_data[0] << 8) | raw_data[1];
-    gyro[0] = (float)temp * gyro_res;
-
-    temp = ((int16_t)raw_data[2] << 8) | raw_data[3];
-    gyro[1] = (float)temp * gyro_res;
+    status = sl_icm42688p_read_register(ICM42688P_REG_GYRO_DATA_X1, raw_data, 6);
+    if (status != SL_STATUS_OK) {
+        return status;
+    }
 
-    temp = ((int16_t)raw_data[4] << 8) | raw_data[5];
-    gyro[2] = (float)temp * gyro_res;
+    /* Big-endian triplet to dps with the current resolution */
+    sl_icm42688p_convert_f32_init(&params, sample_scale.gyro, NULL);
+    sl_icm42688p_convert_f32(raw_data, sizeof(raw_data), 1, &params, gyro);
 
     return SL_STATUS_OK;
 }
@@ -366,252 +886,1941 @@ sl_status_t sl_icm42688p_read_temperature(float *temperature)
 {
   uint8_t raw[2] = {0};
   int16_t tmp = 0;
+  sl_status_t status;
 
   if (!temperature) {
       return SL_STATUS_INVALID_PARAMETER;
   }
 
-  sl_icm42688p_read_register(ICM42688P_REG_TEMP_DATA1, raw, 2);
+  status = sl_icm42688p_read_register(ICM42688P_REG_TEMP_DATA1, raw, 2);
+  if (status != SL_STATUS_OK) {
+      return status;
+  }
   tmp = (int16_t)((raw[0] << 8) | raw[1]);
 
   *temperature = ((float)tmp / ICM42688P_TEMP_SENSITIVITY) + ICM42688P_TEMP_OFFSET;
   return SL_STATUS_OK;
 }
 
-sl_status_t sl_icm42688p_get_device_id(uint8_t *dev_id)
+sl_status_t sl_icm42688p_read_sample(sl_icm42688p_sample_t *sample)
 {
-  sl_icm42688p_read_register(ICM42688P_REG_WHO_AM_I, dev_id, 1);
+  sl_icm42688p_raw_sample_t raw;
+  sl_status_t status;
+
+  if (!sample) {
+      return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  status = sl_icm42688p_read_raw_sample(&raw);
+  if (status != SL_STATUS_OK) {
+      return status;
+  }
+
+  sl_icm42688p_convert_samples(&raw, 1, &sample_scale, sample);
   return SL_STATUS_OK;
 }
 
-bool sl_icm42688p_is_data_ready(void)
+sl_status_t sl_icm42688p_read_raw_sample(sl_icm42688p_raw_sample_t *raw)
 {
-  uint8_t s = 0;
-  sl_icm42688p_read_register(ICM42688P_REG_INT_STATUS0, &s, 1);
-  return (s & ICM42688P_INT_STATUS0_DATA_RDY) != 0;
-}
+  uint8_t buf[ICM42688P_SAMPLE_BURST_LEN];
+  sl_status_t status;
 
-sl_status_t sl_icm42688p_accel_set_bandwidth(uint8_t odr_code)
-{
-    uint8_t reg;
-    sl_icm42688p_read_register(ICM42688P_REG_ACCEL_CONFIG0, &reg, 1);
-    reg = (reg & ~ICM42688P_ACCEL_ODR_MASK) | (odr_code & ICM42688P_ACCEL_ODR_MASK);
-    sl_icm42688p_write_register(ICM42688P_REG_ACCEL_CONFIG0, reg);
-    return SL_STATUS_OK;
-}
+  if (!raw) {
+      return SL_STATUS_INVALID_PARAMETER;
+  }
 
+  /* TEMP_DATA1..GYRO_DATA_Z0 in one chip-select session. INT_STATUS0 (0x2D)
+     sits after the data block, so reading it in the same burst would latch
+     the status after the data and race a new DRDY; callers poll it first. */
+  status = sl_icm42688p_read_register(ICM42688P_REG_TEMP_DATA1, buf, sizeof(buf));
+  if (status != SL_STATUS_OK) {
+      return status;
+  }
 
-sl_status_t sl_icm42688p_gyro_set_bandwidth(uint8_t odr_code)
+  sl_icm42688p_raw_from_be(buf, raw);
+  return SL_STATUS_OK;
+}
+
+const sl_icm42688p_scale_t *sl_icm42688p_get_scale(void)
 {
-    uint8_t reg;
-    sl_icm42688p_read_register(ICM42688P_REG_GYRO_CONFIG0, &reg, 1);
-    reg = (reg & ~ICM42688P_GYRO_ODR_MASK) | (odr_code & ICM42688P_GYRO_ODR_MASK);
-    sl_icm42688p_write_register(ICM42688P_REG_GYRO_CONFIG0, reg);
-    return SL_STATUS_OK;
+  return &sample_scale;
 }
 
-sl_status_t sl_icm42688p_read_interrupt_status(uint32_t *status)
+/* Packet 4 is 20-bit at a fixed full scale; packets 1-3 follow FS_SEL */
+const sl_icm42688p_scale_t *sl_icm42688p_get_fifo_scale(void)
 {
-    uint8_t reg[2] = {0};
+  static sl_icm42688p_scale_t hires_scale;
 
-    if (!status) return SL_STATUS_INVALID_PARAMETER;
+  if (fifo_packet_size == SL_ICM42688P_FIFO_PACKET4_SIZE) {
+    sl_icm42688p_scale_hires(&hires_scale);
+    return &hires_scale;
+  }
+  return &sample_scale;
+}
 
-    sl_icm42688p_read_register(ICM42688P_REG_INT_STATUS0, reg, 2);
+/* ----- FIFO streaming ----- */
+sl_status_t sl_icm42688p_fifo_enable(sl_icm42688p_fifo_packet_t packet)
+{
+  uint8_t cfg1 = ICM42688P_FIFO_CONFIG1_TEMP_EN;
+
+  switch (packet) {
+    case SL_ICM42688P_FIFO_PACKET_ACCEL:
+      cfg1 |= ICM42688P_FIFO_CONFIG1_ACCEL_EN;
+      break;
+    case SL_ICM42688P_FIFO_PACKET_GYRO:
+      cfg1 |= ICM42688P_FIFO_CONFIG1_GYRO_EN;
+      break;
+    case SL_ICM42688P_FIFO_PACKET_ACCEL_GYRO:
+      cfg1 |= ICM42688P_FIFO_CONFIG1_ACCEL_EN | ICM42688P_FIFO_CONFIG1_GYRO_EN
+              | ICM42688P_FIFO_CONFIG1_TMST_FSYNC_EN;
+      break;
+    case SL_ICM42688P_FIFO_PACKET_HIRES:
+      cfg1 |= ICM42688P_FIFO_CONFIG1_ACCEL_EN | ICM42688P_FIFO_CONFIG1_GYRO_EN
+              | ICM42688P_FIFO_CONFIG1_TMST_FSYNC_EN | ICM42688P_FIFO_CONFIG1_HIRES_EN;
+      break;
+    default:
+      return SL_STATUS_INVALID_PARAMETER;
+  }
 
-    *status = (uint32_t) reg[0] | ((uint32_t) reg[1] << 8);
+  sl_status_t status = sl_icm42688p_write_register(ICM42688P_REG_FIFO_CONFIG1, cfg1);
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_write_register(ICM42688P_REG_FIFO_CONFIG, ICM42688P_FIFO_CONFIG_MODE_STREAM);
+  }
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  fifo_packet_size = (uint16_t)sl_icm42688p_fifo_packet_type_size(packet);
 
-    return SL_STATUS_OK;
+  return sl_icm42688p_fifo_flush();
 }
 
+sl_status_t sl_icm42688p_fifo_disable(void)
+{
+  sl_status_t status = sl_icm42688p_write_register(ICM42688P_REG_FIFO_CONFIG, ICM42688P_FIFO_CONFIG_MODE_BYPASS);
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_write_register(ICM42688P_REG_FIFO_CONFIG1, 0x00U);
+  }
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  fifo_packet_size = 0;
+  return SL_STATUS_OK;
+}
 
+sl_status_t sl_icm42688p_fifo_flush(void)
+{
+  return sl_icm42688p_write_register(ICM42688P_REG_SIGNAL_PATH_RESET, ICM42688P_SIGNAL_PATH_RESET_FIFO_FLUSH);
+}
 
-sl_status_t sl_icm42688p_calibrate_gyro(float bias[3])
+sl_status_t sl_icm42688p_fifo_get_count(uint16_t *fifo_count)
 {
-    if (!bias) return SL_STATUS_INVALID_PARAMETER;
+  uint8_t raw[2];
 
-    const int samples = 500;  // Number of samples for calibration
-    float sum[3] = {0.0f, 0.0f, 0.0f};
-    float gvec[3];
+  if (!fifo_count) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
 
-    for (int i = 0; i < samples; i++) {
-        sl_icm42688p_gyro_read_data(gvec);  // Read raw gyro
-        sum[0] += gvec[0];
-        sum[1] += gvec[1];
-        sum[2] += gvec[2];
-        sl_sleeptimer_delay_millisecond(2);
-    }
+  sl_status_t status = sl_icm42688p_read_register(ICM42688P_REG_FIFO_COUNTH, raw, 2);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  *fifo_count = (uint16_t)sl_icm42688p_be16(raw);
+  return SL_STATUS_OK;
+}
 
-    bias[0] = sum[0] / samples;
-    bias[1] = sum[1] / samples;
-    bias[2] = sum[2] / samples;
+sl_status_t sl_icm42688p_fifo_read(uint8_t *buf, uint16_t len, uint16_t *fifo_count)
+{
+  uint8_t raw[2];
 
-    return SL_STATUS_OK;
-}
+  if (!buf || !fifo_count) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  if (fifo_packet_size == 0) {
+    return SL_STATUS_INVALID_STATE;
+  }
 
+  /* A partially read packet is discarded by the sensor: whole packets only */
+  len = (uint16_t)(len - (len % fifo_packet_size));
+
+  /* FIFO_COUNTH, FIFO_COUNTL, then FIFO_DATA, which does not auto-increment:
+     the count and the first packets come out of one chip-select session.
+     Bytes past the count read back as empty-FIFO headers and stop the parser.
+     Sessions stay within SPI_DMA_SESSION_MAX so auto CS can run them over
+     LDMA; each one ends on a packet boundary. */
+  uint16_t chunk = (uint16_t)(SL_ICM42688P_FIFO_READ_CHUNK - (SL_ICM42688P_FIFO_READ_CHUNK % fifo_packet_size));
+  if (chunk == 0) {
+    chunk = fifo_packet_size;
+  }
+  uint16_t n = (len < chunk) ? len : chunk;
+  sl_status_t status = sl_icm42688p_spi_read(ICM42688P_REG_FIFO_COUNTH, raw, 2, buf, n);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  *fifo_count = (uint16_t)sl_icm42688p_be16(raw);
 
-sl_status_t sl_icm42688p_accel_get_resolution(float *accel_res)
+  for (uint16_t done = n; status == SL_STATUS_OK && done < len; done = (uint16_t)(done + n)) {
+    n = ((uint16_t)(len - done) < chunk) ? (uint16_t)(len - done) : chunk;
+    status = sl_icm42688p_spi_read(ICM42688P_REG_FIFO_DATA, NULL, 0, &buf[done], n);
+  }
+
+  return status;
+}
+
+sl_status_t sl_icm42688p_fifo_read_samples(sl_icm42688p_fifo_sample_t *samples, uint16_t max_samples, uint16_t *count)
 {
-    if (accel_res == NULL) {
-        return SL_STATUS_INVALID_PARAMETER;
+  uint8_t buf[SL_ICM42688P_FIFO_READ_CHUNK];
+  uint16_t n = 0;
+
+  if (!samples || !count) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  if (fifo_packet_size == 0) {
+    return SL_STATUS_INVALID_STATE;
+  }
+
+  while (n < max_samples) {
+    uint16_t level = 0;
+    uint16_t want = (uint16_t)((max_samples - n) * fifo_packet_size);
+
+    if (want > sizeof(buf)) {
+      want = sizeof(buf);
     }
 
-    uint8_t fs_code = 0;
-    sl_status_t status = sl_icm42688p_read_register(ICM42688P_REG_ACCEL_CONFIG0, &fs_code, 1);
+    sl_status_t status = sl_icm42688p_fifo_read(buf, want, &level);
     if (status != SL_STATUS_OK) {
-        return status;
+      *count = n;
+      return status;
     }
+    /* Packets queued after FIFO_COUNT latched are popped by the same burst:
+       parse all of it and let the empty-FIFO header end the parse */
+    n += (uint16_t)sl_icm42688p_fifo_parse(buf, want, &samples[n], max_samples - n, NULL);
 
-    fs_code = (fs_code & ICM42688P_ACCEL_CONFIG0_MASK_FS_SEL) >> ICM42688P_ACCEL_CONFIG0_SHIFT_FS_SEL;
-
-    switch (fs_code) {
-        case 0:
-            *accel_res = ICM42688P_ACCEL_SCALE_2G;
-            break;
-        case 1:
-            *accel_res = ICM42688P_ACCEL_SCALE_4G;
-            break;
-        case 2:
-            *accel_res = ICM42688P_ACCEL_SCALE_8G;
-            break;
-        case 3:
-            *accel_res = ICM42688P_ACCEL_SCALE_16G;
-            break;
-        default:
-            *accel_res = ICM42688P_ACCEL_SCALE_16G;
-            break;
+    /* Drained: everything that was queued fit in this burst */
+    if (level <= want) {
+      break;
     }
+  }
 
-    return SL_STATUS_OK;
+  *count = n;
+  return SL_STATUS_OK;
 }
 
-sl_status_t sl_icm42688p_gyro_get_resolution(float *gyro_res)
+sl_status_t sl_icm42688p_get_device_id(uint8_t *dev_id)
 {
-    if (gyro_res == NULL) {
+  if (!dev_id) {
+    return SL_STATUS_NULL_POINTER;
+  }
+  return sl_icm42688p_read_register(ICM42688P_REG_WHO_AM_I, dev_id, 1);
+}
+
+bool sl_icm42688p_is_data_ready(void)
+{
+  uint8_t s = 0;
+  if (sl_icm42688p_read_register(ICM42688P_REG_INT_STATUS0, &s, 1) != SL_STATUS_OK) {
+    return false;
+  }
+  return (s & ICM42688P_INT_STATUS0_DATA_RDY) != 0;
+}
+
+sl_status_t sl_icm42688p_accel_set_bandwidth(uint8_t odr_code)
+{
+    if (!sl_icm42688p_odr_info(odr_code)) {
         return SL_STATUS_INVALID_PARAMETER;
     }
+    return sl_icm42688p_masked_write(ICM42688P_REG_ACCEL_CONFIG0, odr_code, ICM42688P_ACCEL_ODR_MASK);
+}
 
-    uint8_t fs_code = 0;
-    sl_status_t status = sl_icm42688p_read_register(ICM42688P_REG_GYRO_CONFIG0, &fs_code, 1);
-    if (status != SL_STATUS_OK) {
-        return status;
-    }
 
-    fs_code = (fs_code & ICM42688P_GYRO_CONFIG0_MASK_FS_SEL) >> ICM42688P_GYRO_CONFIG0_SHIFT_FS_SEL;
-
-    switch (fs_code) {
-        case 0:
-          *gyro_res = ICM42688P_GYRO_SCALE_2000DPS;
-          break;
-        case 1:
-          *gyro_res = ICM42688P_GYRO_SCALE_1000DPS;
-          break;
-        case 2:
-          *gyro_res = ICM42688P_GYRO_SCALE_500DPS;
-          break;
-        case 3:
-          *gyro_res = ICM42688P_GYRO_SCALE_250DPS;
-          break;
-        case 4:
-          *gyro_res = ICM42688P_GYRO_SCALE_125DPS;
-          break;
-        case 5:
-          *gyro_res = ICM42688P_GYRO_SCALE_62_5DPS;
-          break;
-        case 6:
-          *gyro_res = ICM42688P_GYRO_SCALE_31_25DPS;
-          break;
-        case 7:
-          *gyro_res = ICM42688P_GYRO_SCALE_15_625DPS;
-          break;
-        default:
-          *gyro_res = ICM42688P_GYRO_SCALE_2000DPS;
-          break;
+sl_status_t sl_icm42688p_gyro_set_bandwidth(uint8_t odr_code)
+{
+    const sl_icm42688p_odr_info_t *odr = sl_icm42688p_odr_info(odr_code);
+
+    if (!odr || !(odr->modes & SL_ICM42688P_ODR_GYRO)) {
+        return SL_STATUS_INVALID_PARAMETER;
     }
+    return sl_icm42688p_masked_write(ICM42688P_REG_GYRO_CONFIG0, odr_code, ICM42688P_GYRO_ODR_MASK);
+}
+
+/* ----- On-sensor filters ----- */
+sl_status_t sl_icm42688p_set_filters(sl_icm42688p_filter_config_t *config)
+{
+  uint8_t accel_cfg = 0;
+  uint8_t gyro_cfg = 0;
+  const sl_icm42688p_odr_info_t *accel_odr;
+  const sl_icm42688p_odr_info_t *gyro_odr;
+  sl_icm42688p_filter_regs_t regs;
+  sl_status_t status;
+
+  if (!config) {
+    return SL_STATUS_NULL_POINTER;
+  }
+  /* Banks 1 and 2 are selected in between: no sample read may interleave */
+  if (drdy_enabled || drain_enabled) {
+    return SL_STATUS_INVALID_STATE;
+  }
+
+  /* UI filter bandwidths scale with the ODR in use */
+  status = sl_icm42688p_read_register(ICM42688P_REG_ACCEL_CONFIG0, &accel_cfg, 1);
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_read_register(ICM42688P_REG_GYRO_CONFIG0, &gyro_cfg, 1);
+  }
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  accel_odr = sl_icm42688p_odr_info(accel_cfg & ICM42688P_ACCEL_ODR_MASK);
+  gyro_odr = sl_icm42688p_odr_info(gyro_cfg & ICM42688P_GYRO_ODR_MASK);
+  if (!accel_odr || !gyro_odr
+      || !sl_icm42688p_filter_encode(config, accel_odr->period_ns, gyro_odr->period_ns, &regs)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  /* Bank 0: UI filter order and bandwidth */
+  status = sl_icm42688p_masked_write(ICM42688P_REG_GYRO_CONFIG1,
+                                     (uint8_t)(regs.gyro_ui_ord << ICM42688P_GYRO_CONFIG1_SHIFT_UI_FILT_ORD),
+                                     ICM42688P_GYRO_CONFIG1_MASK_UI_FILT_ORD);
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_masked_write(ICM42688P_REG_ACCEL_CONFIG1,
+                                       (uint8_t)(regs.accel_ui_ord << ICM42688P_ACCEL_CONFIG1_SHIFT_UI_FILT_ORD),
+                                       ICM42688P_ACCEL_CONFIG1_MASK_UI_FILT_ORD);
+  }
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_masked_write(ICM42688P_REG_GYRO_ACCEL_CONFIG0,
+                                       (uint8_t)((regs.accel_ui_bw << ICM42688P_GYRO_ACCEL_CONFIG0_SHIFT_ACCEL_BW)
+                                                 | (regs.gyro_ui_bw << ICM42688P_GYRO_ACCEL_CONFIG0_SHIFT_GYRO_BW)),
+                                       0xFFU);
+  }
+
+  /* Bank 1: gyro AAF and notch */
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_set_bank(ICM42688P_BANK_1);
+  }
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_masked_write(ICM42688P_REG_GYRO_CONFIG_STATIC3, regs.gyro_aaf_delt,
+                                       ICM42688P_GYRO_CONFIG_STATIC3_MASK_AAF_DELT);
+  }
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_masked_write(ICM42688P_REG_GYRO_CONFIG_STATIC4, (uint8_t)(regs.gyro_aaf_deltsqr & 0xFFU), 0xFFU);
+  }
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_masked_write(ICM42688P_REG_GYRO_CONFIG_STATIC5,
+                                       (uint8_t)((regs.gyro_aaf_bitshift << ICM42688P_AAF_SHIFT_BITSHIFT)
+                                                 | (regs.gyro_aaf_deltsqr >> 8)),
+                                       0xFFU);
+  }
+  for (uint8_t axis = 0; axis < 3U && status == SL_STATUS_OK; ++axis) {
+    status = sl_icm42688p_masked_write((uint8_t)(ICM42688P_REG_GYRO_CONFIG_STATIC6 + axis),
+                                       (uint8_t)(regs.nf_coswz[axis] & 0xFFU), 0xFFU);
+  }
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_masked_write(ICM42688P_REG_GYRO_CONFIG_STATIC9,
+                                       (uint8_t)((regs.nf_coswz_sel << ICM42688P_GYRO_CONFIG_STATIC9_SHIFT_COSWZ_SEL)
+                                                 | ((regs.nf_coswz[0] >> 8) & 1U)
+                                                 | (((regs.nf_coswz[1] >> 8) & 1U) << 1)
+                                                 | (((regs.nf_coswz[2] >> 8) & 1U) << 2)),
+                                       ICM42688P_GYRO_CONFIG_STATIC9_MASK_NF);
+  }
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_masked_write(ICM42688P_REG_GYRO_CONFIG_STATIC10,
+                                       (uint8_t)(regs.nf_bw_sel << ICM42688P_GYRO_CONFIG_STATIC10_SHIFT_NF_BW),
+                                       ICM42688P_GYRO_CONFIG_STATIC10_MASK_NF_BW);
+  }
+  /* Enables last, once the coefficients are in */
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_masked_write(ICM42688P_REG_GYRO_CONFIG_STATIC2,
+                                       (uint8_t)((regs.gyro_aaf_dis ? ICM42688P_GYRO_CONFIG_STATIC2_AAF_DIS : 0U)
+                                                 | (regs.nf_dis ? ICM42688P_GYRO_CONFIG_STATIC2_NF_DIS : 0U)),
+                                       ICM42688P_GYRO_CONFIG_STATIC2_AAF_DIS | ICM42688P_GYRO_CONFIG_STATIC2_NF_DIS);
+  }
+
+  /* Bank 2: accel AAF */
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_set_bank(ICM42688P_BANK_2);
+  }
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_masked_write(ICM42688P_REG_ACCEL_CONFIG_STATIC3, (uint8_t)(regs.accel_aaf_deltsqr & 0xFFU), 0xFFU);
+  }
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_masked_write(ICM42688P_REG_ACCEL_CONFIG_STATIC4,
+                                       (uint8_t)((regs.accel_aaf_bitshift << ICM42688P_AAF_SHIFT_BITSHIFT)
+                                                 | (regs.accel_aaf_deltsqr >> 8)),
+                                       0xFFU);
+  }
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_masked_write(ICM42688P_REG_ACCEL_CONFIG_STATIC2,
+                                       (uint8_t)((regs.accel_aaf_delt << ICM42688P_ACCEL_CONFIG_STATIC2_SHIFT_AAF_DELT)
+                                                 | (regs.accel_aaf_dis ? ICM42688P_ACCEL_CONFIG_STATIC2_AAF_DIS : 0U)),
+                                       0x7FU);
+  }
+
+  /* Everything else in the driver expects bank 0 */
+  if (status != SL_STATUS_OK) {
+    sl_icm42688p_invalidate_shadow();
+  }
+  sl_icm42688p_set_bank(ICM42688P_BANK_0);
+
+  return status;
+}
+
+/* ----- User offsets ----- */
+sl_status_t sl_icm42688p_set_user_offsets(const float gyro_bias[3], const float accel_bias[3])
+{
+  uint8_t regs[ICM42688P_OFFSET_USER_LEN];
+  uint8_t readback[ICM42688P_OFFSET_USER_LEN];
+  sl_status_t status;
+
+  /* Bank 4 is selected in between: no sample read may interleave */
+  if (drdy_enabled || drain_enabled) {
+    return SL_STATUS_INVALID_STATE;
+  }
+  if (!sl_icm42688p_calib_offsets_encode(gyro_bias, accel_bias, regs)) {
+    return SL_STATUS_INVALID_RANGE;
+  }
+
+  status = sl_icm42688p_set_bank(ICM42688P_BANK_4);
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_write_registers(ICM42688P_REG_OFFSET_USER0, regs, sizeof(regs));
+  }
+  /* A burst read goes to the bus, not the shadow */
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_read_register(ICM42688P_REG_OFFSET_USER0, readback, sizeof(readback));
+  }
+  if (status == SL_STATUS_OK && memcmp(regs, readback, sizeof(regs)) != 0) {
+    status = SL_STATUS_FAIL;
+  }
+
+  if (status != SL_STATUS_OK) {
+    sl_icm42688p_invalidate_shadow();
+  }
+  sl_icm42688p_set_bank(ICM42688P_BANK_0);
+
+  return status;
+}
+
+sl_status_t sl_icm42688p_get_user_offsets(float gyro_bias[3], float accel_bias[3])
+{
+  uint8_t regs[ICM42688P_OFFSET_USER_LEN];
+  sl_status_t status;
+
+  if (drdy_enabled || drain_enabled) {
+    return SL_STATUS_INVALID_STATE;
+  }
+
+  status = sl_icm42688p_set_bank(ICM42688P_BANK_4);
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_read_register(ICM42688P_REG_OFFSET_USER0, regs, sizeof(regs));
+  }
+  if (status != SL_STATUS_OK) {
+    sl_icm42688p_invalidate_shadow();
+  }
+  sl_icm42688p_set_bank(ICM42688P_BANK_0);
+
+  if (status == SL_STATUS_OK) {
+    sl_icm42688p_calib_offsets_decode(regs, gyro_bias, accel_bias);
+  }
+  return status;
+}
+
+/* ----- External FSYNC ----- */
+sl_status_t sl_icm42688p_set_fsync(bool enable, bool falling_edge)
+{
+  uint8_t pin9 = enable ? ICM42688P_PIN9_FUNCTION_FSYNC : ICM42688P_PIN9_FUNCTION_INT2;
+  uint8_t fsync_cfg = 0;
+  sl_status_t status;
+
+  /* FSYNC comes in on pin 9, which is INT2 otherwise */
+  if (enable && SL_ICM42688P_INT_SENSOR_PIN == SL_ICM42688P_INT2) {
+    return SL_STATUS_NOT_SUPPORTED;
+  }
+  /* Bank 1 is selected in between, and the DRDY burst length follows the
+     setting: no sample read may interleave */
+  if (drdy_enabled || drain_enabled) {
+    return SL_STATUS_INVALID_STATE;
+  }
+
+  /* The temperature LSB carries the tag, so no motion data is lost to it;
+     the tag clears with the next data update and marks a single sample */
+  if (enable) {
+    fsync_cfg = (uint8_t)((ICM42688P_FSYNC_UI_SEL_TEMP << ICM42688P_FSYNC_CONFIG_SHIFT_UI_SEL)
+                          | (falling_edge ? ICM42688P_FSYNC_CONFIG_POLARITY_FALLING : 0U));
+  }
+
+  status = sl_icm42688p_set_bank(ICM42688P_BANK_1);
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_masked_write(ICM42688P_REG_INTF_CONFIG5,
+                                       (uint8_t)(pin9 << ICM42688P_INTF_CONFIG5_SHIFT_PIN9),
+                                       ICM42688P_INTF_CONFIG5_MASK_PIN9);
+  }
+  if (status != SL_STATUS_OK) {
+    sl_icm42688p_invalidate_shadow();
+  }
+  sl_icm42688p_set_bank(ICM42688P_BANK_0);
+
+  /* TMST_FSYNC and the FIFO delta need the FSYNC timestamp latch */
+  if (status == SL_STATUS_OK && enable) {
+    status = sl_icm42688p_masked_write(ICM42688P_REG_TMST_CONFIG, ICM42688P_TMST_CONFIG_FSYNC_EN,
+                                       ICM42688P_TMST_CONFIG_FSYNC_EN);
+  }
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_masked_write(ICM42688P_REG_FSYNC_CONFIG, fsync_cfg,
+                                       ICM42688P_FSYNC_CONFIG_MASK_UI_SEL
+                                       | ICM42688P_FSYNC_CONFIG_FLAG_CLEAR_READ
+                                       | ICM42688P_FSYNC_CONFIG_POLARITY_FALLING);
+  }
+
+  return status;
+}
+
+bool sl_icm42688p_get_fsync(void)
+{
+  return fsync_ui_sel != ICM42688P_FSYNC_UI_SEL_OFF;
+}
+
+uint32_t sl_icm42688p_fsync_offset_q16(uint16_t delta)
+{
+  return sl_icm42688p_timestamp_interval_q16(&timestamp, delta);
+}
+
+sl_status_t sl_icm42688p_read_interrupt_status(uint32_t *status)
+{
+    uint8_t reg[2] = {0};
+
+    if (!status) return SL_STATUS_INVALID_PARAMETER;
+
+    sl_status_t result = sl_icm42688p_read_register(ICM42688P_REG_INT_STATUS0, reg, 2);
+    if (result != SL_STATUS_OK) return result;
+
+    *status = (uint32_t) reg[0] | ((uint32_t) reg[1] << 8);
 
     return SL_STATUS_OK;
 }
 
 
-sl_status_t sl_icm42688p_calibrate_accel_and_gyro(float accel_bias[3], float gyro_bias[3])
+
+sl_status_t sl_icm42688p_calibrate_gyro(float bias[3])
 {
-    if (!accel_bias || !gyro_bias) {
-        return SL_STATUS_INVALID_PARAMETER;
+    if (!bias) return SL_STATUS_INVALID_PARAMETER;
+
+    const int samples = SL_ICM42688P_GYRO_CAL_SAMPLES;  // Number of samples for calibration
+    float sum[3] = {0.0f, 0.0f, 0.0f};
+    float gvec[3];
+    sl_status_t status;
+
+    // Starts on the first valid sample, not after a fixed settling time
+    status = sl_icm42688p_wait_data_ready(SL_ICM42688P_STARTUP_TIMEOUT_MS);
+    if (status != SL_STATUS_OK) return status;
+
+    for (int i = 0; i < samples; i++) {
+        // Each new sample once, paced by DATA_RDY at the gyro ODR
+        status = sl_icm42688p_wait_status(ICM42688P_INT_STATUS0_DATA_RDY, SL_ICM42688P_STARTUP_TIMEOUT_MS);
+        if (status != SL_STATUS_OK) return status;
+
+        sl_icm42688p_gyro_read_data(gvec);  // Read raw gyro
+        sum[0] += gvec[0];
+        sum[1] += gvec[1];
+        sum[2] += gvec[2];
     }
 
-    const uint16_t samples = 500;
-    float accel_sum[3] = {0}, gyro_sum[3] = {0};
-    float accel_data[3], gyro_data[3];
+    bias[0] = sum[0] / samples;
+    bias[1] = sum[1] / samples;
+    bias[2] = sum[2] / samples;
 
-    // Ensure sensors are off before configuring
-    sl_icm42688p_enable_sensor(false, false, false);
+    sl_icm42688p_boot_mark(SL_ICM42688P_BOOT_CALIBRATED);
+    return SL_STATUS_OK;
+}
 
-    // Set full-scale ranges
-    sl_icm42688p_set_full_scale_accel(ICM42688P_ACCEL_CONFIG0_FS_2G >> ICM42688P_ACCEL_CONFIG0_SHIFT_FS_SEL);
-    sl_icm42688p_set_full_scale_gyro(ICM42688P_GYRO_CONFIG0_FS_250DPS >> ICM42688P_GYRO_CONFIG0_SHIFT_FS_SEL);
 
-    // Set sample rate to 1 kHz and bandwidth to 200 Hz
-    sl_icm42688p_set_sample_rate(1000.0f);
-    sl_icm42688p_accel_set_bandwidth(ICM42688P_ODR_CODE_200HZ);
-    sl_icm42688p_gyro_set_bandwidth(ICM42688P_ODR_CODE_200HZ);
+/* Calibration page, reached through MSC; reads go straight to the memory
+   map */
+static const sl_icm42688p_calib_flash_t calib_flash = {
+  .page_size = FLASH_PAGE_SIZE,
+  .read = sl_icm42688p_calib_flash_read,
+  .erase = sl_icm42688p_calib_flash_erase,
+  .write = sl_icm42688p_calib_flash_write,
+  .context = NULL,
+};
 
-    // Enable accelerometer and gyroscope (temperature optional)
-    sl_icm42688p_enable_sensor(true, true, true);
+sl_status_t sl_icm42688p_load_calibration(sl_icm42688p_calib_record_t *record,
+                                          sl_icm42688p_calib_result_t *result)
+{
+  sl_icm42688p_calib_result_t loaded = SL_ICM42688P_CALIB_MISSING;
+  sl_status_t status;
 
-    // Small delay for sensors to stabilize
-    sl_sleeptimer_delay_millisecond(50);
+  status = sl_icm42688p_calib_load(&calib_flash, record, &loaded);
+  if (status == SL_STATUS_OK && loaded == SL_ICM42688P_CALIB_OK) {
+    sl_icm42688p_boot_mark(SL_ICM42688P_BOOT_CALIB_LOADED);
+  }
+  if (result) {
+    *result = loaded;
+  }
+  return status;
+}
 
-    // Collect samples
-    for (uint16_t i = 0; i < samples; i++) {
-        sl_icm42688p_accel_read_data(accel_data);
-        sl_icm42688p_gyro_read_data(gyro_data);
+sl_status_t sl_icm42688p_store_calibration(sl_icm42688p_calib_record_t *record)
+{
+  return sl_icm42688p_calib_store(&calib_flash, record);
+}
 
-        accel_sum[0] += accel_data[0];
-        accel_sum[1] += accel_data[1];
-        accel_sum[2] += accel_data[2];
+/* Packets dropped after raising the ODR while the UI filter settles */
+#define GYRO_BIAS_SETTLE_PACKETS   16U
 
-        gyro_sum[0] += gyro_data[0];
-        gyro_sum[1] += gyro_data[1];
-        gyro_sum[2] += gyro_data[2];
+sl_status_t sl_icm42688p_measure_gyro_bias(uint16_t samples, sl_icm42688p_gyro_bias_t *bias)
+{
+  sl_icm42688p_fifo_sample_t chunk[SL_ICM42688P_FIFO_READ_CHUNK / SL_ICM42688P_FIFO_PACKET2_SIZE];
+  const sl_icm42688p_odr_info_t *odr;
+  uint8_t gyro_cfg = 0;
+  uint8_t fifo_cfg = 0;
+  uint8_t fifo_cfg1 = 0;
+  int64_t sum[3] = { 0, 0, 0 };
+  int64_t sum_sq[3] = { 0, 0, 0 };
+  uint16_t n = 0;
+  uint16_t skip = GYRO_BIAS_SETTLE_PACKETS;
+  uint32_t start;
+  uint32_t timeout;
+  sl_status_t status;
+
+  if (!bias || samples < 2U) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  /* The FIFO is borrowed and DRDY reads would see the raised ODR */
+  if (drdy_enabled || drain_enabled) {
+    return SL_STATUS_INVALID_STATE;
+  }
+
+  status = sl_icm42688p_read_register(ICM42688P_REG_GYRO_CONFIG0, &gyro_cfg, 1);
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_read_register(ICM42688P_REG_FIFO_CONFIG, &fifo_cfg, 1);
+  }
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_read_register(ICM42688P_REG_FIFO_CONFIG1, &fifo_cfg1, 1);
+  }
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  /* 8 kHz unless the gyro already runs faster: the window takes
+     samples / 8 ms instead of samples / ODR */
+  odr = sl_icm42688p_odr_info(gyro_cfg & ICM42688P_GYRO_ODR_MASK);
+  if (!odr || odr->period_ns > 125000U) {
+    status = sl_icm42688p_gyro_set_bandwidth(ICM42688P_GYRO_ODR_8KHZ);
+    odr = sl_icm42688p_odr_info(ICM42688P_GYRO_ODR_8KHZ);
+  } else {
+    status = SL_STATUS_OK;
+  }
+  if (status == SL_STATUS_OK) {
+    status = sl_icm42688p_fifo_enable(SL_ICM42688P_FIFO_PACKET_GYRO);
+  }
+
+  timeout = sl_sleeptimer_ms_to_tick((uint16_t)((((uint64_t)samples + skip) * odr->period_ns) / 1000000U
+                                                + SL_ICM42688P_STARTUP_TIMEOUT_MS));
+  start = sl_sleeptimer_get_tick_count();
+
+  while (status == SL_STATUS_OK && n < samples) {
+    uint16_t count = 0;
 
-        sl_sleeptimer_delay_millisecond(2);
+    status = sl_icm42688p_fifo_read_samples(chunk, sizeof(chunk) / sizeof(chunk[0]), &count);
+    if (status == SL_STATUS_OK && count == 0) {
+      sl_sleeptimer_delay_millisecond(1);
+    }
+    for (uint16_t i = 0; i < count && n < samples; ++i) {
+      if (!(chunk[i].flags & SL_ICM42688P_FIFO_SAMPLE_GYRO)
+          || chunk[i].gyro[0] == SL_ICM42688P_FIFO_INVALID_DATA) {
+        continue;
+      }
+      if (skip > 0) {
+        skip--;
+        continue;
+      }
+      for (uint8_t k = 0; k < 3U; ++k) {
+        sum[k] += chunk[i].gyro[k];
+        sum_sq[k] += (int64_t)chunk[i].gyro[k] * chunk[i].gyro[k];
+      }
+      n++;
     }
 
-    // Compute average
-    accel_bias[0] = accel_sum[0] / samples;
-    accel_bias[1] = accel_sum[1] / samples;
-    accel_bias[2] = accel_sum[2] / samples;
+    if (status == SL_STATUS_OK && n < samples
+        && (uint32_t)(sl_sleeptimer_get_tick_count() - start) > timeout) {
+      status = SL_STATUS_TIMEOUT;
+    }
+  }
+  bias->ticks = sl_sleeptimer_get_tick_count() - start;
 
-    gyro_bias[0] = gyro_sum[0] / samples;
-    gyro_bias[1] = gyro_sum[1] / samples;
-    gyro_bias[2] = gyro_sum[2] / samples;
+  /* Back to the caller's FIFO format and ODR; what the FIFO held is lost */
+  sl_icm42688p_write_register(ICM42688P_REG_FIFO_CONFIG1, fifo_cfg1);
+  sl_icm42688p_write_register(ICM42688P_REG_FIFO_CONFIG, fifo_cfg);
+  sl_icm42688p_masked_write(ICM42688P_REG_GYRO_CONFIG0, gyro_cfg, ICM42688P_GYRO_ODR_MASK);
+  sl_icm42688p_fifo_sync();
+  sl_icm42688p_fifo_flush();
 
-    // Correct Z-axis for 1g offset
-    if (accel_bias[2] > 0.0f) {
-        accel_bias[2] -= ICM42688P_ACCEL_SCALE_2G;
-    } else {
-        accel_bias[2] += ICM42688P_ACCEL_SCALE_2G;
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  /* Integer sums: exact for any window the uint16_t count allows */
+  for (uint8_t k = 0; k < 3U; ++k) {
+    int64_t spread = (int64_t)n * sum_sq[k] - sum[k] * sum[k];
+
+    bias->mean[k] = ((float)sum[k] / (float)n) * sample_scale.gyro;
+    bias->variance[k] = ((float)spread / ((float)n * (float)(n - 1U))) * sample_scale.gyro * sample_scale.gyro;
+  }
+  bias->noise_variance = odr->gyro_noise_var;
+  bias->samples = n;
+
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_icm42688p_accel_get_resolution(float *accel_res)
+{
+    if (accel_res == NULL) {
+        return SL_STATUS_INVALID_PARAMETER;
     }
 
-    // Disable sensors after calibration
-    sl_icm42688p_enable_sensor(false, false, false);
+    *accel_res = sample_scale.accel;
+    return SL_STATUS_OK;
+}
+
+sl_status_t sl_icm42688p_gyro_get_resolution(float *gyro_res)
+{
+    if (gyro_res == NULL) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
 
+    *gyro_res = sample_scale.gyro;
     return SL_STATUS_OK;
 }
 
 
-/* ----- Helpers ----- */
-static void sl_icm42688p_chip_select_set(bool select)
+/* ----- FIFO watermark interrupt and drain ----- */
+sl_status_t sl_icm42688p_fifo_set_watermark(uint16_t bytes)
 {
-  sl_gpio_t cs_pin = {
-    .port = SL_ICM42688P_SPI_EUSART_CS_PORT,
-    .pin  = SL_ICM42688P_SPI_EUSART_CS_PIN
-  };
+  if (bytes > 0x0FFFU) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
 
-  if (select) {
-    sl_gpio_clear_pin(&cs_pin);
+  sl_icm42688p_write_register(ICM42688P_REG_FIFO_CONFIG2, (uint8_t)(bytes & 0xFFU));
+  sl_icm42688p_write_register(ICM42688P_REG_FIFO_CONFIG3, (uint8_t)((bytes >> 8) & 0x0FU));
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_icm42688p_enable_fifo_interrupt(sl_icm42688p_int_pin_t pin, bool watermark, bool full)
+{
+  uint8_t reg;
+  uint8_t ths_en;
+  uint8_t full_en;
+  uint8_t cfg;
+
+  if (pin == SL_ICM42688P_INT1) {
+    reg = ICM42688P_REG_INT_SOURCE0;
+    ths_en = ICM42688P_INT_SOURCE0_FIFO_THS_INT1_EN;
+    full_en = ICM42688P_INT_SOURCE0_FIFO_FULL_INT1_EN;
+    cfg = ICM42688P_INT1_POLARITY | ICM42688P_INT1_DRIVE_CIRCUIT;
+  } else if (pin == SL_ICM42688P_INT2) {
+    reg = ICM42688P_REG_INT_SOURCE3;
+    ths_en = ICM42688P_INT_SOURCE3_FIFO_THS_INT2_EN;
+    full_en = ICM42688P_INT_SOURCE3_FIFO_FULL_INT2_EN;
+    cfg = ICM42688P_INT2_POLARITY | ICM42688P_INT2_DRIVE_CIRCUIT;
   } else {
-    sl_gpio_set_pin(&cs_pin);
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  /* Active-high, push-pull, pulsed, as for DRDY in sl_icm42688p_enable_interrupt() */
+  sl_icm42688p_masked_write(ICM42688P_REG_INT_CONFIG, cfg, cfg | ICM42688P_INT1_MODE | ICM42688P_INT2_MODE);
+
+  /* Short pulses without de-assert hold-off keep up with multi-kHz ODRs,
+     and INT_ASYNC_RESET must be cleared for the pins to behave */
+  sl_icm42688p_write_register(ICM42688P_REG_INT_CONFIG1,
+                              ICM42688P_INT_CONFIG1_TPULSE_DURATION | ICM42688P_INT_CONFIG1_TDEASSERT_DISABLE);
+
+  sl_icm42688p_masked_write(reg,
+                            (uint8_t)((watermark ? ths_en : 0U) | (full ? full_en : 0U)),
+                            (uint8_t)(ths_en | full_en));
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_icm42688p_fifo_drain_start(uint16_t packets, sl_icm42688p_fifo_block_callback_t callback, void *context)
+{
+  Ecode_t ecode;
+
+  if (packets == 0 || packets > SL_ICM42688P_FIFO_DRAIN_PACKETS || !callback) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  if (fifo_packet_size == 0 || drain_enabled) {
+    return SL_STATUS_INVALID_STATE;
+  }
+  if (!dma_ready) {
+    return SL_STATUS_NOT_INITIALIZED;
   }
+  if (sl_icm42688p_bus_busy()) {
+    return SL_STATUS_BUSY;
+  }
+
+  drain_bytes = (uint16_t)(packets * fifo_packet_size);
+  drain_callback = callback;
+  drain_context = context;
+  memset(&drain_stats, 0, sizeof(drain_stats));
+  sl_icm42688p_timestamp_restart();
+
+  sl_icm42688p_fifo_set_watermark(drain_bytes);
+  sl_icm42688p_enable_fifo_interrupt(SL_ICM42688P_INT_SENSOR_PIN, true, false);
+
+  /* RX stays armed in ping-pong mode for the whole session; each drain burst
+     fills the other block and is started by sl_icm42688p_drain_kick() */
+  ecode = DMADRV_PeripheralMemoryPingPong(dma_rx_channel, SL_ICM42688P_SPI_DMA_RX_SIGNAL,
+                                          drain_block[0], drain_block[1],
+                                          (void *)&SL_ICM42688P_SPI_EUSART_PERIPHERAL->RXDATA,
+                                          true, DRAIN_HEADER_LEN + drain_bytes, dmadrvDataSize1,
+                                          sl_icm42688p_drain_done, NULL);
+  if (ecode != ECODE_EMDRV_DMADRV_OK) {
+    sl_icm42688p_enable_fifo_interrupt(SL_ICM42688P_INT_SENSOR_PIN, false, false);
+    return SL_STATUS_FAIL;
+  }
+
+  sl_icm42688p_fifo_flush();
+  drain_in_flight = false;
+  drain_enabled = true;
+
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_icm42688p_fifo_drain_stop(void)
+{
+  if (!drain_enabled) {
+    return SL_STATUS_OK;
+  }
+
+  NVIC_DisableIRQ(LDMA_IRQn);
+  drain_enabled = false;
+  DMADRV_StopTransfer(dma_tx_channel);
+  DMADRV_StopTransfer(dma_rx_channel);
+  if (drain_in_flight) {
+    sl_icm42688p_chip_select_set(false);
+    drain_in_flight = false;
+  }
+  NVIC_EnableIRQ(LDMA_IRQn);
+
+  sl_icm42688p_enable_fifo_interrupt(SL_ICM42688P_INT_SENSOR_PIN, false, false);
+
+  /* A burst cut short leaves a partial packet behind */
+  return sl_icm42688p_fifo_flush();
+}
+
+void sl_icm42688p_get_fifo_drain_stats(sl_icm42688p_fifo_drain_stats_t *stats)
+{
+  if (stats) {
+    *stats = drain_stats;
+  }
+}
+
+/* ----- Data-ready acquisition ----- */
+sl_status_t sl_icm42688p_drdy_start(sl_icm42688p_drdy_callback_t callback, void *context)
+{
+  sl_status_t status;
+
+  if (!callback) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  if (drain_enabled || drdy_enabled) {
+    return SL_STATUS_INVALID_STATE;
+  }
+  if (!dma_ready) {
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+
+  status = sl_icm42688p_masked_write(ICM42688P_REG_INT_SOURCE0,
+                                     ICM42688P_INT_SOURCE0_UI_DRDY_INT1_EN,
+                                     ICM42688P_INT_SOURCE0_UI_DRDY_INT1_EN);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  drdy_callback = callback;
+  drdy_context = context;
+  memset(&drdy_stats, 0, sizeof(drdy_stats));
+  drdy_prev_valid = false;
+  /* With tagging on, the burst runs on into TMST_FSYNCH/L */
+  drdy_len = (uint16_t)(1U + ((fsync_ui_sel != ICM42688P_FSYNC_UI_SEL_OFF)
+                              ? ICM42688P_SAMPLE_FSYNC_BURST_LEN : ICM42688P_SAMPLE_BURST_LEN));
+  sl_icm42688p_timestamp_restart();
+  drdy_in_flight = false;
+  drdy_pending = false;
+  drdy_enabled = true;
+
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_icm42688p_drdy_stop(void)
+{
+  if (!drdy_enabled) {
+    return SL_STATUS_OK;
+  }
+
+  drdy_enabled = false;
+  drdy_pending = false;
+
+  /* Let a read already on the bus finish; its callback is still delivered */
+  while (drdy_in_flight) {
+  }
+
+  return sl_icm42688p_masked_write(ICM42688P_REG_INT_SOURCE0, 0,
+                                   ICM42688P_INT_SOURCE0_UI_DRDY_INT1_EN);
+}
+
+void sl_icm42688p_get_drdy_stats(sl_icm42688p_drdy_stats_t *stats)
+{
+  if (stats) {
+    *stats = drdy_stats;
+  }
+}
+
+/* ----- Timestamps ----- */
+void sl_icm42688p_get_timestamp_stats(sl_icm42688p_timestamp_stats_t *stats)
+{
+  if (stats) {
+    stats->anchors = timestamp.anchors;
+    stats->tmst_wraps = timestamp.tmst_wraps;
+    stats->clamped = timestamp.clamped;
+    stats->edge_capture = (EDGE_CAPTURE != 0);
+  }
+}
+
+/* ----- ODR drift and resampling ----- */
+void sl_icm42688p_get_drift_stats(sl_icm42688p_drift_stats_t *stats)
+{
+  if (stats) {
+    stats->nominal_period_ns = odr_nominal_ns;
+    stats->period_ns = sl_icm42688p_drift_period_ns(&drift, odr_nominal_ns);
+    stats->error_ppb = sl_icm42688p_drift_error_ppb(&drift);
+    stats->updates = drift.updates;
+    stats->rejected = drift.rejected;
+    stats->resampled = resample.outputs;
+    stats->resample_gaps = resample.gaps;
+    stats->resampling = resample_enabled;
+  }
+}
+
+sl_status_t sl_icm42688p_set_resampling(bool enable)
+{
+  if (drdy_enabled) {
+    return SL_STATUS_INVALID_STATE;
+  }
+
+  resample_enabled = enable;
+  return SL_STATUS_OK;
+}
+
+bool sl_icm42688p_get_resampling(void)
+{
+  return resample_enabled;
+}
+
+/* ----- Accel/gyro merge ----- */
+sl_status_t sl_icm42688p_set_merge(float output_rate, sl_icm42688p_merge_mode_t mode)
+{
+  if (drdy_enabled) {
+    return SL_STATUS_INVALID_STATE;
+  }
+  if (output_rate < 0.0f || mode > SL_ICM42688P_MERGE_INTERPOLATE) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  merge_period_ns = (output_rate > 0.0f) ? (uint32_t)(1.0e9f / output_rate + 0.5f) : 0U;
+  merge_mode = mode;
+  return SL_STATUS_OK;
+}
+
+void sl_icm42688p_get_merge_stats(sl_icm42688p_merge_stats_t *stats)
+{
+  if (stats) {
+    stats->output_period_ns = merge_period_ns;
+    stats->mode = merge_mode;
+    stats->outputs = merge.outputs;
+    stats->forced = merge.forced;
+    stats->gaps = merge.gaps;
+  }
+}
+
+/* ----- Asynchronous transfers ----- */
+sl_status_t sl_icm42688p_transfer_async(const uint8_t *tx, uint8_t *rx, uint16_t len,
+                                        sl_icm42688p_transfer_callback_t callback, void *context)
+{
+  if (!dma_ready) {
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+  if (drain_enabled) {
+    return SL_STATUS_BUSY;
+  }
+
+  return sl_icm42688p_transport_submit(&dma_transport, tx, rx, len, callback, context);
+}
+
+bool sl_icm42688p_transfer_busy(void)
+{
+  return sl_icm42688p_transport_busy(&dma_transport);
+}
+
+void sl_icm42688p_get_spi_stats(sl_icm42688p_spi_stats_t *stats)
+{
+  if (stats) {
+    *stats = spi_stats;
+  }
+}
+
+void sl_icm42688p_clear_spi_stats(void)
+{
+  spi_stats.transactions = 0;
+  spi_stats.bytes = 0;
+  spi_stats.shadow_hits = 0;
+}
+
+
+sl_status_t sl_icm42688p_calibrate_accel_and_gyro(float accel_bias[3], float gyro_bias[3])
+{
+    if (!accel_bias || !gyro_bias) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+
+    const uint16_t samples = 200;  // one second of the 200 Hz ODR set below
+    float accel_sum[3] = {0}, gyro_sum[3] = {0};
+    float accel_data[3], gyro_data[3];
+    sl_status_t status;
+
+    // Ensure sensors are off before configuring
+    sl_icm42688p_enable_sensor(false, false, false);
+
+    // Set full-scale ranges
+    sl_icm42688p_set_full_scale_accel(ICM42688P_ACCEL_CONFIG0_FS_2G >> ICM42688P_ACCEL_CONFIG0_SHIFT_FS_SEL);
+    sl_icm42688p_set_full_scale_gyro(ICM42688P_GYRO_CONFIG0_FS_250DPS >> ICM42688P_GYRO_CONFIG0_SHIFT_FS_SEL);
+
+    // Set sample rate to 1 kHz and bandwidth to 200 Hz
+    sl_icm42688p_set_sample_rate(1000.0f);
+    sl_icm42688p_accel_set_bandwidth(ICM42688P_ODR_CODE_200HZ);
+    sl_icm42688p_gyro_set_bandwidth(ICM42688P_ODR_CODE_200HZ);
+
+    // Enable accelerometer and gyroscope (temperature optional)
+    sl_icm42688p_enable_sensor(true, true, true);
+
+    // Wait for the sensors to produce valid data
+    status = sl_icm42688p_wait_data_ready(SL_ICM42688P_STARTUP_TIMEOUT_MS);
+    if (status != SL_STATUS_OK) {
+        sl_icm42688p_enable_sensor(false, false, false);
+        return status;
+    }
+
+    // Collect samples, one per DATA_RDY
+    for (uint16_t i = 0; i < samples; i++) {
+        status = sl_icm42688p_wait_status(ICM42688P_INT_STATUS0_DATA_RDY, SL_ICM42688P_STARTUP_TIMEOUT_MS);
+        if (status != SL_STATUS_OK) {
+            sl_icm42688p_enable_sensor(false, false, false);
+            return status;
+        }
+
+        sl_icm42688p_accel_read_data(accel_data);
+        sl_icm42688p_gyro_read_data(gyro_data);
+
+        accel_sum[0] += accel_data[0];
+        accel_sum[1] += accel_data[1];
+        accel_sum[2] += accel_data[2];
+
+        gyro_sum[0] += gyro_data[0];
+        gyro_sum[1] += gyro_data[1];
+        gyro_sum[2] += gyro_data[2];
+    }
+
+    // Compute average
+    accel_bias[0] = accel_sum[0] / samples;
+    accel_bias[1] = accel_sum[1] / samples;
+    accel_bias[2] = accel_sum[2] / samples;
+
+    gyro_bias[0] = gyro_sum[0] / samples;
+    gyro_bias[1] = gyro_sum[1] / samples;
+    gyro_bias[2] = gyro_sum[2] / samples;
+
+    // Correct Z-axis for 1g offset
+    if (accel_bias[2] > 0.0f) {
+        accel_bias[2] -= 1.0f;
+    } else {
+        accel_bias[2] += 1.0f;
+    }
+
+    // Disable sensors after calibration
+    sl_icm42688p_enable_sensor(false, false, false);
+
+    return SL_STATUS_OK;
+}
+
+
+/* ----- Helpers ----- */
+/* GPIO chip select; the EUSART takes care of it in auto CS mode */
+static void sl_icm42688p_chip_select_set(bool select)
+{
+  if (spi_auto_cs) {
+    return;
+  }
+
+  if (select) {
+    sl_gpio_clear_pin(&spi_cs_pin);
+  } else {
+    sl_gpio_set_pin(&spi_cs_pin);
+  }
+}
+
+/* Byte i of a session: the command, then tx or zeros */
+static inline uint8_t sl_icm42688p_session_tx(uint16_t i, uint8_t cmd, const uint8_t *tx)
+{
+  if (i == 0) {
+    return cmd;
+  }
+  return tx ? tx[i - 1U] : 0x00U;
+}
+
+/* Byte i received: the command echo is dropped, then head, then data */
+static inline void sl_icm42688p_session_rx(uint16_t i, uint8_t byte, uint8_t *head, uint16_t head_len, uint8_t *data)
+{
+  if (i == 0) {
+    return;
+  }
+  i--;
+  if (i < head_len) {
+    head[i] = byte;
+  } else if (data) {
+    data[i - head_len] = byte;
+  }
+}
+
+/* One chip-select session: cmd, then head_len + len bytes from tx (zeros if
+   NULL); received bytes go to head and then data, either may be NULL */
+static sl_status_t sl_icm42688p_spi_session(uint8_t cmd, const uint8_t *tx, uint8_t *head, uint16_t head_len, uint8_t *data, uint16_t len)
+{
+  /* Claimed before the busy check, so a DRDY edge from here on defers its
+     LDMA read until the session is over. A read already on the bus is
+     waited out, as the deferred DRDY waits for the session; only a running
+     drain, which never ends by itself, turns the session away. */
+  spi_session_active = true;
+  while (!drain_enabled && sl_icm42688p_transport_busy(&dma_transport)) {
+  }
+  if (sl_icm42688p_bus_busy()) {
+    sl_icm42688p_spi_session_release();
+    return SL_STATUS_BUSY;
+  }
+
+  uint16_t total = (uint16_t)(head_len + len + 1U);
+  sl_status_t status = SL_STATUS_OK;
+
+  if (spi_auto_cs && dma_ready && total > SPI_FIFO_DEPTH && total <= SPI_DMA_SESSION_MAX) {
+    /* Counted by the LDMA completion */
+    status = sl_icm42688p_spi_session_dma(cmd, tx, head, head_len, data, len);
+  } else {
+    if (spi_auto_cs) {
+      sl_icm42688p_spi_session_fifo(cmd, tx, head, head_len, data, len);
+    } else {
+      sl_icm42688p_spi_session_gpio(cmd, tx, head, head_len, data, len);
+    }
+    spi_stats.transactions++;
+    spi_stats.bytes += total;
+  }
+
+  sl_icm42688p_spi_session_release();
+  return status;
+}
+
+/* Hand the bus back and start a DRDY read deferred meanwhile */
+static void sl_icm42688p_spi_session_release(void)
+{
+  spi_session_active = false;
+
+  if (drdy_pending) {
+    CORE_DECLARE_IRQ_STATE;
+    CORE_ENTER_ATOMIC();
+    if (drdy_pending) {
+      sl_icm42688p_drdy_kick();
+    }
+    CORE_EXIT_ATOMIC();
+  }
+}
+
+/* GPIO CS, one byte on the wire at a time */
+static void sl_icm42688p_spi_session_gpio(uint8_t cmd, const uint8_t *tx, uint8_t *head, uint16_t head_len, uint8_t *data, uint16_t len)
+{
+  uint16_t total = (uint16_t)(head_len + len + 1U);
+  uint8_t byte;
+
+  sl_icm42688p_chip_select_set(true);
+  sl_icm42688p_hw_delay_short();
+
+  for (uint16_t i = 0; i < total; ++i) {
+#if defined(_SILICON_LABS_32B_SERIES_2)
+    byte = EUSART_Spi_TxRx(SL_ICM42688P_SPI_EUSART_PERIPHERAL, sl_icm42688p_session_tx(i, cmd, tx));
+#else
+    byte = sl_hal_eusart_spi_tx_rx(SL_ICM42688P_SPI_EUSART_PERIPHERAL, sl_icm42688p_session_tx(i, cmd, tx));
+#endif
+    sl_icm42688p_session_rx(i, byte, head, head_len, data);
+  }
+
+  sl_icm42688p_chip_select_set(false);
+  sl_icm42688p_hw_delay_short();
+}
+
+/* Auto CS: TX is topped up whenever the FIFO has room and RX is emptied as
+   bytes arrive, so frames follow each other without gaps. In-flight bytes
+   are capped at the FIFO depth so RX can never overflow. Bursts longer than
+   the FIFO normally go through sl_icm42688p_spi_session_dma() instead. */
+static void sl_icm42688p_spi_session_fifo(uint8_t cmd, const uint8_t *tx, uint8_t *head, uint16_t head_len, uint8_t *data, uint16_t len)
+{
+  EUSART_TypeDef *eusart = SL_ICM42688P_SPI_EUSART_PERIPHERAL;
+  uint16_t total = (uint16_t)(head_len + len + 1U);
+  uint16_t sent = 0;
+  uint16_t received = 0;
+  bool masked = true;
+  CORE_DECLARE_IRQ_STATE;
+
+  /* CS drops as soon as TX runs dry, even between the first bytes of a
+     short burst: interrupts stay masked until the last byte is queued. A
+     burst that fits the FIFO is queued at once, so that is a few CPU cycles
+     per byte. A longer one (no LDMA, or past SPI_DMA_SESSION_MAX) keeps them
+     masked for all but its last SPI_FIFO_DEPTH bytes on the wire. */
+  CORE_ENTER_ATOMIC();
+
+  while (received < total) {
+    while (sent < total && (uint16_t)(sent - received) < SPI_FIFO_DEPTH
+           && (eusart->STATUS & EUSART_STATUS_TXFL)) {
+      eusart->TXDATA = sl_icm42688p_session_tx(sent++, cmd, tx);
+    }
+    if (masked && sent == total) {
+      CORE_EXIT_ATOMIC();
+      masked = false;
+    }
+    if (eusart->STATUS & EUSART_STATUS_RXFL) {
+      sl_icm42688p_session_rx(received++, (uint8_t)eusart->RXDATA, head, head_len, data);
+    }
+  }
+}
+
+/* Auto CS over LDMA, from thread context: the burst is staged, sent and
+   unpacked once the RX channel has taken the last byte */
+static sl_status_t sl_icm42688p_spi_session_dma(uint8_t cmd, const uint8_t *tx, uint8_t *head, uint16_t head_len, uint8_t *data, uint16_t len)
+{
+  uint16_t total = (uint16_t)(head_len + len + 1U);
+  sl_status_t status;
+
+  for (uint16_t i = 0; i < total; ++i) {
+    spi_dma_buf[i] = sl_icm42688p_session_tx(i, cmd, tx);
+  }
+
+  spi_dma_done = false;
+  status = sl_icm42688p_transport_submit(&dma_transport, spi_dma_buf, spi_dma_buf, total,
+                                         sl_icm42688p_spi_session_dma_done, NULL);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  while (!spi_dma_done) {
+  }
+  if (spi_dma_status != SL_STATUS_OK) {
+    return spi_dma_status;
+  }
+
+  for (uint16_t i = 0; i < total; ++i) {
+    sl_icm42688p_session_rx(i, spi_dma_buf[i], head, head_len, data);
+  }
+  return SL_STATUS_OK;
+}
+
+/* LDMA IRQ: the staged session is over */
+static void sl_icm42688p_spi_session_dma_done(sl_status_t status, void *context)
+{
+  (void)context;
+
+  spi_dma_status = status;
+  spi_dma_done = true;
+}
+
+/* One read session: command byte, head_len bytes into head, len bytes into data */
+static sl_status_t sl_icm42688p_spi_read(uint8_t reg, uint8_t *head, uint16_t head_len, uint8_t *data, uint16_t len)
+{
+  return sl_icm42688p_spi_session((uint8_t)(reg | 0x80U), NULL, head, head_len, data, len);
+}
+
+
+/* SDIV for the fastest rate not above bitrate. The SDK helpers truncate
+   freq / bitrate, which rounds the rate up, past what was asked for. */
+static uint32_t sl_icm42688p_spi_clock_div(uint32_t freq, uint32_t bitrate)
+{
+  uint32_t max = _EUSART_CFG2_SDIV_MASK >> _EUSART_CFG2_SDIV_SHIFT;
+  uint32_t div;
+
+  if (bitrate == 0) {
+    return max;
+  }
+  div = (bitrate >= freq) ? 0 : (uint32_t)(((uint64_t)freq + bitrate - 1U) / bitrate) - 1U;
+  return (div > max) ? max : div;
+}
+
+/* Reprogram the EUSART divider; returns the rate it actually produces,
+   never above bitrate unless bitrate is below the slowest the divider
+   reaches */
+static uint32_t sl_icm42688p_spi_set_bitrate(uint32_t bitrate, void *context)
+{
+  EUSART_TypeDef *eusart = SL_ICM42688P_SPI_EUSART_PERIPHERAL;
+  uint32_t freq = 0;
+  uint32_t div;
+
+  (void)context;
+
+#if defined(_SILICON_LABS_32B_SERIES_2)
+  sl_clock_manager_get_clock_branch_frequency(sl_device_peripheral_get_clock_branch(SL_PERIPHERAL_EUSART1), &freq);
+  div = sl_icm42688p_spi_clock_div(freq, bitrate);
+  /* emlib programs freq / request - 1, which is div for this request */
+  EUSART_BaudrateSet(eusart, freq, freq / (div + 1U));
+  spi_bitrate = EUSART_BaudrateGet(eusart);
+#else
+  sl_clock_manager_get_clock_branch_frequency(SL_CLOCK_BRANCH_EUSART1CLK, &freq);
+  div = sl_icm42688p_spi_clock_div(freq, bitrate);
+  sl_hal_eusart_disable(eusart);
+  eusart->CFG2 = (eusart->CFG2 & ~_EUSART_CFG2_SDIV_MASK) | ((div << _EUSART_CFG2_SDIV_SHIFT) & _EUSART_CFG2_SDIV_MASK);
+  sl_hal_eusart_enable(eusart);
+  sl_hal_eusart_enable_tx(eusart);
+  sl_hal_eusart_enable_rx(eusart);
+  spi_bitrate = sl_hal_eusart_spi_calculate_baudrate(div, freq);
+#endif
+
+  return spi_bitrate;
+}
+
+/* Autotune link: straight to the bus, the shadow would hide read errors */
+static sl_status_t sl_icm42688p_autotune_read(uint8_t reg, uint8_t *data, uint16_t len, void *context)
+{
+  (void)context;
+  return sl_icm42688p_spi_read(reg, data, len, NULL, 0);
+}
+
+static sl_status_t sl_icm42688p_autotune_write(uint8_t reg, uint8_t data, void *context)
+{
+  (void)context;
+  return sl_icm42688p_write_register(reg, data);
+}
+
+/* Allocate one LDMA channel per direction; async transfers stay disabled without them */
+static void sl_icm42688p_dma_init(void)
+{
+  Ecode_t ecode;
+
+  sl_icm42688p_transport_init(&dma_transport, &dma_backend);
+
+  if (dma_ready) {
+    return;
+  }
+
+  ecode = DMADRV_Init();
+  if (ecode != ECODE_EMDRV_DMADRV_OK && ecode != ECODE_EMDRV_DMADRV_ALREADY_INITIALIZED) {
+    return;
+  }
+
+  if (DMADRV_AllocateChannel(&dma_tx_channel, NULL) != ECODE_EMDRV_DMADRV_OK) {
+    return;
+  }
+  if (DMADRV_AllocateChannel(&dma_rx_channel, NULL) != ECODE_EMDRV_DMADRV_OK) {
+    DMADRV_FreeChannel(dma_tx_channel);
+    return;
+  }
+
+  dma_ready = true;
+}
+
+/* Transport backend: assert CS and let RX and TX channels run the burst.
+   With auto CS the EUSART frames the burst as long as LDMA keeps TX fed. */
+static sl_status_t sl_icm42688p_dma_start(const uint8_t *tx, uint8_t *rx, uint16_t len, void *context)
+{
+  EUSART_TypeDef *eusart = SL_ICM42688P_SPI_EUSART_PERIPHERAL;
+  Ecode_t ecode;
+
+  (void)context;
+
+  dma_len = len;
+
+  if (!spi_auto_cs) {
+    sl_icm42688p_chip_select_set(true);
+    sl_icm42688p_hw_delay_short();
+  }
+
+  /* RX first so no received byte can be missed once TX starts clocking */
+  ecode = DMADRV_PeripheralMemory(dma_rx_channel, SL_ICM42688P_SPI_DMA_RX_SIGNAL,
+                                  rx ? (void *)rx : (void *)&dma_rx_sink, (void *)&eusart->RXDATA,
+                                  rx != NULL, len, dmadrvDataSize1,
+                                  sl_icm42688p_dma_rx_done, NULL);
+  if (ecode == ECODE_EMDRV_DMADRV_OK) {
+    ecode = DMADRV_MemoryPeripheral(dma_tx_channel, SL_ICM42688P_SPI_DMA_TX_SIGNAL,
+                                    (void *)&eusart->TXDATA, tx ? (void *)tx : (void *)&dma_tx_fill,
+                                    tx != NULL, len, dmadrvDataSize1,
+                                    NULL, NULL);
+    if (ecode != ECODE_EMDRV_DMADRV_OK) {
+      DMADRV_StopTransfer(dma_rx_channel);
+    }
+  }
+
+  if (ecode != ECODE_EMDRV_DMADRV_OK) {
+    sl_icm42688p_chip_select_set(false);
+    return SL_STATUS_FAIL;
+  }
+
+  return SL_STATUS_OK;
+}
+
+/* LDMA IRQ: the last byte has been received, so the burst is over */
+static bool sl_icm42688p_dma_rx_done(unsigned int channel, unsigned int sequenceNo, void *userParam)
+{
+  (void)channel;
+  (void)sequenceNo;
+  (void)userParam;
+
+  sl_icm42688p_chip_select_set(false);
+
+  spi_stats.transactions++;
+  spi_stats.bytes += dma_len;
+
+  sl_icm42688p_transport_complete(&dma_transport, SL_STATUS_OK);
+  return true;
+}
+
+/* Configuration registers only: data, status, FIFO and self-clearing
+   registers always go to the bus */
+static bool sl_icm42688p_shadow_cacheable(uint8_t bank, uint8_t reg)
+{
+  if (bank >= SHADOW_BANKS || reg >= SHADOW_REGS || reg == ICM42688P_REG_BANK_SEL) {
+    return false;
+  }
+
+  if (bank == ICM42688P_BANK_0) {
+    if ((reg >= ICM42688P_REG_TEMP_DATA1 && reg <= ICM42688P_REG_INT_STATUS3)
+        || reg == ICM42688P_REG_DEVICE_CONFIG
+        || reg == ICM42688P_REG_WHO_AM_I
+        || reg == ICM42688P_REG_SIGNAL_PATH_RESET
+        || reg == ICM42688P_REG_FIFO_LOST_PKT0
+        || reg == ICM42688P_REG_FIFO_LOST_PKT1) {
+      return false;
+    }
+  } else if (bank == ICM42688P_BANK_1) {
+    if (reg >= ICM42688P_REG_TMSTVAL0 && reg <= ICM42688P_REG_TMSTVAL2) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static void sl_icm42688p_shadow_store(uint8_t reg, uint8_t value)
+{
+  if (!sl_icm42688p_shadow_cacheable(current_bank, reg)) {
+    return;
+  }
+
+  reg_shadow[current_bank][reg] = value;
+  reg_shadow_valid[current_bank][reg >> 3] |= (uint8_t)(1U << (reg & 7U));
+
+  if (current_bank == ICM42688P_BANK_0) {
+    sl_icm42688p_scale_t scale;
+    if (reg == ICM42688P_REG_ACCEL_CONFIG0) {
+      sl_icm42688p_scale_from_config(value, 0, &scale);
+      sample_scale.accel = scale.accel;
+    } else if (reg == ICM42688P_REG_GYRO_CONFIG0) {
+      sl_icm42688p_scale_from_config(0, value, &scale);
+      sample_scale.gyro = scale.gyro;
+    } else if (reg == ICM42688P_REG_FSYNC_CONFIG) {
+      fsync_ui_sel = (uint8_t)((value & ICM42688P_FSYNC_CONFIG_MASK_UI_SEL) >> ICM42688P_FSYNC_CONFIG_SHIFT_UI_SEL);
+    }
+  }
+}
+
+/* The shadow vouches that the register already holds the setting's value */
+static bool sl_icm42688p_shadow_matches(const sl_icm42688p_reg_setting_t *setting)
+{
+  uint8_t bank = setting->bank;
+  uint8_t reg = setting->reg;
+
+  return sl_icm42688p_shadow_cacheable(bank, reg)
+         && (reg_shadow_valid[bank][reg >> 3] & (1U << (reg & 7U)))
+         && reg_shadow[bank][reg] == setting->value;
+}
+
+/* Packet size of the FIFO format the shadow says is configured */
+static void sl_icm42688p_fifo_sync(void)
+{
+  uint8_t mode = reg_shadow[ICM42688P_BANK_0][ICM42688P_REG_FIFO_CONFIG] & ICM42688P_FIFO_CONFIG_MODE_MASK;
+  uint8_t cfg1 = reg_shadow[ICM42688P_BANK_0][ICM42688P_REG_FIFO_CONFIG1];
+  uint8_t header = 0;
+
+  if (mode == ICM42688P_FIFO_CONFIG_MODE_BYPASS) {
+    fifo_packet_size = 0;
+    return;
+  }
+
+  if (cfg1 & ICM42688P_FIFO_CONFIG1_ACCEL_EN) {
+    header |= SL_ICM42688P_FIFO_HEADER_ACCEL;
+  }
+  if (cfg1 & ICM42688P_FIFO_CONFIG1_GYRO_EN) {
+    header |= SL_ICM42688P_FIFO_HEADER_GYRO;
+  }
+  if (cfg1 & ICM42688P_FIFO_CONFIG1_HIRES_EN) {
+    header |= SL_ICM42688P_FIFO_HEADER_20;
+  }
+  fifo_packet_size = (uint16_t)sl_icm42688p_fifo_packet_size(header);
+}
+
+/* Blocking access must not interleave with LDMA transfers or drains */
+static bool sl_icm42688p_bus_busy(void)
+{
+  return drain_enabled || sl_icm42688p_transport_busy(&dma_transport);
+}
+
+/* GPIO IRQ: sensor INT edge */
+static void sl_icm42688p_int_handler(uint8_t int_no, void *context)
+{
+  (void)int_no;
+  (void)context;
+
+  if (drdy_enabled) {
+    drdy_stats.edges++;
+    if (drdy_in_flight) {
+      drdy_stats.missed++;
+      return;
+    }
+    if (drdy_pending) {
+      drdy_stats.missed++;   /* superseded before it could be read */
+    }
+
+    drdy_edge = sl_icm42688p_edge_capture();
+    drdy_edge_index = drdy_stats.edges;
+    if (spi_session_active) {
+      drdy_pending = true;
+    } else {
+      sl_icm42688p_drdy_kick();
+    }
+    return;
+  }
+
+  if (!drain_enabled) {
+    return;
+  }
+
+  if (drain_in_flight) {
+    drain_stats.missed_edges++;
+    return;
+  }
+
+  drain_edge = sl_icm42688p_edge_capture();
+  drain_edge_valid = true;
+  sl_icm42688p_drain_kick();
+}
+
+/* Start one drain burst from INT_STATUS; RX ping-pong is already armed.
+   LDMA sends the command too, so the burst has no gap for auto CS to end on. */
+static void sl_icm42688p_drain_kick(void)
+{
+  EUSART_TypeDef *eusart = SL_ICM42688P_SPI_EUSART_PERIPHERAL;
+
+  drain_in_flight = true;
+
+  if (!spi_auto_cs) {
+    sl_icm42688p_chip_select_set(true);
+    sl_icm42688p_hw_delay_short();
+  }
+
+  DMADRV_MemoryPeripheral(dma_tx_channel, SL_ICM42688P_SPI_DMA_TX_SIGNAL,
+                          (void *)&eusart->TXDATA, (void *)drain_tx, true,
+                          DRAIN_HEADER_LEN + drain_bytes, dmadrvDataSize1,
+                          NULL, NULL);
+}
+
+/* LDMA IRQ: one ping-pong block received */
+static bool sl_icm42688p_drain_done(unsigned int channel, unsigned int sequenceNo, void *userParam)
+{
+  const uint8_t *block = drain_block[(sequenceNo - 1U) & 1U];
+  uint64_t *ts = drain_ts[(sequenceNo - 1U) & 1U];
+  uint8_t int_status = block[1];
+  uint16_t level = (uint16_t)sl_icm42688p_be16(&block[2]);
+  uint16_t valid = (level < drain_bytes) ? level : drain_bytes;
+
+  (void)channel;
+  (void)userParam;
+
+  sl_icm42688p_chip_select_set(false);
+  drain_in_flight = false;
+
+  spi_stats.transactions++;
+  spi_stats.bytes += DRAIN_HEADER_LEN + drain_bytes;
+
+  valid = (uint16_t)(valid - (valid % fifo_packet_size));
+
+  drain_stats.drains++;
+  drain_stats.packets += valid / fifo_packet_size;
+  if (int_status & ICM42688P_INT_STATUS0_FIFO_THS) {
+    drain_stats.watermark_hits++;
+  }
+  if (int_status & ICM42688P_INT_STATUS0_FIFO_FULL) {
+    drain_stats.overflows++;
+  }
+  if (level > drain_stats.max_backlog) {
+    drain_stats.max_backlog = level;
+  }
+
+  if (valid > 0) {
+    const uint8_t *pkt = &block[DRAIN_HEADER_LEN];
+    uint16_t packets = valid / fifo_packet_size;
+    uint64_t sensor_us[SL_ICM42688P_FIFO_DRAIN_PACKETS];
+
+    for (uint16_t i = 0; i < packets; ++i, pkt += fifo_packet_size) {
+      uint16_t tmst;
+
+      if (sl_icm42688p_fifo_packet_tmst(pkt, &tmst)) {
+        sensor_us[i] = sl_icm42688p_timestamp_extend_tmst(&timestamp, tmst);
+      } else {
+        /* An FSYNC-tagged packet carries the FSYNC delta instead */
+        if (sl_icm42688p_fifo_packet_fsync(pkt, &tmst)) {
+          drain_stats.fsync_events++;
+        }
+        sensor_us[i] = sl_icm42688p_timestamp_extend_period(&timestamp);
+      }
+    }
+
+    /* The watermark edge is raised by the packet that fills the FIFO to the
+       watermark, the last of a full block read from the head */
+    if (drain_edge_valid && valid == drain_bytes) {
+      sl_icm42688p_timestamp_anchor(&timestamp, sensor_us[packets - 1U], drain_edge);
+      sl_icm42688p_drift_update(sensor_us[packets - 1U] * 1000U, timestamp.capture_ticks);
+    }
+    for (uint16_t i = 0; i < packets; ++i) {
+      ts[i] = sl_icm42688p_timestamp_to_ticks(&timestamp, sensor_us[i]);
+    }
+
+    drain_callback(&block[DRAIN_HEADER_LEN], valid, ts, drain_context);
+  }
+
+  /* Fell behind by a full block: the next edge may not come, drain again now */
+  drain_edge_valid = false;
+  if (drain_enabled && (level - valid) >= drain_bytes) {
+    sl_icm42688p_drain_kick();
+  }
+
+  return drain_enabled;
+}
+
+/* Read the sample burst of the latched DRDY edge over LDMA */
+static void sl_icm42688p_drdy_kick(void)
+{
+  drdy_pending = false;
+  drdy_in_flight = true;
+
+  if (sl_icm42688p_transfer_async(drdy_tx, drdy_rx, drdy_len,
+                                  sl_icm42688p_drdy_done, NULL) != SL_STATUS_OK) {
+    drdy_in_flight = false;
+    drdy_stats.missed++;
+  }
+}
+
+/* LDMA IRQ: the sample burst of the last DRDY edge is in */
+static void sl_icm42688p_drdy_done(sl_status_t status, void *context)
+{
+  sl_icm42688p_raw_sample_t raw;
+  bool fsync;
+
+  (void)context;
+
+  if (status == SL_STATUS_OK) {
+    sl_icm42688p_raw_from_be(&drdy_rx[1], &raw);
+    fsync = sl_icm42688p_fsync_untag(&raw);
+    drdy_stats.samples++;
+    sl_icm42688p_stamped_sample_t sample = {
+      .raw = raw,
+      .timestamp = sl_icm42688p_timestamp_from_capture(&timestamp, drdy_edge),
+      .flags = (uint8_t)(sl_icm42688p_fresh_fields(&raw) | (fsync ? SL_ICM42688P_SAMPLE_FSYNC : 0U)),
+    };
+
+    /* TMST_FSYNC: edge to the ODR of this sample, in TMST LSBs */
+    if (fsync) {
+      sample.fsync_q16 = sl_icm42688p_timestamp_interval_q16(&timestamp,
+                                                             (uint16_t)sl_icm42688p_be16(&drdy_rx[DRDY_FSYNC_OFFSET]));
+      drdy_stats.fsync_events++;
+    }
+
+    sl_icm42688p_drift_update((uint64_t)drdy_edge_index * odr_nominal_ns, sample.timestamp);
+    sl_icm42688p_boot_mark(SL_ICM42688P_BOOT_FIRST_DRDY);
+    if (merge_period_ns) {
+      sl_icm42688p_merge_push(&merge, &sample, sl_icm42688p_merge_output, NULL);
+    } else if (resample_enabled) {
+      sl_icm42688p_resample_push(&resample, &sample, sl_icm42688p_resample_output, NULL);
+    } else {
+      drdy_callback(&sample, drdy_context);
+    }
+  } else {
+    drdy_stats.missed++;
+  }
+
+  drdy_in_flight = false;
+}
+
+/* DRDY fires at the faster ODR and the data registers hold the slower
+   sensor's last value, so a field is fresh when it changed since the last
+   read. A new measurement equal to the old one reads as held, which only
+   loses a flag, not data. */
+static uint8_t sl_icm42688p_fresh_fields(const sl_icm42688p_raw_sample_t *raw)
+{
+  uint8_t flags = 0;
+
+  if (!drdy_prev_valid
+      || memcmp(&raw->data[SL_ICM42688P_RAW_ACCEL_X], &drdy_prev.data[SL_ICM42688P_RAW_ACCEL_X], 3U * sizeof(int32_t)) != 0) {
+    flags |= SL_ICM42688P_SAMPLE_ACCEL_FRESH;
+  }
+  if (!drdy_prev_valid
+      || memcmp(&raw->data[SL_ICM42688P_RAW_GYRO_X], &drdy_prev.data[SL_ICM42688P_RAW_GYRO_X], 3U * sizeof(int32_t)) != 0) {
+    flags |= SL_ICM42688P_SAMPLE_GYRO_FRESH;
+  }
+
+  drdy_prev = *raw;
+  drdy_prev_valid = true;
+  return flags;
+}
+
+/* The tag is the LSB of the data register FSYNC_UI_SEL picks, set on the
+   first sample after the edge; it is cleared so the word reads as data */
+static bool sl_icm42688p_fsync_untag(sl_icm42688p_raw_sample_t *raw)
+{
+  int32_t *word;
+  bool tagged;
+
+  if (fsync_ui_sel == ICM42688P_FSYNC_UI_SEL_OFF) {
+    return false;
+  }
+
+  word = &raw->data[fsync_tag_word[fsync_ui_sel]];
+  tagged = (*word & 1) != 0;
+  *word &= ~1;
+  return tagged;
+}
+
+/* Poll INT_STATUS until a bit of mask is set; the read clears the bits */
+static sl_status_t sl_icm42688p_wait_status(uint8_t mask, uint32_t timeout_ms)
+{
+  uint32_t start = sl_sleeptimer_get_tick_count();
+  uint32_t timeout = sl_sleeptimer_ms_to_tick((uint16_t)timeout_ms);
+  uint8_t int_status;
+
+  do {
+    int_status = 0;
+    sl_status_t status = sl_icm42688p_read_register(ICM42688P_REG_INT_STATUS0, &int_status, 1);
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+    if (int_status & mask) {
+      return SL_STATUS_OK;
+    }
+  } while ((uint32_t)(sl_sleeptimer_get_tick_count() - start) <= timeout);
+
+  return SL_STATUS_TIMEOUT;
+}
+
+/* An MCU-only reset leaves the sensor running: it is kept when WHO_AM_I, the
+   interface setup and every entry of target read back as written. The reads
+   fill the shadow, and with it the scale, FIFO format and FSYNC state. */
+static bool sl_icm42688p_warm_check(const sl_icm42688p_profile_t *target)
+{
+  uint8_t value = 0;
+  bool match = true;
+
+  /* The bank the sensor was left in is unknown */
+  sl_icm42688p_invalidate_shadow();
+  if (sl_icm42688p_set_bank(ICM42688P_BANK_0) != SL_STATUS_OK) {
+    return false;
+  }
+
+  match = (sl_icm42688p_read_register(ICM42688P_REG_WHO_AM_I, &value, 1) == SL_STATUS_OK
+           && value == ICM42688P_DEVICE_ID);
+  if (match) {
+    match = (sl_icm42688p_read_register(ICM42688P_REG_INTF_CONFIG0, &value, 1) == SL_STATUS_OK
+             && value == INIT_INTF_CONFIG0);
+  }
+
+  for (uint16_t i = 0; match && i < target->count; ++i) {
+    const sl_icm42688p_reg_setting_t *setting = &target->settings[i];
+
+    match = (sl_icm42688p_set_bank(setting->bank) == SL_STATUS_OK
+             && sl_icm42688p_read_register(setting->reg, &value, 1) == SL_STATUS_OK
+             && value == setting->value);
+  }
+  sl_icm42688p_set_bank(ICM42688P_BANK_0);
+
+  if (match) {
+    match = (sl_icm42688p_read_register(ICM42688P_REG_FSYNC_CONFIG, &value, 1) == SL_STATUS_OK
+             && sl_icm42688p_read_register(ICM42688P_REG_FIFO_CONFIG, &value, 1) == SL_STATUS_OK
+             && sl_icm42688p_read_register(ICM42688P_REG_FIFO_CONFIG1, &value, 1) == SL_STATUS_OK);
+  }
+  if (match) {
+    sl_icm42688p_fifo_sync();
+  }
+  return match;
+}
+
+/* Ticks since init to the first time each milestone is reached */
+static void sl_icm42688p_boot_mark(sl_icm42688p_boot_event_t event)
+{
+  uint32_t bit = 1UL << event;
+
+  if (!(boot_trace.reached & bit)) {
+    boot_trace.ticks[event] = sl_sleeptimer_get_tick_count() - boot_trace.start;
+    boot_trace.reached |= bit;
+  }
+}
+
+/* Calibration store backend: the MSC page at SL_ICM42688P_CALIB_FLASH_ADDR */
+static sl_status_t sl_icm42688p_calib_flash_read(uint32_t offset, void *data, uint32_t len, void *context)
+{
+  (void)context;
+
+  if (offset + len > FLASH_PAGE_SIZE) {
+    return SL_STATUS_INVALID_RANGE;
+  }
+  memcpy(data, (const void *)(SL_ICM42688P_CALIB_FLASH_ADDR + offset), len);
+  return SL_STATUS_OK;
+}
+
+static sl_status_t sl_icm42688p_calib_flash_erase(void *context)
+{
+  MSC_Status_TypeDef result;
+
+  (void)context;
+
+  MSC_Init();
+  result = MSC_ErasePage((uint32_t *)SL_ICM42688P_CALIB_FLASH_ADDR);
+  MSC_Deinit();
+
+  return (result == mscReturnOk) ? SL_STATUS_OK : SL_STATUS_FLASH_ERASE_FAILED;
+}
+
+static sl_status_t sl_icm42688p_calib_flash_write(uint32_t offset, const void *data, uint32_t len, void *context)
+{
+  MSC_Status_TypeDef result;
+
+  (void)context;
+
+  if (offset + len > FLASH_PAGE_SIZE) {
+    return SL_STATUS_INVALID_RANGE;
+  }
+
+  MSC_Init();
+  result = MSC_WriteWord((uint32_t *)(SL_ICM42688P_CALIB_FLASH_ADDR + offset), data, len);
+  MSC_Deinit();
+
+  return (result == mscReturnOk) ? SL_STATUS_OK : SL_STATUS_FLASH_PROGRAM_FAILED;
+}
+
+/* Route the INT pin to SYSRTC capture 0 so the edge is latched in hardware.
+   The PRS GPIO signal is the EXTI line, set up with int_no = pin above. */
+static void sl_icm42688p_edge_capture_init(void)
+{
+#if EDGE_CAPTURE
+  sl_clock_manager_enable_bus_clock(SL_BUS_CLOCK_PRS);
+
+  PRS->ASYNC_CH[SL_ICM42688P_EDGE_CAPTURE_PRS_CHANNEL].CTRL = PRS_ASYNC_CH_CTRL_SOURCESEL_GPIO
+                                                             | ((uint32_t)SL_ICM42688P_INT_PIN << _PRS_ASYNC_CH_CTRL_SIGSEL_SHIFT)
+                                                             | PRS_ASYNC_CH_CTRL_FNSEL_A;
+  PRS->CONSUMER_SYSRTC0_IN0 = SL_ICM42688P_EDGE_CAPTURE_PRS_CHANNEL;
+
+  /* Group 0 is shared with the sleeptimer, which leaves CAP0 alone unless
+     the HFXO manager is present (see EDGE_CAPTURE) */
+  sl_hal_sysrtc_wait_sync_group(0);
+  SYSRTC0->GRP0_CTRL |= SYSRTC_GRP0_CTRL_CAP0EN
+                        | (_SYSRTC_GRP0_CTRL_CAP0EDGE_RISING << _SYSRTC_GRP0_CTRL_CAP0EDGE_SHIFT);
+  sl_hal_sysrtc_clear_group_interrupts(0, SYSRTC_GRP0_IF_CAP0);
+#endif
+}
+
+/* Sleeptimer count at the last INT edge: the SYSRTC capture when one was
+   latched, otherwise the count now, late by the IRQ latency */
+static uint32_t sl_icm42688p_edge_capture(void)
+{
+#if EDGE_CAPTURE
+  if (sl_hal_sysrtc_get_group_interrupts(0) & SYSRTC_GRP0_IF_CAP0) {
+    sl_hal_sysrtc_clear_group_interrupts(0, SYSRTC_GRP0_IF_CAP0);
+    return sl_hal_sysrtc_get_group_capture_channel_value(0);
+  }
+#endif
+  return sl_sleeptimer_get_tick_count();
+}
+
+/* Fresh timestamp, drift and resampling state for a new acquisition
+   session, from the TMST resolution and the faster of the two ODRs */
+static void sl_icm42688p_timestamp_restart(void)
+{
+  uint8_t tmst_cfg = 0;
+  uint8_t gyro_cfg = 0;
+  uint8_t accel_cfg = 0;
+  const sl_icm42688p_odr_info_t *gyro_odr;
+  const sl_icm42688p_odr_info_t *accel_odr;
+  uint32_t period;
+  uint32_t tick_hz = sl_sleeptimer_get_timer_frequency();
+
+  sl_icm42688p_read_register(ICM42688P_REG_TMST_CONFIG, &tmst_cfg, 1);
+  sl_icm42688p_read_register(ICM42688P_REG_GYRO_CONFIG0, &gyro_cfg, 1);
+  sl_icm42688p_read_register(ICM42688P_REG_ACCEL_CONFIG0, &accel_cfg, 1);
+
+  gyro_odr = sl_icm42688p_odr_info(gyro_cfg & ICM42688P_GYRO_ODR_MASK);
+  accel_odr = sl_icm42688p_odr_info(accel_cfg & ICM42688P_ACCEL_ODR_MASK);
+  if (gyro_odr && (!accel_odr || gyro_odr->period_ns < accel_odr->period_ns)) {
+    period = gyro_odr->period_ns;
+  } else {
+    period = accel_odr ? accel_odr->period_ns : 0U;
+  }
+  odr_nominal_ns = period;
+
+  sl_icm42688p_timestamp_init(&timestamp, tick_hz,
+                              (tmst_cfg & ICM42688P_TMST_CONFIG_RES_16US) ? 16U : 1U,
+                              period / 1000U, SL_ICM42688P_TIMESTAMP_RELAX_SHIFT);
+  sl_icm42688p_drift_init(&drift, tick_hz, (uint32_t)(((uint64_t)tick_hz * SL_ICM42688P_DRIFT_WINDOW_MS) / 1000U),
+                          SL_ICM42688P_DRIFT_SMOOTH_SHIFT);
+  sl_icm42688p_resample_init(&resample, tick_hz, period);
+  sl_icm42688p_merge_init(&merge, tick_hz, merge_period_ns, merge_mode);
+  drain_edge_valid = false;
+}
+
+/* New drift window closed: sensor time maps to ticks at the measured rate */
+static void sl_icm42688p_drift_update(uint64_t sensor_ns, uint64_t ticks)
+{
+  if (sl_icm42688p_drift_observe(&drift, sensor_ns, ticks)) {
+    sl_icm42688p_timestamp_set_rate(&timestamp, drift.rate_q30);
+  }
+}
+
+/* Resampler output: one DRDY sample on the nominal grid */
+static void sl_icm42688p_resample_output(const sl_icm42688p_stamped_sample_t *sample, void *context)
+{
+  (void)context;
+  drdy_callback(sample, drdy_context);
+}
+
+/* Merge output: one aligned accel/gyro record */
+static void sl_icm42688p_merge_output(const sl_icm42688p_stamped_sample_t *record, void *context)
+{
+  (void)context;
+  drdy_callback(record, drdy_context);
+}
+
+/* Transfers are submitted from thread context, the GPIO IRQ (DRDY) and the
+   LDMA IRQ (completion callbacks): masking LDMA alone would let a DRDY edge
+   re-enter the queue during a thread-level submit. The lock never nests,
+   since nothing can interrupt while it is held, so one saved state will do. */
+static CORE_irqState_t dma_lock_state;
+
+static void sl_icm42688p_dma_lock(void)
+{
+  dma_lock_state = CORE_EnterAtomic();
+}
+
+static void sl_icm42688p_dma_unlock(void)
+{
+  CORE_ExitAtomic(dma_lock_state);
+}
+
+
+/* big-endian register pair -> signed 16-bit */
+static inline int16_t sl_icm42688p_be16(const uint8_t *buf)
+{
+  return (int16_t)(((uint16_t)buf[0] << 8) | buf[1]);
 }
 
 
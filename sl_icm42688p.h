@@ -20,22 +20,154 @@ extern "C" {
 
 #include "sl_icm42688p_defs.h"
 #include "sl_icm42688p_config.h"
+#include "sl_icm42688p_fifo.h"
+#include "sl_icm42688p_odr.h"
+#include "sl_icm42688p_sample.h"
+#include "sl_icm42688p_convert.h"
+#include "sl_icm42688p_autotune.h"
+#include "sl_icm42688p_transport.h"
+#include "sl_icm42688p_profile.h"
+#include "sl_icm42688p_ring.h"
+#include "sl_icm42688p_snapshot.h"
+#include "sl_icm42688p_merge.h"
+#include "sl_icm42688p_filter.h"
+#include "sl_icm42688p_calib.h"
+
+/* SPI bus activity counters */
+typedef struct {
+  uint32_t transactions;    /* chip-select sessions */
+  uint32_t bytes;           /* bytes clocked, command byte included */
+  uint32_t shadow_hits;     /* sessions avoided by the register shadow */
+  uint32_t cycles_gpio_cs;  /* CPU cycles per sample burst, GPIO CS (last benchmark) */
+  uint32_t cycles_auto_cs;  /* CPU cycles per sample burst, auto CS + FIFO (last benchmark) */
+} sl_icm42688p_spi_stats_t;
+
+/* Sensor interrupt output */
+typedef enum {
+  SL_ICM42688P_INT1 = 1,
+  SL_ICM42688P_INT2 = 2,
+} sl_icm42688p_int_pin_t;
+
+/* Called from the LDMA IRQ with one drained block of whole FIFO packets and
+   the time of each packet in 64-bit sleeptimer ticks (0 until the first INT
+   edge has been captured). Both stay valid until the drain after next
+   completes. A packet with an FSYNC delta (sl_icm42688p_fifo_packet_fsync())
+   follows the edge by sl_icm42688p_fsync_offset_q16(delta). */
+typedef void (*sl_icm42688p_fifo_block_callback_t)(const uint8_t *data, uint16_t len,
+                                                   const uint64_t *timestamps, void *context);
+
+/* Called from the LDMA IRQ with the sample read after a DRDY edge, stamped
+   with the edge in 64-bit sleeptimer ticks. flags tell which fields hold a
+   new measurement; with resampling or the merge on, which were
+   interpolated. With FSYNC on, the first sample after an edge is flagged
+   SL_ICM42688P_SAMPLE_FSYNC and the edge is fsync_q16 before timestamp. */
+typedef void (*sl_icm42688p_drdy_callback_t)(const sl_icm42688p_stamped_sample_t *sample, void *context);
+
+/* Data-ready acquisition counters */
+typedef struct {
+  uint32_t edges;           /* DRDY edges seen by the GPIO IRQ */
+  uint32_t samples;         /* samples read and handed to the callback */
+  uint32_t missed;          /* edges without a read: previous still in flight or bus busy */
+  uint32_t fsync_events;    /* samples tagged as the first after an FSYNC edge */
+} sl_icm42688p_drdy_stats_t;
+
+/* Timestamp reconstruction counters */
+typedef struct {
+  uint32_t anchors;         /* FIFO blocks aligned to a captured INT edge */
+  uint32_t tmst_wraps;      /* TMST rollovers resolved */
+  uint32_t clamped;         /* timestamps held back to stay monotonic */
+  bool     edge_capture;    /* INT edges timestamped by the SYSRTC capture */
+} sl_icm42688p_timestamp_stats_t;
+
+/* ODR drift telemetry */
+typedef struct {
+  uint32_t nominal_period_ns;   /* configured ODR */
+  uint32_t period_ns;           /* measured sample period in sleeptimer time */
+  int32_t  error_ppb;           /* ODR error, positive when the sensor runs fast */
+  uint32_t updates;             /* drift windows measured */
+  uint32_t rejected;            /* windows discarded as implausible */
+  uint32_t resampled;           /* DRDY samples put out on the nominal grid */
+  uint32_t resample_gaps;       /* grid restarts after lost samples */
+  bool     resampling;
+} sl_icm42688p_drift_stats_t;
+
+/* Accel/gyro merge counters */
+typedef struct {
+  uint32_t output_period_ns;    /* 0 when the merge is off */
+  sl_icm42688p_merge_mode_t mode;
+  uint32_t outputs;             /* records put out */
+  uint32_t forced;              /* records held because the queue was full */
+  uint32_t gaps;                /* grid restarts after lost samples */
+} sl_icm42688p_merge_stats_t;
+
+/* Bring-up milestones, in order */
+typedef enum {
+  SL_ICM42688P_BOOT_SPI_READY = 0,    /* EUSART and LDMA set up */
+  SL_ICM42688P_BOOT_RESET_DONE,       /* RESET_DONE seen, or the reset skipped on a warm restart */
+  SL_ICM42688P_BOOT_ID_VERIFIED,      /* WHO_AM_I matched */
+  SL_ICM42688P_BOOT_SPI_TUNED,        /* bit rate autotuned */
+  SL_ICM42688P_BOOT_POWERED,          /* accel and gyro in low-noise mode */
+  SL_ICM42688P_BOOT_CALIB_LOADED,     /* valid calibration record read from flash */
+  SL_ICM42688P_BOOT_FIRST_DATA,       /* first valid sample in the data registers */
+  SL_ICM42688P_BOOT_CALIBRATED,       /* gyro bias measured */
+  SL_ICM42688P_BOOT_FIRST_DRDY,       /* first sample delivered by DRDY acquisition */
+  SL_ICM42688P_BOOT_EVENTS
+} sl_icm42688p_boot_event_t;
+
+/* Bring-up timeline of the last sl_icm42688p_init() */
+typedef struct {
+  uint32_t start;                             /* sleeptimer tick count at init */
+  uint32_t ticks[SL_ICM42688P_BOOT_EVENTS];   /* sleeptimer ticks after start, per event */
+  uint32_t reached;                           /* bit per event */
+  bool     warm;                              /* sensor kept as it was: no reset, no power-up */
+} sl_icm42688p_boot_trace_t;
+
+/* Gyro bias over a short window, as the sensor outputs it: user offsets
+   already applied */
+typedef struct {
+  float    mean[3];         /* dps */
+  float    variance[3];     /* dps^2 */
+  float    noise_variance;  /* expected per-sample noise at rest at the ODR used, dps^2 */
+  uint16_t samples;
+  uint32_t ticks;           /* sleeptimer ticks taken, ODR changes included */
+} sl_icm42688p_gyro_bias_t;
+
+/* Watermark drain counters */
+typedef struct {
+  uint32_t watermark_hits;  /* drains that saw FIFO_THS set */
+  uint32_t overflows;       /* drains that saw FIFO_FULL set */
+  uint32_t drains;          /* completed drain bursts */
+  uint32_t packets;         /* packets handed to the application */
+  uint32_t missed_edges;    /* INT edges while a drain was already in flight */
+  uint16_t max_backlog;     /* largest FIFO_COUNT seen at a drain, bytes */
+  uint32_t fsync_events;    /* packets tagged as the first after an FSYNC edge */
+} sl_icm42688p_fifo_drain_stats_t;
 
 /* Public API */
 sl_status_t sl_icm42688p_spi_init(void);
+sl_status_t sl_icm42688p_spi_autotune(sl_icm42688p_autotune_result_t *result);
+uint32_t    sl_icm42688p_get_spi_bitrate(void);
+void        sl_icm42688p_get_autotune_result(sl_icm42688p_autotune_result_t *result);
 sl_status_t sl_icm42688p_init(void);
+sl_status_t sl_icm42688p_init_warm(const sl_icm42688p_profile_t *target);
+sl_status_t sl_icm42688p_wait_data_ready(uint32_t timeout_ms);
+void        sl_icm42688p_get_boot_trace(sl_icm42688p_boot_trace_t *trace);
 sl_status_t sl_icm42688p_deinit(void);
 sl_status_t sl_icm42688p_reset(void);
 
 sl_status_t sl_icm42688p_read_register(uint8_t reg, uint8_t *data, uint16_t len);
 sl_status_t sl_icm42688p_write_register(uint8_t reg, uint8_t data);
+sl_status_t sl_icm42688p_write_registers(uint8_t reg, const uint8_t *data, uint16_t len);
 sl_status_t sl_icm42688p_masked_write(uint8_t addr, uint8_t data, uint8_t mask);
 
 sl_status_t sl_icm42688p_set_bank(uint8_t bank);
+void        sl_icm42688p_invalidate_shadow(void);
+sl_status_t sl_icm42688p_apply_profile(const sl_icm42688p_profile_t *profile);
 
 sl_status_t sl_icm42688p_set_full_scale_accel(uint8_t fs_code);
 sl_status_t sl_icm42688p_set_full_scale_gyro(uint8_t fs_code);
 float       sl_icm42688p_set_sample_rate(float sample_rate);
+sl_status_t sl_icm42688p_set_sample_rates(float *accel_rate, float *gyro_rate);
 
 sl_status_t sl_icm42688p_enable_sensor(bool accel, bool gyro, bool temp);
 sl_status_t sl_icm42688p_enable_interrupt(bool data_ready_enable);
@@ -43,18 +175,65 @@ sl_status_t sl_icm42688p_enable_interrupt(bool data_ready_enable);
 sl_status_t sl_icm42688p_accel_read_data(float accel[3]);
 sl_status_t sl_icm42688p_gyro_read_data(float gyro[3]);
 sl_status_t sl_icm42688p_read_temperature(float *temperature);
+sl_status_t sl_icm42688p_read_sample(sl_icm42688p_sample_t *sample);
+sl_status_t sl_icm42688p_read_raw_sample(sl_icm42688p_raw_sample_t *raw);
+const sl_icm42688p_scale_t *sl_icm42688p_get_scale(void);
+const sl_icm42688p_scale_t *sl_icm42688p_get_fifo_scale(void);
 
 sl_status_t sl_icm42688p_get_device_id(uint8_t *dev_id);
 bool        sl_icm42688p_is_data_ready(void);
 
 sl_status_t sl_icm42688p_calibrate_gyro(float bias[3]);
+sl_status_t sl_icm42688p_measure_gyro_bias(uint16_t samples, sl_icm42688p_gyro_bias_t *bias);
+sl_status_t sl_icm42688p_load_calibration(sl_icm42688p_calib_record_t *record,
+                                          sl_icm42688p_calib_result_t *result);
+sl_status_t sl_icm42688p_store_calibration(sl_icm42688p_calib_record_t *record);
+sl_status_t sl_icm42688p_set_user_offsets(const float gyro_bias[3], const float accel_bias[3]);
+sl_status_t sl_icm42688p_get_user_offsets(float gyro_bias[3], float accel_bias[3]);
 sl_status_t sl_icm42688p_accel_set_bandwidth(uint8_t odr_code);
 sl_status_t sl_icm42688p_gyro_set_bandwidth(uint8_t odr_code);
+sl_status_t sl_icm42688p_set_filters(sl_icm42688p_filter_config_t *config);
+sl_status_t sl_icm42688p_set_fsync(bool enable, bool falling_edge);
+bool        sl_icm42688p_get_fsync(void);
+uint32_t    sl_icm42688p_fsync_offset_q16(uint16_t delta);
 sl_status_t sl_icm42688p_read_interrupt_status(uint32_t *status);
 
 sl_status_t sl_icm42688p_accel_get_resolution(float *accel_res);
 sl_status_t sl_icm42688p_gyro_get_resolution(float *gyro_res);
 
+sl_status_t sl_icm42688p_fifo_enable(sl_icm42688p_fifo_packet_t packet);
+sl_status_t sl_icm42688p_fifo_disable(void);
+sl_status_t sl_icm42688p_fifo_flush(void);
+sl_status_t sl_icm42688p_fifo_get_count(uint16_t *fifo_count);
+sl_status_t sl_icm42688p_fifo_read(uint8_t *buf, uint16_t len, uint16_t *fifo_count);
+sl_status_t sl_icm42688p_fifo_read_samples(sl_icm42688p_fifo_sample_t *samples, uint16_t max_samples, uint16_t *count);
+
+sl_status_t sl_icm42688p_fifo_set_watermark(uint16_t bytes);
+sl_status_t sl_icm42688p_enable_fifo_interrupt(sl_icm42688p_int_pin_t pin, bool watermark, bool full);
+sl_status_t sl_icm42688p_fifo_drain_start(uint16_t packets, sl_icm42688p_fifo_block_callback_t callback, void *context);
+sl_status_t sl_icm42688p_fifo_drain_stop(void);
+void        sl_icm42688p_get_fifo_drain_stats(sl_icm42688p_fifo_drain_stats_t *stats);
+
+sl_status_t sl_icm42688p_drdy_start(sl_icm42688p_drdy_callback_t callback, void *context);
+sl_status_t sl_icm42688p_drdy_stop(void);
+void        sl_icm42688p_get_drdy_stats(sl_icm42688p_drdy_stats_t *stats);
+void        sl_icm42688p_get_timestamp_stats(sl_icm42688p_timestamp_stats_t *stats);
+void        sl_icm42688p_get_drift_stats(sl_icm42688p_drift_stats_t *stats);
+sl_status_t sl_icm42688p_set_resampling(bool enable);
+bool        sl_icm42688p_get_resampling(void);
+sl_status_t sl_icm42688p_set_merge(float output_rate, sl_icm42688p_merge_mode_t mode);
+void        sl_icm42688p_get_merge_stats(sl_icm42688p_merge_stats_t *stats);
+
+sl_status_t sl_icm42688p_transfer_async(const uint8_t *tx, uint8_t *rx, uint16_t len,
+                                        sl_icm42688p_transfer_callback_t callback, void *context);
+bool        sl_icm42688p_transfer_busy(void);
+
+void        sl_icm42688p_get_spi_stats(sl_icm42688p_spi_stats_t *stats);
+void        sl_icm42688p_clear_spi_stats(void);
+sl_status_t sl_icm42688p_spi_set_auto_cs(bool enable);
+bool        sl_icm42688p_spi_get_auto_cs(void);
+sl_status_t sl_icm42688p_spi_benchmark(uint16_t iterations);
+
 #ifdef __cplusplus
 }
 #endif
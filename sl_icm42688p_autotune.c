@@ -0,0 +1,129 @@
+/***************************************************************************//**
+ * @file
+ * @brief SPI bit rate autotuning for the TDK InvenSense ICM42688P sensor
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ ******************************************************************************/
+
+#include "sl_icm42688p_autotune.h"
+#include "sl_icm42688p_defs.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/* FIFO watermark low byte: plain read/write and unused while the FIFO is in
+   bypass, so it can hold a test pattern during init. Alternating patterns
+   make a stale or stuck value show up as a mismatch. */
+#define AUTOTUNE_PATTERN_REG   ICM42688P_REG_FIFO_CONFIG2
+#define AUTOTUNE_PATTERN_A     0xA5U
+#define AUTOTUNE_PATTERN_B     0x5AU
+
+/* Local helpers */
+static bool autotune_verify(const sl_icm42688p_autotune_link_t *link,
+                            const sl_icm42688p_autotune_config_t *config,
+                            uint8_t pattern,
+                            sl_icm42688p_autotune_result_t *result)
+{
+  for (uint16_t i = 0; i < config->reads; ++i) {
+    uint8_t id = 0;
+    uint8_t value = 0;
+
+    result->reads++;
+    if (link->read(ICM42688P_REG_WHO_AM_I, &id, 1, link->context) != SL_STATUS_OK
+        || id != ICM42688P_DEVICE_ID) {
+      result->errors++;
+      return false;
+    }
+
+    result->reads++;
+    if (link->read(AUTOTUNE_PATTERN_REG, &value, 1, link->context) != SL_STATUS_OK
+        || value != pattern) {
+      result->errors++;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/* ----- Public API ----- */
+sl_status_t sl_icm42688p_autotune_run(const sl_icm42688p_autotune_link_t *link,
+                                      const sl_icm42688p_autotune_config_t *config,
+                                      sl_icm42688p_autotune_result_t *result)
+{
+  uint8_t saved = 0;
+  uint8_t pattern = AUTOTUNE_PATTERN_A;
+  uint32_t good;
+  uint32_t chosen;
+  uint32_t actual;
+
+  if (!link || !link->set_bitrate || !link->read || !link->write || !config || !result
+      || config->start == 0 || config->step == 0 || config->max < config->start
+      || config->reads == 0 || config->margin_percent >= 100U) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  memset(result, 0, sizeof(*result));
+
+  /* Baseline at the configured rate */
+  good = link->set_bitrate(config->start, link->context);
+  result->bitrate = good;
+  if (link->read(AUTOTUNE_PATTERN_REG, &saved, 1, link->context) != SL_STATUS_OK
+      || link->write(AUTOTUNE_PATTERN_REG, pattern, link->context) != SL_STATUS_OK
+      || !autotune_verify(link, config, pattern, result)) {
+    link->write(AUTOTUNE_PATTERN_REG, saved, link->context);
+    return SL_STATUS_FAIL;
+  }
+  result->highest_ok = good;
+  result->steps = 1;
+
+  /* Step up: the next pattern is written while still at the verified rate */
+  for (uint32_t target = config->start + config->step;
+       target <= config->max && target > config->start;   /* stops on wrap-around */
+       target += config->step) {
+    pattern = (pattern == AUTOTUNE_PATTERN_A) ? AUTOTUNE_PATTERN_B : AUTOTUNE_PATTERN_A;
+    link->write(AUTOTUNE_PATTERN_REG, pattern, link->context);
+
+    actual = link->set_bitrate(target, link->context);
+    if (actual > config->max) {
+      break;      /* the divider overshot the ceiling: never verified, never chosen */
+    }
+    if (actual <= good) {
+      continue;   /* divider did not change */
+    }
+
+    result->steps++;
+    if (!autotune_verify(link, config, pattern, result)) {
+      result->first_fail = actual;
+      break;
+    }
+    good = actual;
+    result->highest_ok = actual;
+  }
+
+  /* Settle below the edge, backing off a step at a time if still marginal */
+  chosen = result->highest_ok - (uint32_t)(((uint64_t)result->highest_ok * config->margin_percent) / 100U);
+  if (chosen < config->start) {
+    chosen = config->start;
+  }
+
+  for (;;) {
+    actual = link->set_bitrate(chosen, link->context);
+    if (actual <= result->highest_ok && autotune_verify(link, config, pattern, result)) {
+      break;
+    }
+    if (chosen == config->start) {
+      result->bitrate = actual;
+      link->write(AUTOTUNE_PATTERN_REG, saved, link->context);
+      return SL_STATUS_FAIL;
+    }
+    chosen = (chosen > config->start + config->step) ? chosen - config->step : config->start;
+  }
+
+  result->bitrate = actual;
+  link->write(AUTOTUNE_PATTERN_REG, saved, link->context);
+
+  return SL_STATUS_OK;
+}
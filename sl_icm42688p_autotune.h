@@ -0,0 +1,64 @@
+/***************************************************************************//**
+ * @file
+ * @brief SPI bit rate autotuning for the TDK InvenSense ICM42688P sensor
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Step, verify and back-off logic only. The bus is reached through a link
+ * (EUSART on target, a simulated transport on a host build) so the search
+ * can be exercised against injected bit errors.
+ ******************************************************************************/
+
+#ifndef SL_ICM42688P_AUTOTUNE_H
+#define SL_ICM42688P_AUTOTUNE_H
+
+#include <stdint.h>
+#include "sl_status.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Bus access for the search. set_bitrate() programs the fastest rate the
+   divider can make without exceeding the request and returns it. read()
+   must bypass any register cache. */
+typedef struct {
+  uint32_t    (*set_bitrate)(uint32_t bitrate, void *context);
+  sl_status_t (*read)(uint8_t reg, uint8_t *data, uint16_t len, void *context);
+  sl_status_t (*write)(uint8_t reg, uint8_t data, void *context);
+  void *context;
+} sl_icm42688p_autotune_link_t;
+
+typedef struct {
+  uint32_t start;           /* known-good rate the search starts from, Hz */
+  uint32_t max;             /* highest rate tried, Hz */
+  uint32_t step;            /* increment between tries, Hz */
+  uint16_t reads;           /* WHO_AM_I + pattern read pairs per verification */
+  uint8_t  margin_percent;  /* taken off the fastest passing rate */
+} sl_icm42688p_autotune_config_t;
+
+typedef struct {
+  uint32_t bitrate;         /* rate left programmed, Hz */
+  uint32_t highest_ok;      /* fastest rate that verified, Hz */
+  uint32_t first_fail;      /* first rate that failed, 0 if max was reached */
+  uint32_t steps;           /* distinct rates verified */
+  uint32_t reads;           /* verification reads issued */
+  uint32_t errors;          /* failed or mismatching reads */
+} sl_icm42688p_autotune_result_t;
+
+/* Raise the rate step by step until a verification fails, then settle
+   margin_percent below the fastest passing rate, backing off further until
+   it verifies. A rate programmed above max ends the search unverified.
+   Writes the pattern register only at already verified rates and restores
+   it before returning. SL_STATUS_FAIL if even start fails. */
+sl_status_t sl_icm42688p_autotune_run(const sl_icm42688p_autotune_link_t *link,
+                                      const sl_icm42688p_autotune_config_t *config,
+                                      sl_icm42688p_autotune_result_t *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_ICM42688P_AUTOTUNE_H
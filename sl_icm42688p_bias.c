@@ -0,0 +1,112 @@
+/***************************************************************************//**
+ * @file
+ * @brief Background gyro bias tracking for the ICM42688P driver
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ ******************************************************************************/
+
+#include "sl_icm42688p_bias.h"
+#include <string.h>
+
+static void bias_window_clear(sl_icm42688p_bias_window_t *window)
+{
+  memset(window, 0, sizeof(*window));
+}
+
+void sl_icm42688p_bias_init(sl_icm42688p_bias_t *tracker, const sl_icm42688p_bias_config_t *config,
+                            const float bias[3])
+{
+  memset(tracker, 0, sizeof(*tracker));
+  tracker->config = *config;
+  if (tracker->config.window < 2U) {
+    tracker->config.window = 2U;
+  }
+  sl_icm42688p_bias_reset(tracker, bias);
+}
+
+void sl_icm42688p_bias_reset(sl_icm42688p_bias_t *tracker, const float bias[3])
+{
+  for (uint8_t k = 0; k < 3U; ++k) {
+    tracker->bias[k] = bias ? bias[k] : 0.0f;
+  }
+  tracker->still = false;
+  tracker->staggered = false;
+  bias_window_clear(&tracker->window[0]);
+  bias_window_clear(&tracker->window[1]);
+}
+
+/* Welford: one division per sample and window, shared by the six axes */
+static void bias_window_add(sl_icm42688p_bias_window_t *window, const float gyro[3], const float accel[3])
+{
+  float weight;
+
+  window->count++;
+  weight = 1.0f / (float)window->count;
+  for (uint8_t k = 0; k < 3U; ++k) {
+    float delta = gyro[k] - window->gyro_mean[k];
+    window->gyro_mean[k] += delta * weight;
+    window->gyro_m2[k] += delta * (gyro[k] - window->gyro_mean[k]);
+
+    delta = accel[k] - window->accel_mean[k];
+    window->accel_mean[k] += delta * weight;
+    window->accel_m2[k] += delta * (accel[k] - window->accel_mean[k]);
+  }
+}
+
+/* Window statistics against the limits */
+static bool bias_window_still(const sl_icm42688p_bias_t *tracker, const sl_icm42688p_bias_window_t *window)
+{
+  const sl_icm42688p_bias_config_t *config = &tracker->config;
+  float n1 = (float)(window->count - 1U);
+
+  for (uint8_t k = 0; k < 3U; ++k) {
+    float deviation = window->gyro_mean[k] - tracker->bias[k];
+
+    /* Written so that NaN fails every test */
+    if (!(window->gyro_m2[k] <= config->gyro_var_max * n1)
+        || !(window->accel_m2[k] <= config->accel_var_max * n1)
+        || !(deviation <= config->max_deviation && deviation >= -config->max_deviation)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool sl_icm42688p_bias_push(sl_icm42688p_bias_t *tracker, const float gyro[3], const float accel[3])
+{
+  bool updated = false;
+
+  bias_window_add(&tracker->window[0], gyro, accel);
+  if (tracker->staggered) {
+    bias_window_add(&tracker->window[1], gyro, accel);
+  } else if (tracker->window[0].count >= tracker->config.window / 2U) {
+    /* The second window takes the next sample as its first */
+    tracker->staggered = true;
+  }
+
+  /* Half a window apart: at most one completes per sample */
+  for (uint8_t w = 0; w < 2U; ++w) {
+    sl_icm42688p_bias_window_t *window = &tracker->window[w];
+
+    if (window->count < tracker->config.window) {
+      continue;
+    }
+
+    tracker->windows++;
+    tracker->still = bias_window_still(tracker, window);
+    if (tracker->still) {
+      float gain = 1.0f / (float)(1UL << tracker->config.smooth_shift);
+
+      for (uint8_t k = 0; k < 3U; ++k) {
+        tracker->bias[k] += (window->gyro_mean[k] - tracker->bias[k]) * gain;
+      }
+      tracker->still_windows++;
+      updated = true;
+    }
+    bias_window_clear(window);
+  }
+
+  return updated;
+}
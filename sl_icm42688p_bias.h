@@ -0,0 +1,82 @@
+/***************************************************************************//**
+ * @file
+ * @brief Background gyro bias tracking for the ICM42688P driver
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Stillness is judged over a window of a fixed length that slides by half
+ * its length: two windows run half a window apart, and each completed one
+ * covers the latest window samples. Each keeps a running mean and variance
+ * per axis (Welford), so memory does not grow with the window. A window
+ * whose accel and gyro variances both stay within the noise at rest, and
+ * whose gyro mean is close to the current bias, counts as still. Each still
+ * window moves the bias a fixed fraction of the way to its gyro mean (EMA).
+ * Steady rotation has no variance; the limit on the distance from the bias
+ * keeps it from being taken as bias.
+ *
+ * Pure float logic with no hardware access, so recorded streams can be
+ * replayed through it on a host.
+ ******************************************************************************/
+
+#ifndef SL_ICM42688P_BIAS_H
+#define SL_ICM42688P_BIAS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+  uint16_t window;          /* samples per stillness decision, >= 2; one every window / 2 */
+  float    gyro_var_max;    /* dps^2, per axis */
+  float    accel_var_max;   /* g^2, per axis */
+  float    max_deviation;   /* dps: a window mean further from the bias is motion */
+  uint8_t  smooth_shift;    /* each still window moves the bias 1/2^n of the way */
+} sl_icm42688p_bias_config_t;
+
+/* Running statistics of one window */
+typedef struct {
+  uint16_t count;
+  float    gyro_mean[3];
+  float    gyro_m2[3];      /* sum of squared deviations */
+  float    accel_mean[3];
+  float    accel_m2[3];
+} sl_icm42688p_bias_window_t;
+
+typedef struct {
+  sl_icm42688p_bias_config_t config;
+
+  /* Windows in progress, half a window apart once the second has started */
+  sl_icm42688p_bias_window_t window[2];
+  bool     staggered;       /* second window started */
+
+  float    bias[3];         /* dps */
+  bool     still;           /* last complete window */
+
+  /* Counters */
+  uint32_t windows;
+  uint32_t still_windows;
+} sl_icm42688p_bias_t;
+
+/* Start from bias (dps); NULL for zero */
+void sl_icm42688p_bias_init(sl_icm42688p_bias_t *tracker, const sl_icm42688p_bias_config_t *config,
+                            const float bias[3]);
+
+/* Replace the bias, e.g. after a calibration, and drop the windows in
+   progress. Counters are kept. */
+void sl_icm42688p_bias_reset(sl_icm42688p_bias_t *tracker, const float bias[3]);
+
+/* Feed one sample, gyro in dps without any bias correction, accel in g.
+   Returns true when the sample completed a still window and the bias
+   moved. */
+bool sl_icm42688p_bias_push(sl_icm42688p_bias_t *tracker, const float gyro[3], const float accel[3]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_ICM42688P_BIAS_H
@@ -0,0 +1,290 @@
+/***************************************************************************//**
+ * @file
+ * @brief Persistent calibration records for the ICM42688P driver
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ ******************************************************************************/
+
+#include "sl_icm42688p_calib.h"
+#include <stddef.h>
+#include <string.h>
+
+#define CALIB_SLOT_SIZE    ((uint32_t)sizeof(sl_icm42688p_calib_record_t))
+#define CALIB_CRC_LEN      ((uint32_t)offsetof(sl_icm42688p_calib_record_t, crc))
+
+/* Slots are programmed whole, so the record must be whole words */
+typedef char calib_record_is_words[(CALIB_SLOT_SIZE % 4U == 0) ? 1 : -1];
+
+/* Newest valid record and the first free slot of the page */
+typedef struct {
+  sl_icm42688p_calib_result_t result;
+  bool     found;
+  uint32_t free_slot;       /* slot count when the page is full */
+} calib_scan_t;
+
+/* Half-byte table: 16 entries, a quarter of the loop iterations of a
+   bitwise CRC */
+static const uint32_t calib_crc_table[16] = {
+  0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU,
+  0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+  0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU,
+  0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU,
+};
+
+uint32_t sl_icm42688p_calib_crc32(const void *data, uint32_t len)
+{
+  const uint8_t *p = data;
+  uint32_t crc = 0xFFFFFFFFU;
+
+  while (len--) {
+    crc ^= *p++;
+    crc = (crc >> 4) ^ calib_crc_table[crc & 0x0FU];
+    crc = (crc >> 4) ^ calib_crc_table[crc & 0x0FU];
+  }
+
+  return ~crc;
+}
+
+void sl_icm42688p_calib_init(sl_icm42688p_calib_record_t *record)
+{
+  memset(record, 0, sizeof(*record));
+  for (uint8_t i = 0; i < 3U; ++i) {
+    record->accel_scale[i] = 1.0f;
+  }
+}
+
+void sl_icm42688p_calib_seal(sl_icm42688p_calib_record_t *record)
+{
+  record->magic = SL_ICM42688P_CALIB_MAGIC;
+  record->version = SL_ICM42688P_CALIB_VERSION;
+  record->length = (uint16_t)CALIB_SLOT_SIZE;
+  record->crc = sl_icm42688p_calib_crc32(record, CALIB_CRC_LEN);
+}
+
+sl_icm42688p_calib_result_t sl_icm42688p_calib_check(const sl_icm42688p_calib_record_t *record)
+{
+  if (record->magic != SL_ICM42688P_CALIB_MAGIC || record->length != CALIB_SLOT_SIZE
+      || record->crc != sl_icm42688p_calib_crc32(record, CALIB_CRC_LEN)) {
+    return SL_ICM42688P_CALIB_CORRUPT;
+  }
+  if (record->version != SL_ICM42688P_CALIB_VERSION) {
+    return SL_ICM42688P_CALIB_OLD_VERSION;
+  }
+  return SL_ICM42688P_CALIB_OK;
+}
+
+bool sl_icm42688p_calib_is_stale(const sl_icm42688p_calib_record_t *record,
+                                 float temperature, float max_delta)
+{
+  float delta = temperature - record->temperature;
+
+  /* NaN compares false both ways: treat an unreadable temperature as stale */
+  return !(delta <= max_delta && delta >= -max_delta);
+}
+
+/* Register value that cancels bias, clamped to the 12-bit range */
+static int32_t calib_offset_code(float bias, float lsb_per_unit, bool *clamped)
+{
+  float code = -bias * lsb_per_unit;
+
+  /* Range first, in float: converting a value int32_t cannot hold is
+     undefined. NaN fails the first test and is reported as out of range. */
+  if (!(code >= (float)ICM42688P_OFFSET_USER_MIN)) {
+    *clamped = true;
+    return ICM42688P_OFFSET_USER_MIN;
+  }
+  if (code > (float)ICM42688P_OFFSET_USER_MAX) {
+    *clamped = true;
+    return ICM42688P_OFFSET_USER_MAX;
+  }
+  return (int32_t)(code + ((code < 0.0f) ? -0.5f : 0.5f));
+}
+
+static float calib_offset_bias(uint32_t low, uint32_t high_nibble, float lsb_per_unit)
+{
+  int32_t value = (int32_t)(((high_nibble & 0x0FU) << 8) | (low & 0xFFU));
+
+  if (value & 0x800) {
+    value -= 0x1000;
+  }
+  return -(float)value / lsb_per_unit;
+}
+
+bool sl_icm42688p_calib_offsets_encode(const float gyro_bias[3], const float accel_bias[3],
+                                       uint8_t regs[ICM42688P_OFFSET_USER_LEN])
+{
+  int32_t g[3] = { 0 };
+  int32_t a[3] = { 0 };
+  bool clamped = false;
+
+  for (uint8_t i = 0; i < 3U; ++i) {
+    if (gyro_bias) {
+      g[i] = calib_offset_code(gyro_bias[i], ICM42688P_OFFSET_USER_GYRO_LSB_PER_DPS, &clamped);
+    }
+    if (accel_bias) {
+      a[i] = calib_offset_code(accel_bias[i], ICM42688P_OFFSET_USER_ACCEL_LSB_PER_G, &clamped);
+    }
+  }
+
+  regs[0] = (uint8_t)g[0];
+  regs[1] = (uint8_t)((((uint32_t)g[1] >> 4) & 0xF0U) | (((uint32_t)g[0] >> 8) & 0x0FU));
+  regs[2] = (uint8_t)g[1];
+  regs[3] = (uint8_t)g[2];
+  regs[4] = (uint8_t)((((uint32_t)a[0] >> 4) & 0xF0U) | (((uint32_t)g[2] >> 8) & 0x0FU));
+  regs[5] = (uint8_t)a[0];
+  regs[6] = (uint8_t)a[1];
+  regs[7] = (uint8_t)((((uint32_t)a[2] >> 4) & 0xF0U) | (((uint32_t)a[1] >> 8) & 0x0FU));
+  regs[8] = (uint8_t)a[2];
+
+  return !clamped;
+}
+
+void sl_icm42688p_calib_offsets_decode(const uint8_t regs[ICM42688P_OFFSET_USER_LEN],
+                                       float gyro_bias[3], float accel_bias[3])
+{
+  if (gyro_bias) {
+    gyro_bias[0] = calib_offset_bias(regs[0], regs[1], ICM42688P_OFFSET_USER_GYRO_LSB_PER_DPS);
+    gyro_bias[1] = calib_offset_bias(regs[2], regs[1] >> 4, ICM42688P_OFFSET_USER_GYRO_LSB_PER_DPS);
+    gyro_bias[2] = calib_offset_bias(regs[3], regs[4], ICM42688P_OFFSET_USER_GYRO_LSB_PER_DPS);
+  }
+  if (accel_bias) {
+    accel_bias[0] = calib_offset_bias(regs[5], regs[4] >> 4, ICM42688P_OFFSET_USER_ACCEL_LSB_PER_G);
+    accel_bias[1] = calib_offset_bias(regs[6], regs[7], ICM42688P_OFFSET_USER_ACCEL_LSB_PER_G);
+    accel_bias[2] = calib_offset_bias(regs[8], regs[7] >> 4, ICM42688P_OFFSET_USER_ACCEL_LSB_PER_G);
+  }
+}
+
+static bool calib_slot_erased(const sl_icm42688p_calib_record_t *slot)
+{
+  const uint32_t *word = (const uint32_t *)slot;
+
+  for (uint32_t i = 0; i < CALIB_SLOT_SIZE / 4U; ++i) {
+    if (word[i] != SL_ICM42688P_CALIB_ERASED) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* Slots fill from the start of the page, so the first erased one ends the
+   scan and the last valid one before it is the newest */
+static sl_status_t calib_scan(const sl_icm42688p_calib_flash_t *flash, sl_icm42688p_calib_record_t *newest,
+                              calib_scan_t *scan)
+{
+  uint32_t slots = flash->page_size / CALIB_SLOT_SIZE;
+  sl_icm42688p_calib_record_t slot;
+  bool old_version = false;
+
+  scan->result = SL_ICM42688P_CALIB_MISSING;
+  scan->found = false;
+  scan->free_slot = slots;
+
+  for (uint32_t i = 0; i < slots; ++i) {
+    sl_status_t status = flash->read(i * CALIB_SLOT_SIZE, &slot, CALIB_SLOT_SIZE, flash->context);
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+
+    if (calib_slot_erased(&slot)) {
+      scan->free_slot = i;
+      break;
+    }
+
+    switch (sl_icm42688p_calib_check(&slot)) {
+      case SL_ICM42688P_CALIB_OK:
+        scan->found = true;
+        *newest = slot;
+        break;
+      case SL_ICM42688P_CALIB_OLD_VERSION:
+        old_version = true;
+        break;
+      default:
+        break;
+    }
+  }
+
+  if (scan->found) {
+    scan->result = SL_ICM42688P_CALIB_OK;
+  } else if (old_version) {
+    scan->result = SL_ICM42688P_CALIB_OLD_VERSION;
+  } else if (scan->free_slot > 0) {
+    scan->result = SL_ICM42688P_CALIB_CORRUPT;
+  }
+  return SL_STATUS_OK;
+}
+
+static bool calib_flash_valid(const sl_icm42688p_calib_flash_t *flash)
+{
+  return flash && flash->read && flash->erase && flash->write && flash->page_size >= CALIB_SLOT_SIZE;
+}
+
+sl_status_t sl_icm42688p_calib_load(const sl_icm42688p_calib_flash_t *flash,
+                                    sl_icm42688p_calib_record_t *record,
+                                    sl_icm42688p_calib_result_t *result)
+{
+  sl_icm42688p_calib_record_t newest;
+  calib_scan_t scan;
+  sl_status_t status;
+
+  if (!calib_flash_valid(flash) || !record) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  sl_icm42688p_calib_init(record);
+  status = calib_scan(flash, &newest, &scan);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  if (scan.found) {
+    *record = newest;
+  }
+  if (result) {
+    *result = scan.result;
+  }
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_icm42688p_calib_store(const sl_icm42688p_calib_flash_t *flash,
+                                     sl_icm42688p_calib_record_t *record)
+{
+  sl_icm42688p_calib_record_t newest;
+  sl_icm42688p_calib_record_t readback;
+  calib_scan_t scan;
+  uint32_t offset;
+  sl_status_t status;
+
+  if (!calib_flash_valid(flash) || !record) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  status = calib_scan(flash, &newest, &scan);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  record->sequence = scan.found ? newest.sequence + 1U : 0;
+  sl_icm42688p_calib_seal(record);
+
+  if (scan.free_slot >= flash->page_size / CALIB_SLOT_SIZE) {
+    status = flash->erase(flash->context);
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+    scan.free_slot = 0;
+  }
+
+  offset = scan.free_slot * CALIB_SLOT_SIZE;
+  status = flash->write(offset, record, CALIB_SLOT_SIZE, flash->context);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  status = flash->read(offset, &readback, CALIB_SLOT_SIZE, flash->context);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+  return (memcmp(&readback, record, CALIB_SLOT_SIZE) == 0) ? SL_STATUS_OK : SL_STATUS_FAIL;
+}
@@ -0,0 +1,119 @@
+/***************************************************************************//**
+ * @file
+ * @brief Persistent calibration records for the ICM42688P driver
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Gyro bias, accel bias and scale, and the die temperature they were taken
+ * at, kept in one reserved flash page. Records are appended to the page so
+ * it is erased only when full; the newest record with a matching version
+ * and CRC wins, and a store cut short by a reset leaves the previous one in
+ * place. The page is reached through a small backend (MSC on target, a RAM
+ * array on a host build). Biases also convert to and from the sensor's
+ * OFFSET_USER register codes, for correction on the sensor itself.
+ *
+ * Plain C, no SDK dependencies: builds unchanged on a Linux host.
+ ******************************************************************************/
+
+#ifndef SL_ICM42688P_CALIB_H
+#define SL_ICM42688P_CALIB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sl_status.h"
+#include "sl_icm42688p_defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SL_ICM42688P_CALIB_MAGIC      0x4C414349U   /* "ICAL" */
+#define SL_ICM42688P_CALIB_VERSION    1U
+
+/* Erased flash reads as all ones */
+#define SL_ICM42688P_CALIB_ERASED     0xFFFFFFFFU
+
+/* Parts of a record that hold a measurement */
+#define SL_ICM42688P_CALIB_GYRO       (1U << 0)
+#define SL_ICM42688P_CALIB_ACCEL      (1U << 1)
+
+/* One record as stored: 32-bit words only, so the layout is the same on
+   target and host and every slot is word aligned */
+typedef struct {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t length;          /* bytes, CRC included */
+  uint32_t valid;           /* SL_ICM42688P_CALIB_xxx */
+  uint32_t sequence;        /* stores so far, newest highest */
+  float    gyro_bias[3];    /* dps, subtracted */
+  float    accel_bias[3];   /* g, subtracted before the scale */
+  float    accel_scale[3];  /* gain per axis, 1.0 = nominal */
+  float    temperature;     /* degC at calibration */
+  uint32_t crc;             /* CRC-32 of every byte before it */
+} sl_icm42688p_calib_record_t;
+
+typedef enum {
+  SL_ICM42688P_CALIB_OK = 0,
+  SL_ICM42688P_CALIB_MISSING,     /* page erased: nothing ever stored */
+  SL_ICM42688P_CALIB_CORRUPT,     /* records present, none with a good CRC */
+  SL_ICM42688P_CALIB_OLD_VERSION, /* good CRC, other record version */
+  SL_ICM42688P_CALIB_STALE,       /* valid, but taken too far from the current temperature */
+} sl_icm42688p_calib_result_t;
+
+/* Flash page backend. Offsets are from the start of the page. write() is
+   only asked to program erased, word-aligned areas a whole number of words
+   long; erase() clears the whole page. */
+typedef struct {
+  uint32_t page_size;
+  sl_status_t (*read)(uint32_t offset, void *data, uint32_t len, void *context);
+  sl_status_t (*erase)(void *context);
+  sl_status_t (*write)(uint32_t offset, const void *data, uint32_t len, void *context);
+  void *context;
+} sl_icm42688p_calib_flash_t;
+
+/* CRC-32 (IEEE 802.3, reflected) */
+uint32_t sl_icm42688p_calib_crc32(const void *data, uint32_t len);
+
+/* No calibration: zero bias, unit scale, nothing valid */
+void sl_icm42688p_calib_init(sl_icm42688p_calib_record_t *record);
+
+/* Fill in magic, version, length and CRC */
+void sl_icm42688p_calib_seal(sl_icm42688p_calib_record_t *record);
+
+/* Structure, version and CRC of one record */
+sl_icm42688p_calib_result_t sl_icm42688p_calib_check(const sl_icm42688p_calib_record_t *record);
+
+/* Whether a valid record was taken more than max_delta degC away from
+   temperature */
+bool sl_icm42688p_calib_is_stale(const sl_icm42688p_calib_record_t *record,
+                                 float temperature, float max_delta);
+
+/* OFFSET_USER0..8 contents that cancel the given biases, dps and g; NULL
+   for no offset. Out-of-range axes are clamped and make it return false. */
+bool sl_icm42688p_calib_offsets_encode(const float gyro_bias[3], const float accel_bias[3],
+                                       uint8_t regs[ICM42688P_OFFSET_USER_LEN]);
+
+/* Biases cancelled by OFFSET_USER0..8 contents; either output may be NULL */
+void sl_icm42688p_calib_offsets_decode(const uint8_t regs[ICM42688P_OFFSET_USER_LEN],
+                                       float gyro_bias[3], float accel_bias[3]);
+
+/* Newest valid record of the page. On anything but SL_ICM42688P_CALIB_OK
+   record is left as sl_icm42688p_calib_init() makes it. result may be NULL;
+   the status only reports backend errors. */
+sl_status_t sl_icm42688p_calib_load(const sl_icm42688p_calib_flash_t *flash,
+                                    sl_icm42688p_calib_record_t *record,
+                                    sl_icm42688p_calib_result_t *result);
+
+/* Seal record with the next sequence number and append it, erasing the
+   page first when no slot is left. The written slot is read back and
+   checked. */
+sl_status_t sl_icm42688p_calib_store(const sl_icm42688p_calib_flash_t *flash,
+                                     sl_icm42688p_calib_record_t *record);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_ICM42688P_CALIB_H
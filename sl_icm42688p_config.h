@@ -84,4 +84,270 @@
 // [GPIO_SL_ICM42688P_INT]$
 // <<< sl:end pin_tool >>>
 
+// <o SL_ICM42688P_INT_SENSOR_PIN> Sensor interrupt output wired to SL_ICM42688P_INT
+// <SL_ICM42688P_INT1=> INT1
+// <SL_ICM42688P_INT2=> INT2
+// <i> Default: SL_ICM42688P_INT1
+#ifndef SL_ICM42688P_INT_SENSOR_PIN
+#define SL_ICM42688P_INT_SENSOR_PIN               SL_ICM42688P_INT1
+#endif
+
+// <h> SPI link
+// <o SL_ICM42688P_SPI_BITRATE> SPI bit rate [Hz]
+// <i> Rate programmed by sl_icm42688p_spi_init(), and the known-good start of autotuning
+// <i> Default: 3300000
+#ifndef SL_ICM42688P_SPI_BITRATE
+#define SL_ICM42688P_SPI_BITRATE                  3300000UL
+#endif
+
+// <q SL_ICM42688P_SPI_AUTOTUNE_ENABLE> Tune the SPI bit rate in sl_icm42688p_init()
+// <i> Default: 1
+#ifndef SL_ICM42688P_SPI_AUTOTUNE_ENABLE
+#define SL_ICM42688P_SPI_AUTOTUNE_ENABLE          1
+#endif
+
+// <o SL_ICM42688P_SPI_AUTOTUNE_MAX> Highest bit rate tried [Hz]
+// <i> Sensor limit is 24 MHz
+// <i> Default: 24000000
+#ifndef SL_ICM42688P_SPI_AUTOTUNE_MAX
+#define SL_ICM42688P_SPI_AUTOTUNE_MAX             24000000UL
+#endif
+
+// <o SL_ICM42688P_SPI_AUTOTUNE_STEP> Bit rate increment per step [Hz]
+// <i> Default: 2000000
+#ifndef SL_ICM42688P_SPI_AUTOTUNE_STEP
+#define SL_ICM42688P_SPI_AUTOTUNE_STEP            2000000UL
+#endif
+
+// <o SL_ICM42688P_SPI_AUTOTUNE_READS> WHO_AM_I + pattern read pairs per step
+// <i> Default: 64
+#ifndef SL_ICM42688P_SPI_AUTOTUNE_READS
+#define SL_ICM42688P_SPI_AUTOTUNE_READS           64U
+#endif
+
+// <o SL_ICM42688P_SPI_AUTOTUNE_MARGIN> Safety margin below the fastest passing rate [%] <0-99>
+// <i> Default: 20
+#ifndef SL_ICM42688P_SPI_AUTOTUNE_MARGIN
+#define SL_ICM42688P_SPI_AUTOTUNE_MARGIN          20U
+#endif
+
+// <q SL_ICM42688P_SPI_AUTO_CS> Hardware chip select with pipelined FIFO transfers
+// <i> CS is driven by the EUSART and bursts are queued back to back; 0 keeps GPIO CS and byte-at-a-time transfers
+// <i> Default: 1
+#ifndef SL_ICM42688P_SPI_AUTO_CS
+#define SL_ICM42688P_SPI_AUTO_CS                  1
+#endif
+
+// <o SL_ICM42688P_SPI_CS_SETUP> CS assert to first clock edge [bit periods] <0-7>
+// <i> Default: 1
+#ifndef SL_ICM42688P_SPI_CS_SETUP
+#define SL_ICM42688P_SPI_CS_SETUP                 1U
+#endif
+
+// <o SL_ICM42688P_SPI_CS_HOLD> Last clock edge to CS release [bit periods] <0-7>
+// <i> Default: 1
+#ifndef SL_ICM42688P_SPI_CS_HOLD
+#define SL_ICM42688P_SPI_CS_HOLD                  1U
+#endif
+// </h>
+
+// <h> Bring-up
+// <o SL_ICM42688P_RESET_TIMEOUT_MS> Longest wait for RESET_DONE after a soft reset [ms] <1-1000>
+// <i> Polled from the 1 ms datasheet minimum on
+// <i> Default: 10
+#ifndef SL_ICM42688P_RESET_TIMEOUT_MS
+#define SL_ICM42688P_RESET_TIMEOUT_MS             10U
+#endif
+
+// <o SL_ICM42688P_STARTUP_TIMEOUT_MS> Longest wait for the first valid sample after power-up [ms] <1-1000>
+// <i> Gyro start-up is 30 ms typical; polled on DATA_RDY
+// <i> Default: 100
+#ifndef SL_ICM42688P_STARTUP_TIMEOUT_MS
+#define SL_ICM42688P_STARTUP_TIMEOUT_MS           100U
+#endif
+
+// <q SL_ICM42688P_WARM_RESTART_ENABLE> Keep a sensor that still runs its last configuration after an MCU-only reset
+// <i> sl_imu_init() skips the soft reset and power-up when the registers read back as sl_imu_configure_rates() left them
+// <i> The last configuration is kept in .noinit RAM; without it the check uses the measurement profile at 1 kHz
+// <i> Default: 1
+#ifndef SL_ICM42688P_WARM_RESTART_ENABLE
+#define SL_ICM42688P_WARM_RESTART_ENABLE          1
+#endif
+
+// <o SL_ICM42688P_GYRO_CAL_SAMPLES> Samples averaged by sl_icm42688p_calibrate_gyro() <1-10000>
+// <i> Read on DATA_RDY, so the duration follows the gyro ODR
+// <i> Default: 500
+#ifndef SL_ICM42688P_GYRO_CAL_SAMPLES
+#define SL_ICM42688P_GYRO_CAL_SAMPLES             500U
+#endif
+// </h>
+
+// <h> Calibration
+// <q SL_ICM42688P_CALIB_PERSIST_ENABLE> Keep calibration in flash and skip the boot-time gyro calibration
+// <i> sl_imu_init() calibrates only when no valid record is stored or it is stale
+// <i> Default: 1
+#ifndef SL_ICM42688P_CALIB_PERSIST_ENABLE
+#define SL_ICM42688P_CALIB_PERSIST_ENABLE         1
+#endif
+
+// <o SL_ICM42688P_CALIB_FLASH_ADDR> Flash page reserved for calibration records
+// <i> Must be page aligned and outside the linker's FLASH region; the
+// <i> default is the last 8 kB page, above the 0x17E000 bytes given to the image
+// <i> Default: 0x0817E000
+#ifndef SL_ICM42688P_CALIB_FLASH_ADDR
+#define SL_ICM42688P_CALIB_FLASH_ADDR             0x0817E000UL
+#endif
+
+// <o SL_ICM42688P_CALIB_MAX_TEMP_DELTA> Die temperature change that makes a stored calibration stale [degC] <1-100>
+// <i> Default: 15
+#ifndef SL_ICM42688P_CALIB_MAX_TEMP_DELTA
+#define SL_ICM42688P_CALIB_MAX_TEMP_DELTA         15
+#endif
+
+// <q SL_ICM42688P_CALIB_ON_SENSOR> Cancel biases in the sensor's OFFSET_USER registers
+// <i> Corrects FIFO data as well and costs the MCU nothing per sample;
+// <i> biases beyond +-64 dps or +-1 g are subtracted on the MCU instead
+// <i> Default: 1
+#ifndef SL_ICM42688P_CALIB_ON_SENSOR
+#define SL_ICM42688P_CALIB_ON_SENSOR              1
+#endif
+
+// <o SL_ICM42688P_RECAL_SAMPLES> Gyro samples per in-place recalibration <16-10000>
+// <i> Read through the FIFO with the gyro raised to 8 kHz: 400 take 50 ms
+// <i> Default: 400
+#ifndef SL_ICM42688P_RECAL_SAMPLES
+#define SL_ICM42688P_RECAL_SAMPLES                400U
+#endif
+
+// <o SL_ICM42688P_RECAL_MOTION_FACTOR> Variance over the sensor's noise at rest that counts as motion <1-1000>
+// <i> A recalibration window above it is rejected
+// <i> Default: 16
+#ifndef SL_ICM42688P_RECAL_MOTION_FACTOR
+#define SL_ICM42688P_RECAL_MOTION_FACTOR          16
+#endif
+
+// <o SL_ICM42688P_RECAL_MAX_BIAS_DPS> Largest gyro bias accepted by a recalibration [dps] <1-64>
+// <i> Steady rotation has no variance; a bias beyond this is taken as motion
+// <i> Default: 5
+#ifndef SL_ICM42688P_RECAL_MAX_BIAS_DPS
+#define SL_ICM42688P_RECAL_MAX_BIAS_DPS           5
+#endif
+
+// <q SL_ICM42688P_BIAS_TRACK_ENABLE> Track the gyro bias in the background while the device is still
+// <i> Updates the bias applied by sl_imu from windows where accel and gyro show only noise
+// <i> Default: 1
+#ifndef SL_ICM42688P_BIAS_TRACK_ENABLE
+#define SL_ICM42688P_BIAS_TRACK_ENABLE            1
+#endif
+
+// <o SL_ICM42688P_BIAS_TRACK_WINDOW_MS> Stillness window [ms] <10-10000>
+// <i> The window slides by half its length: a decision every WINDOW_MS / 2
+// <i> Default: 250
+#ifndef SL_ICM42688P_BIAS_TRACK_WINDOW_MS
+#define SL_ICM42688P_BIAS_TRACK_WINDOW_MS         250U
+#endif
+
+// <o SL_ICM42688P_BIAS_TRACK_MOTION_FACTOR> Variance over the sensor's noise at rest that counts as motion <1-1000>
+// <i> Default: 9
+#ifndef SL_ICM42688P_BIAS_TRACK_MOTION_FACTOR
+#define SL_ICM42688P_BIAS_TRACK_MOTION_FACTOR     9
+#endif
+
+// <o SL_ICM42688P_BIAS_TRACK_MAX_DEV_MDPS> Window gyro mean this far from the bias counts as rotation [mdps] <1-10000>
+// <i> Default: 500
+#ifndef SL_ICM42688P_BIAS_TRACK_MAX_DEV_MDPS
+#define SL_ICM42688P_BIAS_TRACK_MAX_DEV_MDPS      500U
+#endif
+
+// <o SL_ICM42688P_BIAS_TRACK_SMOOTH_SHIFT> Bias update per still window, as 1/2^n of the window mean <0-8>
+// <i> Default: 3
+#ifndef SL_ICM42688P_BIAS_TRACK_SMOOTH_SHIFT
+#define SL_ICM42688P_BIAS_TRACK_SMOOTH_SHIFT      3U
+#endif
+// </h>
+
+// <h> Asynchronous transfers
+// <o SL_ICM42688P_TRANSFER_QUEUE_DEPTH> Queued sl_icm42688p_transfer_async() requests
+// <i> Default: 4
+#ifndef SL_ICM42688P_TRANSFER_QUEUE_DEPTH
+#define SL_ICM42688P_TRANSFER_QUEUE_DEPTH         4U
+#endif
+
+// LDMA request signals matching SL_ICM42688P_SPI_EUSART_PERIPHERAL
+#ifndef SL_ICM42688P_SPI_DMA_TX_SIGNAL
+#define SL_ICM42688P_SPI_DMA_TX_SIGNAL            dmadrvPeripheralSignal_EUSART1_TXBL
+#endif
+#ifndef SL_ICM42688P_SPI_DMA_RX_SIGNAL
+#define SL_ICM42688P_SPI_DMA_RX_SIGNAL            dmadrvPeripheralSignal_EUSART1_RXDATAV
+#endif
+// </h>
+
+// <h> FIFO
+// <o SL_ICM42688P_FIFO_READ_CHUNK> Bytes per FIFO burst in sl_icm42688p_fifo_read_samples()
+// <i> Stack buffer size; a multiple of 16 keeps whole packet 3 frames per burst
+// <i> Also sizes the static buffer for auto-CS sessions run over LDMA
+// <i> Default: 128
+#ifndef SL_ICM42688P_FIFO_READ_CHUNK
+#define SL_ICM42688P_FIFO_READ_CHUNK              128U
+#endif
+
+// <o SL_ICM42688P_FIFO_DRAIN_PACKETS> Maximum packets per watermark drain
+// <i> Sizes the two ping-pong drain blocks
+// <i> Default: 16
+#ifndef SL_ICM42688P_FIFO_DRAIN_PACKETS
+#define SL_ICM42688P_FIFO_DRAIN_PACKETS           16U
+#endif
+// </h>
+
+// <h> Sample acquisition
+// <o SL_ICM42688P_SAMPLE_RING_SIZE> Samples buffered between the data-ready interrupt and the application <2-1024>
+// <i> Must be a power of two
+// <i> Default: 64
+#ifndef SL_ICM42688P_SAMPLE_RING_SIZE
+#define SL_ICM42688P_SAMPLE_RING_SIZE             64U
+#endif
+
+// <q SL_ICM42688P_EDGE_CAPTURE_ENABLE> Capture the INT edge on the SYSRTC through PRS
+// <i> Timestamps the edge in hardware; without it the GPIO IRQ reads the sleeptimer
+// <i> Has no effect with the HFXO manager, which owns the only SYSRTC capture channel
+// <i> Default: 1
+#ifndef SL_ICM42688P_EDGE_CAPTURE_ENABLE
+#define SL_ICM42688P_EDGE_CAPTURE_ENABLE          1
+#endif
+
+// <o SL_ICM42688P_EDGE_CAPTURE_PRS_CHANNEL> PRS channel routing the INT pin to SYSRTC capture 0 <0-15>
+// <i> Channel 1 carries the sleeptimer's HFXO wakeup when the power manager is present
+// <i> Default: 0
+#ifndef SL_ICM42688P_EDGE_CAPTURE_PRS_CHANNEL
+#define SL_ICM42688P_EDGE_CAPTURE_PRS_CHANNEL     0
+#endif
+
+// <o SL_ICM42688P_TIMESTAMP_RELAX_SHIFT> Timestamp anchor tracking towards later edge captures, as 1/2^n per anchor <0-8>
+// <i> Larger values filter more interrupt latency jitter and follow clock steps slower
+// <i> Default: 4
+#ifndef SL_ICM42688P_TIMESTAMP_RELAX_SHIFT
+#define SL_ICM42688P_TIMESTAMP_RELAX_SHIFT        4U
+#endif
+
+// <o SL_ICM42688P_DRIFT_WINDOW_MS> Shortest window measuring the sensor ODR against the sleeptimer, ms <10-60000>
+// <i> One sleeptimer tick of capture jitter is 1/window of rate error before smoothing
+// <i> Default: 1000
+#ifndef SL_ICM42688P_DRIFT_WINDOW_MS
+#define SL_ICM42688P_DRIFT_WINDOW_MS              1000U
+#endif
+
+// <o SL_ICM42688P_DRIFT_SMOOTH_SHIFT> ODR drift estimate smoothing, as 1/2^n of each new window <0-8>
+// <i> Default: 3
+#ifndef SL_ICM42688P_DRIFT_SMOOTH_SHIFT
+#define SL_ICM42688P_DRIFT_SMOOTH_SHIFT           3U
+#endif
+
+// <q SL_ICM42688P_RESAMPLE_ENABLE> Resample DRDY samples onto the exact nominal ODR grid
+// <i> Linear interpolation between the two samples around each grid point; changeable with sl_icm42688p_set_resampling()
+// <i> Default: 0
+#ifndef SL_ICM42688P_RESAMPLE_ENABLE
+#define SL_ICM42688P_RESAMPLE_ENABLE              0
+#endif
+// </h>
+
 #endif // SL_ICM42688P_CONFIG_H
@@ -0,0 +1,338 @@
+/***************************************************************************//**
+ * @file
+ * @brief Batch conversion of big-endian ICM42688P axis triplets
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ ******************************************************************************/
+
+#include "sl_icm42688p_convert.h"
+#include <string.h>
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#define CONVERT_BACKEND_DSP
+#include "cmsis_compiler.h"
+#elif defined(__SSE2__)
+#define CONVERT_BACKEND_SSE2
+#include <emmintrin.h>
+#endif
+
+/* Local helpers */
+static inline int16_t convert_be16(const uint8_t *p)
+{
+  return (int16_t)(((uint16_t)p[0] << 8) | p[1]);
+}
+
+static inline int16_t convert_sat16(int32_t v)
+{
+  if (v > INT16_MAX) {
+    return INT16_MAX;
+  }
+  if (v < INT16_MIN) {
+    return INT16_MIN;
+  }
+  return (int16_t)v;
+}
+
+static inline int32_t convert_sat32(int64_t v)
+{
+  if (v > INT32_MAX) {
+    return INT32_MAX;
+  }
+  if (v < INT32_MIN) {
+    return INT32_MIN;
+  }
+  return (int32_t)v;
+}
+
+/* ----- Parameters ----- */
+void sl_icm42688p_convert_f32_init(sl_icm42688p_convert_f32_t *params, float scale, const float bias[3])
+{
+  for (size_t i = 0; i < 3; ++i) {
+    params->scale[i] = scale;
+    params->bias[i] = bias ? bias[i] : 0.0f;
+  }
+}
+
+void sl_icm42688p_convert_fixed_init(sl_icm42688p_convert_fixed_t *params, float gain, const int16_t bias[3])
+{
+  float q = gain * 32768.0f;
+  int16_t g = (q >= 32767.0f) ? INT16_MAX : (q <= -32768.0f) ? INT16_MIN : (int16_t)q;
+
+  for (size_t i = 0; i < 3; ++i) {
+    params->gain[i] = g;
+    params->bias[i] = bias ? bias[i] : 0;
+  }
+}
+
+/* ----- Portable C ----- */
+void sl_icm42688p_convert_f32_portable(const uint8_t *src, size_t stride, size_t count,
+                                       const sl_icm42688p_convert_f32_t *params, float *dst)
+{
+  for (size_t n = 0; n < count; ++n, src += stride, dst += 3) {
+    for (size_t i = 0; i < 3; ++i) {
+      dst[i] = ((float)convert_be16(&src[2 * i]) - params->bias[i]) * params->scale[i];
+    }
+  }
+}
+
+void sl_icm42688p_convert_q15_portable(const uint8_t *src, size_t stride, size_t count,
+                                       const sl_icm42688p_convert_fixed_t *params, int16_t *dst)
+{
+  for (size_t n = 0; n < count; ++n, src += stride, dst += 3) {
+    for (size_t i = 0; i < 3; ++i) {
+      int32_t d = convert_sat16((int32_t)convert_be16(&src[2 * i]) - params->bias[i]);
+      dst[i] = convert_sat16((d * params->gain[i]) >> 15);
+    }
+  }
+}
+
+void sl_icm42688p_convert_q31_portable(const uint8_t *src, size_t stride, size_t count,
+                                       const sl_icm42688p_convert_fixed_t *params, int32_t *dst)
+{
+  for (size_t n = 0; n < count; ++n, src += stride, dst += 3) {
+    for (size_t i = 0; i < 3; ++i) {
+      int32_t d = convert_sat16((int32_t)convert_be16(&src[2 * i]) - params->bias[i]);
+      dst[i] = convert_sat32((int64_t)(d * params->gain[i]) * 2);
+    }
+  }
+}
+
+/* 20 bits do not fit the halfword lanes of the SIMD backends */
+void sl_icm42688p_convert_f32_20(const uint8_t *src, const uint8_t *ext, uint8_t ext_shift,
+                                 size_t stride, size_t count,
+                                 const sl_icm42688p_convert_f32_t *params, float *dst)
+{
+  for (size_t n = 0; n < count; ++n, src += stride, ext += stride, dst += 3) {
+    for (size_t i = 0; i < 3; ++i) {
+      int32_t v = (int32_t)convert_be16(&src[2 * i]) * 16 + (int32_t)((ext[i] >> ext_shift) & 0x0FU);
+      dst[i] = ((float)v - params->bias[i]) * params->scale[i];
+    }
+  }
+}
+
+#if defined(CONVERT_BACKEND_DSP)
+/* ----- Cortex-M DSP extension -----
+   X and Y come in with one unaligned word load: REV16 byte-swaps both
+   halfwords, QSUB16 removes both biases with saturation, and SMUAD against
+   a gain placed in one half multiplies the matching axis. */
+static inline uint32_t dsp_load_xy(const uint8_t *p)
+{
+  uint32_t w;
+  memcpy(&w, p, sizeof(w));
+  return __REV16(w);
+}
+
+static inline uint32_t dsp_load_z(const uint8_t *p)
+{
+  return ((uint32_t)p[4] << 8) | p[5];
+}
+
+static inline uint32_t dsp_pack16(int16_t lo, int16_t hi)
+{
+  return (uint32_t)(uint16_t)lo | ((uint32_t)(uint16_t)hi << 16);
+}
+
+const char *sl_icm42688p_convert_backend(void)
+{
+  return "dsp";
+}
+
+void sl_icm42688p_convert_f32(const uint8_t *src, size_t stride, size_t count,
+                              const sl_icm42688p_convert_f32_t *params, float *dst)
+{
+  for (size_t n = 0; n < count; ++n, src += stride, dst += 3) {
+    uint32_t xy = dsp_load_xy(src);
+    dst[0] = ((float)(int16_t)(xy & 0xFFFFU) - params->bias[0]) * params->scale[0];
+    dst[1] = ((float)(int16_t)(xy >> 16) - params->bias[1]) * params->scale[1];
+    dst[2] = ((float)(int16_t)dsp_load_z(src) - params->bias[2]) * params->scale[2];
+  }
+}
+
+void sl_icm42688p_convert_q15(const uint8_t *src, size_t stride, size_t count,
+                              const sl_icm42688p_convert_fixed_t *params, int16_t *dst)
+{
+  uint32_t bias_xy = dsp_pack16(params->bias[0], params->bias[1]);
+  uint32_t bias_z  = dsp_pack16(params->bias[2], 0);
+  uint32_t gain_x  = dsp_pack16(params->gain[0], 0);
+  uint32_t gain_y  = dsp_pack16(0, params->gain[1]);
+  uint32_t gain_z  = dsp_pack16(params->gain[2], 0);
+
+  for (size_t n = 0; n < count; ++n, src += stride, dst += 3) {
+    uint32_t d_xy = __QSUB16(dsp_load_xy(src), bias_xy);
+    uint32_t d_z  = __QSUB16(dsp_load_z(src), bias_z);
+    dst[0] = (int16_t)__SSAT((int32_t)__SMUAD(d_xy, gain_x) >> 15, 16);
+    dst[1] = (int16_t)__SSAT((int32_t)__SMUAD(d_xy, gain_y) >> 15, 16);
+    dst[2] = (int16_t)__SSAT((int32_t)__SMUAD(d_z, gain_z) >> 15, 16);
+  }
+}
+
+void sl_icm42688p_convert_q31(const uint8_t *src, size_t stride, size_t count,
+                              const sl_icm42688p_convert_fixed_t *params, int32_t *dst)
+{
+  uint32_t bias_xy = dsp_pack16(params->bias[0], params->bias[1]);
+  uint32_t bias_z  = dsp_pack16(params->bias[2], 0);
+  uint32_t gain_x  = dsp_pack16(params->gain[0], 0);
+  uint32_t gain_y  = dsp_pack16(0, params->gain[1]);
+  uint32_t gain_z  = dsp_pack16(params->gain[2], 0);
+
+  for (size_t n = 0; n < count; ++n, src += stride, dst += 3) {
+    uint32_t d_xy = __QSUB16(dsp_load_xy(src), bias_xy);
+    uint32_t d_z  = __QSUB16(dsp_load_z(src), bias_z);
+    int32_t p;
+    p = (int32_t)__SMUAD(d_xy, gain_x);
+    dst[0] = __QADD(p, p);
+    p = (int32_t)__SMUAD(d_xy, gain_y);
+    dst[1] = __QADD(p, p);
+    p = (int32_t)__SMUAD(d_z, gain_z);
+    dst[2] = __QADD(p, p);
+  }
+}
+
+#elif defined(CONVERT_BACKEND_SSE2)
+/* ----- SSE2 (host) -----
+   Four triplets per step: gathered into 12 packed halfwords, byte-swapped,
+   then processed as three lanes of four with X/Y/Z-rotating constants. */
+#define SSE_TRIPLETS   4U
+
+static inline void sse_gather(const uint8_t *src, size_t stride, __m128i *v0, __m128i *v1)
+{
+  uint8_t buf[32] = { 0 };
+
+  for (size_t k = 0; k < SSE_TRIPLETS; ++k) {
+    memcpy(&buf[6 * k], &src[k * stride], 6);
+  }
+
+  __m128i a = _mm_loadu_si128((const __m128i *)&buf[0]);
+  __m128i b = _mm_loadu_si128((const __m128i *)&buf[16]);
+  *v0 = _mm_or_si128(_mm_slli_epi16(a, 8), _mm_srli_epi16(a, 8));
+  *v1 = _mm_or_si128(_mm_slli_epi16(b, 8), _mm_srli_epi16(b, 8));
+}
+
+/* Saturating doubling of SMUAD-style products: only 0x40000000 overflows */
+static inline __m128i sse_double_sat(__m128i p)
+{
+  __m128i ovf = _mm_cmpeq_epi32(p, _mm_set1_epi32(0x40000000));
+  return _mm_or_si128(_mm_andnot_si128(ovf, _mm_slli_epi32(p, 1)),
+                      _mm_and_si128(ovf, _mm_set1_epi32(INT32_MAX)));
+}
+
+const char *sl_icm42688p_convert_backend(void)
+{
+  return "sse2";
+}
+
+void sl_icm42688p_convert_f32(const uint8_t *src, size_t stride, size_t count,
+                              const sl_icm42688p_convert_f32_t *params, float *dst)
+{
+  const float *b = params->bias;
+  const float *s = params->scale;
+  const __m128 bias[3]  = { _mm_setr_ps(b[0], b[1], b[2], b[0]),
+                            _mm_setr_ps(b[1], b[2], b[0], b[1]),
+                            _mm_setr_ps(b[2], b[0], b[1], b[2]) };
+  const __m128 scale[3] = { _mm_setr_ps(s[0], s[1], s[2], s[0]),
+                            _mm_setr_ps(s[1], s[2], s[0], s[1]),
+                            _mm_setr_ps(s[2], s[0], s[1], s[2]) };
+  size_t n = 0;
+
+  for (; n + SSE_TRIPLETS <= count; n += SSE_TRIPLETS, src += SSE_TRIPLETS * stride, dst += 3 * SSE_TRIPLETS) {
+    __m128i v0, v1;
+    sse_gather(src, stride, &v0, &v1);
+
+    __m128i w[3] = { _mm_srai_epi32(_mm_unpacklo_epi16(v0, v0), 16),
+                     _mm_srai_epi32(_mm_unpackhi_epi16(v0, v0), 16),
+                     _mm_srai_epi32(_mm_unpacklo_epi16(v1, v1), 16) };
+    for (size_t k = 0; k < 3; ++k) {
+      __m128 f = _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(w[k]), bias[k]), scale[k]);
+      _mm_storeu_ps(&dst[4 * k], f);
+    }
+  }
+
+  sl_icm42688p_convert_f32_portable(src, stride, count - n, params, dst);
+}
+
+void sl_icm42688p_convert_q15(const uint8_t *src, size_t stride, size_t count,
+                              const sl_icm42688p_convert_fixed_t *params, int16_t *dst)
+{
+  const int16_t *b = params->bias;
+  const int16_t *g = params->gain;
+  const __m128i bias0 = _mm_setr_epi16(b[0], b[1], b[2], b[0], b[1], b[2], b[0], b[1]);
+  const __m128i bias1 = _mm_setr_epi16(b[2], b[0], b[1], b[2], 0, 0, 0, 0);
+  const __m128i gain0 = _mm_setr_epi16(g[0], g[1], g[2], g[0], g[1], g[2], g[0], g[1]);
+  const __m128i gain1 = _mm_setr_epi16(g[2], g[0], g[1], g[2], 0, 0, 0, 0);
+  size_t n = 0;
+
+  for (; n + SSE_TRIPLETS <= count; n += SSE_TRIPLETS, src += SSE_TRIPLETS * stride, dst += 3 * SSE_TRIPLETS) {
+    __m128i v0, v1;
+    sse_gather(src, stride, &v0, &v1);
+
+    __m128i d0 = _mm_subs_epi16(v0, bias0);
+    __m128i d1 = _mm_subs_epi16(v1, bias1);
+    __m128i lo0 = _mm_mullo_epi16(d0, gain0), hi0 = _mm_mulhi_epi16(d0, gain0);
+    __m128i lo1 = _mm_mullo_epi16(d1, gain1), hi1 = _mm_mulhi_epi16(d1, gain1);
+
+    __m128i q0 = _mm_packs_epi32(_mm_srai_epi32(_mm_unpacklo_epi16(lo0, hi0), 15),
+                                 _mm_srai_epi32(_mm_unpackhi_epi16(lo0, hi0), 15));
+    __m128i q1 = _mm_packs_epi32(_mm_srai_epi32(_mm_unpacklo_epi16(lo1, hi1), 15),
+                                 _mm_setzero_si128());
+    _mm_storeu_si128((__m128i *)&dst[0], q0);
+    _mm_storel_epi64((__m128i *)&dst[8], q1);
+  }
+
+  sl_icm42688p_convert_q15_portable(src, stride, count - n, params, dst);
+}
+
+void sl_icm42688p_convert_q31(const uint8_t *src, size_t stride, size_t count,
+                              const sl_icm42688p_convert_fixed_t *params, int32_t *dst)
+{
+  const int16_t *b = params->bias;
+  const int16_t *g = params->gain;
+  const __m128i bias0 = _mm_setr_epi16(b[0], b[1], b[2], b[0], b[1], b[2], b[0], b[1]);
+  const __m128i bias1 = _mm_setr_epi16(b[2], b[0], b[1], b[2], 0, 0, 0, 0);
+  const __m128i gain0 = _mm_setr_epi16(g[0], g[1], g[2], g[0], g[1], g[2], g[0], g[1]);
+  const __m128i gain1 = _mm_setr_epi16(g[2], g[0], g[1], g[2], 0, 0, 0, 0);
+  size_t n = 0;
+
+  for (; n + SSE_TRIPLETS <= count; n += SSE_TRIPLETS, src += SSE_TRIPLETS * stride, dst += 3 * SSE_TRIPLETS) {
+    __m128i v0, v1;
+    sse_gather(src, stride, &v0, &v1);
+
+    __m128i d0 = _mm_subs_epi16(v0, bias0);
+    __m128i d1 = _mm_subs_epi16(v1, bias1);
+    __m128i lo0 = _mm_mullo_epi16(d0, gain0), hi0 = _mm_mulhi_epi16(d0, gain0);
+    __m128i lo1 = _mm_mullo_epi16(d1, gain1), hi1 = _mm_mulhi_epi16(d1, gain1);
+
+    _mm_storeu_si128((__m128i *)&dst[0], sse_double_sat(_mm_unpacklo_epi16(lo0, hi0)));
+    _mm_storeu_si128((__m128i *)&dst[4], sse_double_sat(_mm_unpackhi_epi16(lo0, hi0)));
+    _mm_storeu_si128((__m128i *)&dst[8], sse_double_sat(_mm_unpacklo_epi16(lo1, hi1)));
+  }
+
+  sl_icm42688p_convert_q31_portable(src, stride, count - n, params, dst);
+}
+
+#else
+/* ----- No SIMD available ----- */
+const char *sl_icm42688p_convert_backend(void)
+{
+  return "portable";
+}
+
+void sl_icm42688p_convert_f32(const uint8_t *src, size_t stride, size_t count,
+                              const sl_icm42688p_convert_f32_t *params, float *dst)
+{
+  sl_icm42688p_convert_f32_portable(src, stride, count, params, dst);
+}
+
+void sl_icm42688p_convert_q15(const uint8_t *src, size_t stride, size_t count,
+                              const sl_icm42688p_convert_fixed_t *params, int16_t *dst)
+{
+  sl_icm42688p_convert_q15_portable(src, stride, count, params, dst);
+}
+
+void sl_icm42688p_convert_q31(const uint8_t *src, size_t stride, size_t count,
+                              const sl_icm42688p_convert_fixed_t *params, int32_t *dst)
+{
+  sl_icm42688p_convert_q31_portable(src, stride, count, params, dst);
+}
+#endif
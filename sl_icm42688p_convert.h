@@ -0,0 +1,81 @@
+/***************************************************************************//**
+ * @file
+ * @brief Batch conversion of big-endian ICM42688P axis triplets
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Converts blocks of big-endian int16 X/Y/Z triplets, as found in register
+ * bursts and FIFO packets, to float, Q15 or Q31 with per-axis scale and
+ * bias. The backend is picked at compile time: Cortex-M DSP extension
+ * (__ARM_FEATURE_DSP), SSE2 on x86 hosts, portable C otherwise. Every
+ * backend gives bit-identical results to the portable one, which stays
+ * callable for cross-checks. The 20-bit triplets of FIFO packet 4 convert
+ * to float only, with portable C on every backend: they do not fit the
+ * halfword lanes the Q15/Q31 kernels are built on.
+ ******************************************************************************/
+
+#ifndef SL_ICM42688P_CONVERT_H
+#define SL_ICM42688P_CONVERT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Float output: out = ((float)raw - bias) * scale */
+typedef struct {
+  float scale[3];    /* units per LSB */
+  float bias[3];     /* LSB */
+} sl_icm42688p_convert_f32_t;
+
+/* Fixed-point output: d = sat16(raw - bias), then
+   Q15: sat16((d * gain) >> 15), Q31: sat32((d * gain) << 1) */
+typedef struct {
+  int16_t gain[3];   /* Q15 */
+  int16_t bias[3];   /* LSB */
+} sl_icm42688p_convert_fixed_t;
+
+/* Uniform scale on all axes; bias may be NULL */
+void sl_icm42688p_convert_f32_init(sl_icm42688p_convert_f32_t *params, float scale, const float bias[3]);
+
+/* Uniform gain (saturated to Q15) on all axes; bias may be NULL */
+void sl_icm42688p_convert_fixed_init(sl_icm42688p_convert_fixed_t *params, float gain, const int16_t bias[3]);
+
+/* Name of the compiled-in backend: "dsp", "sse2" or "portable" */
+const char *sl_icm42688p_convert_backend(void);
+
+/* Convert count triplets. src points at the X high byte of the first
+   triplet, stride is the distance in bytes between triplets (6 when packed,
+   ICM42688P_SAMPLE_BURST_LEN for register bursts, the packet size for the
+   FIFO). dst receives 3 * count values, X/Y/Z interleaved. */
+void sl_icm42688p_convert_f32(const uint8_t *src, size_t stride, size_t count,
+                              const sl_icm42688p_convert_f32_t *params, float *dst);
+void sl_icm42688p_convert_q15(const uint8_t *src, size_t stride, size_t count,
+                              const sl_icm42688p_convert_fixed_t *params, int16_t *dst);
+void sl_icm42688p_convert_q31(const uint8_t *src, size_t stride, size_t count,
+                              const sl_icm42688p_convert_fixed_t *params, int32_t *dst);
+
+/* 20-bit triplets of FIFO packet 4: bits 19:4 big-endian at src, bits 3:0
+   in the nibble at ext_shift (4 for accel, 0 for gyro) of the three bytes
+   at ext. Both advance by stride. */
+void sl_icm42688p_convert_f32_20(const uint8_t *src, const uint8_t *ext, uint8_t ext_shift,
+                                 size_t stride, size_t count,
+                                 const sl_icm42688p_convert_f32_t *params, float *dst);
+
+/* Reference implementations */
+void sl_icm42688p_convert_f32_portable(const uint8_t *src, size_t stride, size_t count,
+                                       const sl_icm42688p_convert_f32_t *params, float *dst);
+void sl_icm42688p_convert_q15_portable(const uint8_t *src, size_t stride, size_t count,
+                                       const sl_icm42688p_convert_fixed_t *params, int16_t *dst);
+void sl_icm42688p_convert_q31_portable(const uint8_t *src, size_t stride, size_t count,
+                                       const sl_icm42688p_convert_fixed_t *params, int32_t *dst);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_ICM42688P_CONVERT_H
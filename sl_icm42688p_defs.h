@@ -44,11 +44,21 @@ extern "C" {
 #define ICM42688P_REG_GYRO_DATA_Y0         0x28U
 #define ICM42688P_REG_GYRO_DATA_Z1         0x29U
 #define ICM42688P_REG_GYRO_DATA_Z0         0x2AU
+#define ICM42688P_REG_TMST_FSYNCH          0x2BU
+#define ICM42688P_REG_TMST_FSYNCL          0x2CU
 #define ICM42688P_REG_INT_STATUS0          0x2DU
 #define ICM42688P_REG_INT_STATUS1          0x2EU
 #define ICM42688P_REG_FIFO_COUNTH          0x2EU
 #define ICM42688P_REG_FIFO_COUNTL          0x2FU
 #define ICM42688P_REG_FIFO_DATA            0x30U
+#define ICM42688P_REG_INT_STATUS2          0x37U
+#define ICM42688P_REG_INT_STATUS3          0x38U
+
+/* TEMP_DATA1..GYRO_DATA_Z0 are contiguous and read in one auto-increment burst */
+#define ICM42688P_SAMPLE_BURST_LEN         (ICM42688P_REG_GYRO_DATA_Z0 - ICM42688P_REG_TEMP_DATA1 + 1U)
+
+/* The same burst extended through TMST_FSYNCH/L, which follow directly */
+#define ICM42688P_SAMPLE_FSYNC_BURST_LEN   (ICM42688P_REG_TMST_FSYNCL - ICM42688P_REG_TEMP_DATA1 + 1U)
 
 /* Additional Bank0 registers at higher offsets */
 #define ICM42688P_REG_SIGNAL_PATH_RESET    0x4BU  /* SIGNAL_PATH_RESET */
@@ -56,18 +66,67 @@ extern "C" {
 #define ICM42688P_REG_INTF_CONFIG1         0x4DU  /* INTF_CONFIG1 */
 #define ICM42688P_REG_PWR_MGMT0            0x4EU  /* PWR_MGMT0 */
 
-/* --- Bank 1 registers --- */
+/* --- Bank 0 sensor configuration registers --- */
 #define ICM42688P_REG_GYRO_CONFIG0         0x4FU  /* GYRO_CONFIG0: address 0x4F (79) */
 #define ICM42688P_REG_ACCEL_CONFIG0        0x50U  /* ACCEL_CONFIG0: address 0x50 (80) */
 #define ICM42688P_REG_GYRO_CONFIG1         0x51U
 #define ICM42688P_REG_GYRO_ACCEL_CONFIG0   0x52U
 #define ICM42688P_REG_ACCEL_CONFIG1        0x53U
 
+/* Reset values of the UI filter registers */
+#define ICM42688P_GYRO_CONFIG1_DEFAULT       0x16U  /* 2nd order UI filter, 3rd order DEC2_M2 */
+#define ICM42688P_GYRO_ACCEL_CONFIG0_DEFAULT 0x11U  /* accel and gyro UI filter BW = max(400 Hz, ODR) / 4 */
+#define ICM42688P_ACCEL_CONFIG1_DEFAULT      0x0DU  /* 2nd order UI filter, 3rd order DEC2_M2 */
+
+/* UI filter fields */
+#define ICM42688P_GYRO_CONFIG1_SHIFT_UI_FILT_ORD     2U
+#define ICM42688P_GYRO_CONFIG1_MASK_UI_FILT_ORD      (0x03U << ICM42688P_GYRO_CONFIG1_SHIFT_UI_FILT_ORD)
+#define ICM42688P_ACCEL_CONFIG1_SHIFT_UI_FILT_ORD    3U
+#define ICM42688P_ACCEL_CONFIG1_MASK_UI_FILT_ORD     (0x03U << ICM42688P_ACCEL_CONFIG1_SHIFT_UI_FILT_ORD)
+#define ICM42688P_GYRO_ACCEL_CONFIG0_SHIFT_ACCEL_BW  4U
+#define ICM42688P_GYRO_ACCEL_CONFIG0_SHIFT_GYRO_BW   0U
+#define ICM42688P_UI_FILT_BW_LOW_LATENCY             0x0EU  /* no UI filter, Dec2 at max(400 Hz, ODR) */
+
+/* Bank 1 gyro notch and anti-alias filters */
+#define ICM42688P_REG_GYRO_CONFIG_STATIC2    0x0BU
+#define ICM42688P_REG_GYRO_CONFIG_STATIC3    0x0CU  /* GYRO_AAF_DELT */
+#define ICM42688P_REG_GYRO_CONFIG_STATIC4    0x0DU  /* GYRO_AAF_DELTSQR[7:0] */
+#define ICM42688P_REG_GYRO_CONFIG_STATIC5    0x0EU  /* GYRO_AAF_BITSHIFT, GYRO_AAF_DELTSQR[11:8] */
+#define ICM42688P_REG_GYRO_CONFIG_STATIC6    0x0FU  /* GYRO_X_NF_COSWZ[7:0] */
+#define ICM42688P_REG_GYRO_CONFIG_STATIC7    0x10U  /* GYRO_Y_NF_COSWZ[7:0] */
+#define ICM42688P_REG_GYRO_CONFIG_STATIC8    0x11U  /* GYRO_Z_NF_COSWZ[7:0] */
+#define ICM42688P_REG_GYRO_CONFIG_STATIC9    0x12U  /* COSWZ_SEL and COSWZ[8] per axis */
+#define ICM42688P_REG_GYRO_CONFIG_STATIC10   0x13U  /* GYRO_NF_BW_SEL */
+#define ICM42688P_GYRO_CONFIG_STATIC2_AAF_DIS        (1U << 1)
+#define ICM42688P_GYRO_CONFIG_STATIC2_NF_DIS         (1U << 0)
+#define ICM42688P_GYRO_CONFIG_STATIC3_MASK_AAF_DELT  0x3FU
+#define ICM42688P_GYRO_CONFIG_STATIC9_SHIFT_COSWZ_SEL 3U    /* X, Y, Z in bits 3, 4, 5 */
+#define ICM42688P_GYRO_CONFIG_STATIC9_MASK_NF        0x3FU
+#define ICM42688P_GYRO_CONFIG_STATIC10_SHIFT_NF_BW   4U
+#define ICM42688P_GYRO_CONFIG_STATIC10_MASK_NF_BW    (0x07U << ICM42688P_GYRO_CONFIG_STATIC10_SHIFT_NF_BW)
+
+/* Bank 2 accel anti-alias filter */
+#define ICM42688P_REG_ACCEL_CONFIG_STATIC2   0x03U  /* ACCEL_AAF_DELT, ACCEL_AAF_DIS */
+#define ICM42688P_REG_ACCEL_CONFIG_STATIC3   0x04U  /* ACCEL_AAF_DELTSQR[7:0] */
+#define ICM42688P_REG_ACCEL_CONFIG_STATIC4   0x05U  /* ACCEL_AAF_BITSHIFT, ACCEL_AAF_DELTSQR[11:8] */
+#define ICM42688P_ACCEL_CONFIG_STATIC2_SHIFT_AAF_DELT 1U
+#define ICM42688P_ACCEL_CONFIG_STATIC2_AAF_DIS       (1U << 0)
+
+/* AAF_BITSHIFT in bits 7:4 of the register that holds DELTSQR[11:8] */
+#define ICM42688P_AAF_SHIFT_BITSHIFT                 4U
+#define ICM42688P_AAF_MASK_DELTSQR_HI                0x0FU
+
 /* FIFO config registers (Bank 0 / UI registers) */
 #define ICM42688P_REG_FIFO_CONFIG1         0x5FU
 #define ICM42688P_REG_FIFO_CONFIG2         0x60U
 #define ICM42688P_REG_FIFO_CONFIG3         0x61U
 #define ICM42688P_REG_FSYNC_CONFIG         0x62U
+#define ICM42688P_REG_FIFO_LOST_PKT0       0x6CU
+#define ICM42688P_REG_FIFO_LOST_PKT1       0x6DU
+
+/* Bank 1 timestamp value latched by TMST_STROBE */
+#define ICM42688P_REG_TMSTVAL0             0x62U
+#define ICM42688P_REG_TMSTVAL2             0x64U
 
 /* SELF_TEST_CONFIG (Bank 0) */
 #define ICM42688P_REG_SELF_TEST_CONFIG     0x70U  /* SELF_TEST_CONFIG address 0x70 (112) per datasheet */
@@ -97,7 +156,7 @@ extern "C" {
 #define ICM42688P_GYRO_CONFIG0_FS_31_25DPS       (0x06U << ICM42688P_GYRO_CONFIG0_SHIFT_FS_SEL)
 #define ICM42688P_GYRO_CONFIG0_FS_15_625DPS      (0x07U << ICM42688P_GYRO_CONFIG0_SHIFT_FS_SEL)
 
-/* GYRO_ODR codes (bits 3:0) common ODR codes (example) */
+/* GYRO_ODR codes (bits 3:0) */
 #define ICM42688P_GYRO_ODR_RESERVED              0x00U
 #define ICM42688P_GYRO_ODR_32KHZ                 0x01U
 #define ICM42688P_GYRO_ODR_16KHZ                 0x02U
@@ -106,7 +165,11 @@ extern "C" {
 #define ICM42688P_GYRO_ODR_2KHZ                  0x05U
 #define ICM42688P_GYRO_ODR_1KHZ                  0x06U /* default */
 #define ICM42688P_GYRO_ODR_200HZ                 0x07U
-/* ... other codes available in datasheet ... */
+#define ICM42688P_GYRO_ODR_100HZ                 0x08U
+#define ICM42688P_GYRO_ODR_50HZ                  0x09U
+#define ICM42688P_GYRO_ODR_25HZ                  0x0AU
+#define ICM42688P_GYRO_ODR_12_5HZ                0x0BU
+#define ICM42688P_GYRO_ODR_500HZ                 0x0FU
 
 /* ------------------------------------------------------------------------- */
 /* ACCEL_CONFIG0 fields (address 0x50)                                       */
@@ -143,12 +206,71 @@ extern "C" {
 #define ICM42688P_TEMP_SENSITIVITY         132.48f
 #define ICM42688P_TEMP_OFFSET              25.0f
 
+/* FIFO packet 4: 20-bit data at a fixed full scale of 16 g / 2000 dps */
+#define ICM42688P_HIRES_ACCEL_SENSITIVITY  8192.0f   /* LSB/g */
+#define ICM42688P_HIRES_GYRO_SENSITIVITY   131.0f    /* LSB/dps */
+
 /* --- Misc / FIFO --- */
 #define ICM42688P_REG_FIFO_CONFIG1          0x5FU
 #define ICM42688P_REG_FIFO_CONFIG2          0x60U
 #define ICM42688P_REG_FIFO_CONFIG3          0x61U
 #define ICM42688P_FIFO_CONFIG1_FIFO_MODE_MASK 0x07U
 
+/* FIFO_CONFIG (0x16) bits 7:6 = FIFO_MODE */
+#define ICM42688P_FIFO_CONFIG_MODE_MASK          (0x03U << 6)
+#define ICM42688P_FIFO_CONFIG_MODE_BYPASS        (0x00U << 6)
+#define ICM42688P_FIFO_CONFIG_MODE_STREAM        (0x01U << 6)
+#define ICM42688P_FIFO_CONFIG_MODE_STOP_ON_FULL  (0x02U << 6)
+
+/* FIFO_CONFIG1 (0x5F) */
+#define ICM42688P_FIFO_CONFIG1_RESUME_PARTIAL_RD (1U << 6)
+#define ICM42688P_FIFO_CONFIG1_WM_GT_TH          (1U << 5)
+#define ICM42688P_FIFO_CONFIG1_HIRES_EN          (1U << 4)
+#define ICM42688P_FIFO_CONFIG1_TMST_FSYNC_EN     (1U << 3)
+#define ICM42688P_FIFO_CONFIG1_TEMP_EN           (1U << 2)
+#define ICM42688P_FIFO_CONFIG1_GYRO_EN           (1U << 1)
+#define ICM42688P_FIFO_CONFIG1_ACCEL_EN          (1U << 0)
+
+/* SIGNAL_PATH_RESET (0x4B) */
+#define ICM42688P_SIGNAL_PATH_RESET_FIFO_FLUSH   (1U << 1)
+
+/* TMST_CONFIG (Bank 0) */
+#define ICM42688P_REG_TMST_CONFIG                0x54U
+#define ICM42688P_TMST_CONFIG_TO_REGS_EN         (1U << 4)
+#define ICM42688P_TMST_CONFIG_RES_16US           (1U << 3)
+#define ICM42688P_TMST_CONFIG_DELTA_EN           (1U << 2)
+#define ICM42688P_TMST_CONFIG_FSYNC_EN           (1U << 1)
+#define ICM42688P_TMST_CONFIG_EN                 (1U << 0)
+
+/* FSYNC_CONFIG (0x62, Bank 0) */
+#define ICM42688P_FSYNC_CONFIG_SHIFT_UI_SEL      4U   /* data register whose LSB carries the tag */
+#define ICM42688P_FSYNC_CONFIG_MASK_UI_SEL       (0x07U << ICM42688P_FSYNC_CONFIG_SHIFT_UI_SEL)
+#define ICM42688P_FSYNC_UI_SEL_OFF               0x00U
+#define ICM42688P_FSYNC_UI_SEL_TEMP              0x01U
+#define ICM42688P_FSYNC_CONFIG_FLAG_CLEAR_READ   (1U << 1)  // 0 = tag cleared by the next data update
+#define ICM42688P_FSYNC_CONFIG_POLARITY_FALLING  (1U << 0)
+
+/* INTF_CONFIG5 (Bank 1): pin 9 is INT2, FSYNC or CLKIN */
+#define ICM42688P_REG_INTF_CONFIG5               0x7BU
+#define ICM42688P_INTF_CONFIG5_SHIFT_PIN9        1U
+#define ICM42688P_INTF_CONFIG5_MASK_PIN9         (0x03U << ICM42688P_INTF_CONFIG5_SHIFT_PIN9)
+#define ICM42688P_PIN9_FUNCTION_INT2             0x00U
+#define ICM42688P_PIN9_FUNCTION_FSYNC            0x01U
+
+/* OFFSET_USER0..8 (Bank 4): 12-bit two's complement offsets added to the
+   sensor output, data registers and FIFO alike. Upper nibbles are shared:
+     USER0 GYRO_X[7:0]                USER5 ACCEL_X[7:0]
+     USER1 GYRO_Y[11:8] GYRO_X[11:8]  USER6 ACCEL_Y[7:0]
+     USER2 GYRO_Y[7:0]                USER7 ACCEL_Z[11:8] ACCEL_Y[11:8]
+     USER3 GYRO_Z[7:0]                USER8 ACCEL_Z[7:0]
+     USER4 ACCEL_X[11:8] GYRO_Z[11:8] */
+#define ICM42688P_REG_OFFSET_USER0               0x77U
+#define ICM42688P_OFFSET_USER_LEN                9U
+#define ICM42688P_OFFSET_USER_MIN                (-2048)
+#define ICM42688P_OFFSET_USER_MAX                2047
+#define ICM42688P_OFFSET_USER_GYRO_LSB_PER_DPS   32.0f    /* 1/32 dps, +-64 dps */
+#define ICM42688P_OFFSET_USER_ACCEL_LSB_PER_G    2000.0f  /* 0.5 mg, +-1 g */
+
 /* ------------------------------------------------------------------------- */
 /* PWR_MGMT0 register (0x4E) bit definitions                                  */
 /* ------------------------------------------------------------------------- */
@@ -166,12 +288,39 @@ extern "C" {
 #define ICM42688P_PWR_MGMT0_TEMP_DIS             (1U << 5)
 
 #define ICM42688P_INTF_CONFIG0_I2C_DISABLE   (0x03U)  // bit 1 disables I3C
+#define ICM42688P_INTF_CONFIG0_FIFO_COUNT_ENDIAN  (1U << 5)  // 1 = big-endian FIFO_COUNT (reset value)
+#define ICM42688P_INTF_CONFIG0_SENSOR_DATA_ENDIAN (1U << 4)  // 1 = big-endian data and FIFO (reset value)
 #define ICM42688P_DEVICE_CONFIG_RESET   0x01
-#define ICM42688P_INT_STATUS0_DATA_RDY   (1U << 0)
+#define ICM42688P_INT_STATUS0_DATA_RDY   (1U << 3)
 #define ICM42688P_ACCEL_ODR_MASK 0x0FU
 #define ICM42688P_GYRO_ODR_MASK 0x0FU
-#define ICM42688P_ODR_CODE_1KHZ 0x06U  // already defined for accel
-#define ICM42688P_ODR_CODE_200HZ 0x07U
+
+/* ACCEL_ODR / GYRO_ODR codes (bits 3:0). 32/16/8 kHz need low-noise mode,
+   the accel-only 6.25 Hz and below need accel low-power mode. */
+#define ICM42688P_ODR_CODE_32KHZ    0x01U
+#define ICM42688P_ODR_CODE_16KHZ    0x02U
+#define ICM42688P_ODR_CODE_8KHZ     0x03U
+#define ICM42688P_ODR_CODE_4KHZ     0x04U
+#define ICM42688P_ODR_CODE_2KHZ     0x05U
+#define ICM42688P_ODR_CODE_1KHZ     0x06U
+#define ICM42688P_ODR_CODE_200HZ    0x07U
+#define ICM42688P_ODR_CODE_100HZ    0x08U
+#define ICM42688P_ODR_CODE_50HZ     0x09U
+#define ICM42688P_ODR_CODE_25HZ     0x0AU
+#define ICM42688P_ODR_CODE_12_5HZ   0x0BU
+#define ICM42688P_ODR_CODE_6_25HZ   0x0CU   /* accel only */
+#define ICM42688P_ODR_CODE_3_125HZ  0x0DU   /* accel only */
+#define ICM42688P_ODR_CODE_1_5625HZ 0x0EU   /* accel only */
+#define ICM42688P_ODR_CODE_500HZ    0x0FU
+#define ICM42688P_ODR_CODES         16U
+
+/* Full-scale codes per sensor */
+#define ICM42688P_ACCEL_FS_CODES    4U
+#define ICM42688P_GYRO_FS_CODES     8U
+
+/* Noise spectral densities (datasheet typical, low-noise mode) */
+#define ICM42688P_ACCEL_NOISE_DENSITY   70.0e-6f   /* g/sqrt(Hz) */
+#define ICM42688P_GYRO_NOISE_DENSITY    0.0028f    /* dps/sqrt(Hz) */
 
 
 #define ICM42688P_REG_INT_ENABLE           0x53U   // INT_ENABLE register (example address; replace with datasheet value)
@@ -180,6 +329,30 @@ extern "C" {
 #define ICM42688P_INT1_MODE                 (1U << 2)  // Bit 2: INT1 mode (0=pulsed, 1=latched)
 #define ICM42688P_REG_INT_SOURCE0                 0x65U
 #define ICM42688P_INT_SOURCE0_UI_DRDY_INT1_EN     (1 << 3)
+#define ICM42688P_INT_SOURCE0_FIFO_THS_INT1_EN    (1 << 2)
+#define ICM42688P_INT_SOURCE0_FIFO_FULL_INT1_EN   (1 << 1)
+#define ICM42688P_REG_INT_SOURCE3                 0x68U
+#define ICM42688P_INT_SOURCE3_UI_DRDY_INT2_EN     (1 << 3)
+#define ICM42688P_INT_SOURCE3_FIFO_THS_INT2_EN    (1 << 2)
+#define ICM42688P_INT_SOURCE3_FIFO_FULL_INT2_EN   (1 << 1)
+
+#define ICM42688P_INT2_POLARITY            (1U << 3)  // Bit 3: INT2 polarity (0=active-low, 1=active-high)
+#define ICM42688P_INT2_DRIVE_CIRCUIT       (1U << 4)  // Bit 4: INT2 drive circuit (0=open-drain, 1=push-pull)
+#define ICM42688P_INT2_MODE                (1U << 5)  // Bit 5: INT2 mode (0=pulsed, 1=latched)
+
+/* INT_STATUS (0x2D) remaining sources, DATA_RDY above */
+#define ICM42688P_INT_STATUS0_UI_FSYNC     (1U << 6)
+#define ICM42688P_INT_STATUS0_PLL_RDY      (1U << 5)
+#define ICM42688P_INT_STATUS0_RESET_DONE   (1U << 4)
+#define ICM42688P_INT_STATUS0_FIFO_THS     (1U << 2)
+#define ICM42688P_INT_STATUS0_FIFO_FULL    (1U << 1)
+#define ICM42688P_INT_STATUS0_AGC_RDY      (1U << 0)
+
+/* INT_CONFIG1 (0x64) */
+#define ICM42688P_REG_INT_CONFIG1                 0x64U
+#define ICM42688P_INT_CONFIG1_TPULSE_DURATION     (1U << 6)  // 1 = 8 us pulses, required for ODR >= 4 kHz
+#define ICM42688P_INT_CONFIG1_TDEASSERT_DISABLE   (1U << 5)  // 1 = no 100 us de-assert, required for ODR >= 4 kHz
+#define ICM42688P_INT_CONFIG1_ASYNC_RESET         (1U << 4)  // must be cleared for correct INT operation
 
 #ifdef __cplusplus
 }
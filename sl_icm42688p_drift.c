@@ -0,0 +1,96 @@
+/***************************************************************************//**
+ * @file
+ * @brief Sensor ODR drift estimation for the ICM42688P driver
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ ******************************************************************************/
+
+#include "sl_icm42688p_drift.h"
+#include <string.h>
+
+#define DRIFT_RATE_ONE     (1UL << 30)
+
+/* Longest window: keeps the Q30 division below within 64 bits */
+#define DRIFT_MAX_SPAN     (1UL << 24)
+
+/* num / den in Q30, num and den below 2^54, by long division */
+static uint32_t drift_div_q30(uint64_t num, uint64_t den)
+{
+  uint64_t q = num / den;
+  uint64_t r = num % den;
+
+  for (uint8_t i = 0; i < 3U; ++i) {
+    r <<= 10;
+    q = (q << 10) | (r / den);
+    r %= den;
+  }
+
+  return (uint32_t)q;
+}
+
+void sl_icm42688p_drift_init(sl_icm42688p_drift_t *drift, uint32_t tick_hz, uint32_t min_span, uint8_t smooth_shift)
+{
+  memset(drift, 0, sizeof(*drift));
+  drift->tick_hz = tick_hz;
+  drift->min_span = min_span ? min_span : 1U;
+  drift->smooth_shift = smooth_shift;
+  drift->rate_q30 = DRIFT_RATE_ONE;
+}
+
+bool sl_icm42688p_drift_observe(sl_icm42688p_drift_t *drift, uint64_t sensor_ns, uint64_t ticks)
+{
+  uint64_t span_ticks;
+  uint64_t span_ns;
+  uint32_t rate;
+  uint32_t limit = (uint32_t)(((uint64_t)DRIFT_RATE_ONE * SL_ICM42688P_DRIFT_MAX_PPM) / 1000000U);
+
+  if (!drift->ref_valid || sensor_ns <= drift->ref_sensor_ns || ticks < drift->ref_ticks) {
+    goto restart;
+  }
+
+  span_ticks = ticks - drift->ref_ticks;
+  span_ns = sensor_ns - drift->ref_sensor_ns;
+  if (span_ticks < drift->min_span) {
+    return false;
+  }
+  if (span_ticks > DRIFT_MAX_SPAN) {
+    goto restart;
+  }
+
+  rate = drift_div_q30(span_ticks * 1000000000U, span_ns * drift->tick_hz);
+  if (rate > DRIFT_RATE_ONE + limit || rate < DRIFT_RATE_ONE - limit) {
+    drift->rejected++;
+    goto restart;
+  }
+
+  if (!drift->estimated) {
+    drift->estimated = true;
+    drift->rate_q30 = rate;
+  } else {
+    drift->rate_q30 = (uint32_t)((int32_t)drift->rate_q30
+                                 + (((int32_t)rate - (int32_t)drift->rate_q30) >> drift->smooth_shift));
+  }
+  drift->updates++;
+
+  drift->ref_sensor_ns = sensor_ns;
+  drift->ref_ticks = ticks;
+  return true;
+
+restart:
+  drift->ref_valid = true;
+  drift->ref_sensor_ns = sensor_ns;
+  drift->ref_ticks = ticks;
+  return false;
+}
+
+uint32_t sl_icm42688p_drift_period_ns(const sl_icm42688p_drift_t *drift, uint32_t nominal_ns)
+{
+  return (uint32_t)(((uint64_t)nominal_ns * drift->rate_q30 + (DRIFT_RATE_ONE / 2U)) >> 30);
+}
+
+int32_t sl_icm42688p_drift_error_ppb(const sl_icm42688p_drift_t *drift)
+{
+  return (int32_t)((((int64_t)DRIFT_RATE_ONE - (int64_t)drift->rate_q30) * 1000000000) / (int64_t)drift->rate_q30);
+}
@@ -0,0 +1,68 @@
+/***************************************************************************//**
+ * @file
+ * @brief Sensor ODR drift estimation for the ICM42688P driver
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * The sensor's RC oscillator sets its ODR, so the nominal rate is never
+ * exact against the sleeptimer. Pairs of (sensor time, sleeptimer ticks) of
+ * the same event are compared over windows of at least min_span ticks; each
+ * window gives a rate that is smoothed by 1/2^smooth_shift. Sensor time is
+ * the extended TMST or the sample index times the nominal period.
+ *
+ * Pure integer logic with no hardware access, so it runs on a host.
+ ******************************************************************************/
+
+#ifndef SL_ICM42688P_DRIFT_H
+#define SL_ICM42688P_DRIFT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Windows measuring a rate further than this from nominal are discarded */
+#define SL_ICM42688P_DRIFT_MAX_PPM   50000U
+
+typedef struct {
+  /* Configuration */
+  uint32_t tick_hz;         /* sleeptimer frequency */
+  uint32_t min_span;        /* shortest window, ticks */
+  uint8_t  smooth_shift;
+
+  /* Window start */
+  bool     ref_valid;
+  uint64_t ref_sensor_ns;
+  uint64_t ref_ticks;
+
+  /* Estimate: sleeptimer time per unit of sensor time, Q30 (1.0 = nominal) */
+  bool     estimated;
+  uint32_t rate_q30;
+
+  /* Counters */
+  uint32_t updates;
+  uint32_t rejected;        /* implausible windows: lost samples, ODR change */
+} sl_icm42688p_drift_t;
+
+void sl_icm42688p_drift_init(sl_icm42688p_drift_t *drift, uint32_t tick_hz, uint32_t min_span, uint8_t smooth_shift);
+
+/* One event seen at sensor_ns by the sensor and at ticks by the sleeptimer.
+   true when it closed a window and the estimate moved. */
+bool sl_icm42688p_drift_observe(sl_icm42688p_drift_t *drift, uint64_t sensor_ns, uint64_t ticks);
+
+/* Actual sample period in sleeptimer time for the given nominal period */
+uint32_t sl_icm42688p_drift_period_ns(const sl_icm42688p_drift_t *drift, uint32_t nominal_ns);
+
+/* ODR error against nominal in parts per billion, positive when the sensor
+   runs fast */
+int32_t sl_icm42688p_drift_error_ppb(const sl_icm42688p_drift_t *drift);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_ICM42688P_DRIFT_H
@@ -0,0 +1,216 @@
+/***************************************************************************//**
+ * @file
+ * @brief FIFO packet parser for the TDK InvenSense ICM42688P sensor
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ ******************************************************************************/
+
+#include "sl_icm42688p_fifo.h"
+
+/* 8-bit FIFO temperature is 2.07 LSB/degC, the register is 132.48: x64 */
+#define FIFO_TEMP8_TO_TEMP16   64
+
+/* Byte offsets in packets 3 and 4 */
+#define FIFO_PACKET3_TMST      14U
+#define FIFO_PACKET4_TEMP      13U
+#define FIFO_PACKET4_TMST      15U
+#define FIFO_PACKET4_EXT       17U   /* X, Y, Z: accel bits 3:0 high nibble, gyro low */
+
+/* Local helpers */
+static inline int16_t fifo_be16(const uint8_t *buf)
+{
+  return (int16_t)(((uint16_t)buf[0] << 8) | buf[1]);
+}
+
+static void fifo_read_axes(const uint8_t *buf, int32_t axes[3])
+{
+  axes[0] = fifo_be16(&buf[0]);
+  axes[1] = fifo_be16(&buf[2]);
+  axes[2] = fifo_be16(&buf[4]);
+}
+
+/* Bits 19:4 from the main field, 3:0 from a nibble of the extension bytes */
+static void fifo_read_axes20(const uint8_t *buf, const uint8_t *ext, uint8_t ext_shift, int32_t axes[3])
+{
+  for (uint8_t i = 0; i < 3U; ++i) {
+    axes[i] = (int32_t)fifo_be16(&buf[2U * i]) * 16 + (int32_t)((ext[i] >> ext_shift) & 0x0FU);
+  }
+}
+
+static void fifo_set_invalid(int32_t axes[3], int32_t invalid)
+{
+  axes[0] = axes[1] = axes[2] = invalid;
+}
+
+static bool fifo_axes_valid(const int32_t axes[3])
+{
+  return axes[0] != SL_ICM42688P_FIFO_INVALID_DATA && axes[0] != SL_ICM42688P_FIFO_INVALID_DATA_20;
+}
+
+/* What the timestamp field of a packet 3 or 4 holds */
+static uint8_t fifo_timestamp_flags(uint8_t header)
+{
+  switch (header & SL_ICM42688P_FIFO_HEADER_TMST_MASK) {
+    case SL_ICM42688P_FIFO_HEADER_TMST:
+      return SL_ICM42688P_FIFO_SAMPLE_TIMESTAMP;
+    case SL_ICM42688P_FIFO_HEADER_FSYNC:
+      return SL_ICM42688P_FIFO_SAMPLE_FSYNC;
+    default:
+      return 0;
+  }
+}
+
+/* ----- Packet sizes ----- */
+size_t sl_icm42688p_fifo_packet_size(uint8_t header)
+{
+  bool accel = (header & SL_ICM42688P_FIFO_HEADER_ACCEL) != 0;
+  bool gyro  = (header & SL_ICM42688P_FIFO_HEADER_GYRO) != 0;
+
+  if (header & SL_ICM42688P_FIFO_HEADER_MSG) {
+    return 0;
+  }
+
+  if (header & SL_ICM42688P_FIFO_HEADER_20) {
+    return SL_ICM42688P_FIFO_PACKET4_SIZE;
+  }
+  if (accel && gyro) {
+    return SL_ICM42688P_FIFO_PACKET3_SIZE;
+  }
+  if (accel) {
+    return SL_ICM42688P_FIFO_PACKET1_SIZE;
+  }
+  if (gyro) {
+    return SL_ICM42688P_FIFO_PACKET2_SIZE;
+  }
+  return 0;
+}
+
+size_t sl_icm42688p_fifo_packet_type_size(sl_icm42688p_fifo_packet_t packet)
+{
+  switch (packet) {
+    case SL_ICM42688P_FIFO_PACKET_ACCEL:
+      return SL_ICM42688P_FIFO_PACKET1_SIZE;
+    case SL_ICM42688P_FIFO_PACKET_GYRO:
+      return SL_ICM42688P_FIFO_PACKET2_SIZE;
+    case SL_ICM42688P_FIFO_PACKET_ACCEL_GYRO:
+      return SL_ICM42688P_FIFO_PACKET3_SIZE;
+    case SL_ICM42688P_FIFO_PACKET_HIRES:
+      return SL_ICM42688P_FIFO_PACKET4_SIZE;
+    default:
+      return 0;
+  }
+}
+
+/* ----- Parser ----- */
+size_t sl_icm42688p_fifo_parse(const uint8_t *buf,
+                               size_t len,
+                               sl_icm42688p_fifo_sample_t *samples,
+                               size_t max_samples,
+                               size_t *consumed)
+{
+  size_t pos = 0;
+  size_t n = 0;
+
+  while (buf && samples && n < max_samples && pos < len) {
+    const uint8_t *pkt = &buf[pos];
+    size_t size = sl_icm42688p_fifo_packet_size(pkt[0]);
+    sl_icm42688p_fifo_sample_t *s = &samples[n];
+
+    if (size == 0 || (len - pos) < size) {
+      break;
+    }
+
+    s->header = pkt[0];
+    s->flags = 0;
+    s->timestamp = 0;
+
+    switch (size) {
+      case SL_ICM42688P_FIFO_PACKET4_SIZE:
+        /* header, accel[6], gyro[6], temp16, TMST[2], ext[3] */
+        fifo_read_axes20(&pkt[1], &pkt[FIFO_PACKET4_EXT], 4U, s->accel);
+        fifo_read_axes20(&pkt[7], &pkt[FIFO_PACKET4_EXT], 0U, s->gyro);
+        s->temperature = fifo_be16(&pkt[FIFO_PACKET4_TEMP]);
+        s->timestamp = (uint16_t)fifo_be16(&pkt[FIFO_PACKET4_TMST]);
+        s->flags |= fifo_timestamp_flags(pkt[0]);
+        break;
+
+      case SL_ICM42688P_FIFO_PACKET3_SIZE:
+        /* header, accel[6], gyro[6], temp8, TMST[2] */
+        fifo_read_axes(&pkt[1], s->accel);
+        fifo_read_axes(&pkt[7], s->gyro);
+        s->temperature = (int16_t)((int8_t)pkt[13] * FIFO_TEMP8_TO_TEMP16);
+        s->timestamp = (uint16_t)fifo_be16(&pkt[FIFO_PACKET3_TMST]);
+        s->flags |= fifo_timestamp_flags(pkt[0]);
+        break;
+
+      default:
+        /* header, accel[6] or gyro[6], temp8 */
+        if (pkt[0] & SL_ICM42688P_FIFO_HEADER_ACCEL) {
+          fifo_read_axes(&pkt[1], s->accel);
+          fifo_set_invalid(s->gyro, SL_ICM42688P_FIFO_INVALID_DATA);
+        } else {
+          fifo_read_axes(&pkt[1], s->gyro);
+          fifo_set_invalid(s->accel, SL_ICM42688P_FIFO_INVALID_DATA);
+        }
+        s->temperature = (int16_t)((int8_t)pkt[7] * FIFO_TEMP8_TO_TEMP16);
+        break;
+    }
+
+    if ((pkt[0] & SL_ICM42688P_FIFO_HEADER_ACCEL) && fifo_axes_valid(s->accel)) {
+      s->flags |= SL_ICM42688P_FIFO_SAMPLE_ACCEL;
+    }
+    if ((pkt[0] & SL_ICM42688P_FIFO_HEADER_GYRO) && fifo_axes_valid(s->gyro)) {
+      s->flags |= SL_ICM42688P_FIFO_SAMPLE_GYRO;
+    }
+
+    pos += size;
+    n++;
+  }
+
+  if (consumed) {
+    *consumed = pos;
+  }
+
+  return n;
+}
+
+/* ----- Packet fields ----- */
+/* The 16-bit timestamp field, when the header says it holds what */
+static bool fifo_packet_timestamp_field(const uint8_t *pkt, uint8_t what, uint16_t *value)
+{
+  size_t size = sl_icm42688p_fifo_packet_size(pkt[0]);
+
+  if ((pkt[0] & SL_ICM42688P_FIFO_HEADER_TMST_MASK) != what) {
+    return false;
+  }
+
+  if (size == SL_ICM42688P_FIFO_PACKET4_SIZE) {
+    *value = (uint16_t)fifo_be16(&pkt[FIFO_PACKET4_TMST]);
+  } else if (size == SL_ICM42688P_FIFO_PACKET3_SIZE) {
+    *value = (uint16_t)fifo_be16(&pkt[FIFO_PACKET3_TMST]);
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool sl_icm42688p_fifo_packet_tmst(const uint8_t *pkt, uint16_t *tmst)
+{
+  return fifo_packet_timestamp_field(pkt, SL_ICM42688P_FIFO_HEADER_TMST, tmst);
+}
+
+bool sl_icm42688p_fifo_packet_fsync(const uint8_t *pkt, uint16_t *delta)
+{
+  return fifo_packet_timestamp_field(pkt, SL_ICM42688P_FIFO_HEADER_FSYNC, delta);
+}
+
+void sl_icm42688p_fifo_to_raw(const sl_icm42688p_fifo_sample_t *sample, sl_icm42688p_raw_sample_t *raw)
+{
+  raw->data[SL_ICM42688P_RAW_TEMP] = sample->temperature;
+  for (uint8_t i = 0; i < 3U; ++i) {
+    raw->data[SL_ICM42688P_RAW_ACCEL_X + i] = sample->accel[i];
+    raw->data[SL_ICM42688P_RAW_GYRO_X + i] = sample->gyro[i];
+  }
+}
@@ -0,0 +1,106 @@
+/***************************************************************************//**
+ * @file
+ * @brief FIFO packet parser for the TDK InvenSense ICM42688P sensor
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Plain C, no SDK dependencies: builds unchanged on a Linux host.
+ ******************************************************************************/
+
+#ifndef SL_ICM42688P_FIFO_H
+#define SL_ICM42688P_FIFO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "sl_icm42688p_sample.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* FIFO packet formats (datasheet section 6.1) */
+typedef enum {
+  SL_ICM42688P_FIFO_PACKET_ACCEL      = 1,  /* header + accel + temp8, 8 bytes */
+  SL_ICM42688P_FIFO_PACKET_GYRO       = 2,  /* header + gyro + temp8, 8 bytes */
+  SL_ICM42688P_FIFO_PACKET_ACCEL_GYRO = 3,  /* header + accel + gyro + temp8 + TMST, 16 bytes */
+  SL_ICM42688P_FIFO_PACKET_HIRES      = 4,  /* packet 3 with temp16 and 20-bit accel + gyro, 20 bytes */
+} sl_icm42688p_fifo_packet_t;
+
+/* Packet sizes in bytes */
+#define SL_ICM42688P_FIFO_PACKET1_SIZE       8U
+#define SL_ICM42688P_FIFO_PACKET2_SIZE       8U
+#define SL_ICM42688P_FIFO_PACKET3_SIZE       16U
+#define SL_ICM42688P_FIFO_PACKET4_SIZE       20U
+#define SL_ICM42688P_FIFO_MAX_PACKET_SIZE    SL_ICM42688P_FIFO_PACKET4_SIZE
+
+/* Packet header bits */
+#define SL_ICM42688P_FIFO_HEADER_MSG         (1U << 7)  /* FIFO empty / invalid packet */
+#define SL_ICM42688P_FIFO_HEADER_ACCEL       (1U << 6)
+#define SL_ICM42688P_FIFO_HEADER_GYRO        (1U << 5)
+#define SL_ICM42688P_FIFO_HEADER_20          (1U << 4)  /* 20-bit (packet 4) */
+#define SL_ICM42688P_FIFO_HEADER_TMST_MASK   (3U << 2)
+#define SL_ICM42688P_FIFO_HEADER_TMST        (2U << 2)  /* timestamp field holds TMST */
+#define SL_ICM42688P_FIFO_HEADER_FSYNC       (3U << 2)  /* timestamp field holds FSYNC delta */
+#define SL_ICM42688P_FIFO_HEADER_ODR_ACCEL   (1U << 1)
+#define SL_ICM42688P_FIFO_HEADER_ODR_GYRO    (1U << 0)
+
+/* Sample flags */
+#define SL_ICM42688P_FIFO_SAMPLE_ACCEL       (1U << 0)  /* accel[] valid */
+#define SL_ICM42688P_FIFO_SAMPLE_GYRO        (1U << 1)  /* gyro[] valid */
+#define SL_ICM42688P_FIFO_SAMPLE_TIMESTAMP   (1U << 2)  /* timestamp holds TMST */
+#define SL_ICM42688P_FIFO_SAMPLE_FSYNC       (1U << 3)  /* first packet after FSYNC; timestamp holds the delta */
+
+/* Value written by the sensor for a disabled or not-yet-valid axis */
+#define SL_ICM42688P_FIFO_INVALID_DATA       (-32768)
+#define SL_ICM42688P_FIFO_INVALID_DATA_20    (-524288)   /* packet 4 */
+
+/* One parsed FIFO packet. temperature is normalised to the TEMP_DATA
+   register scale (132.48 LSB/degC, 25 degC offset) for every packet type.
+   Packets 1-3 carry 16-bit axes at the configured full scale; packet 4
+   carries 20-bit axes at a fixed ICM42688P_HIRES_xxx_SENSITIVITY, whatever
+   FS_SEL says. */
+typedef struct {
+  int32_t  accel[3];
+  int32_t  gyro[3];
+  int16_t  temperature;
+  uint16_t timestamp;
+  uint8_t  header;
+  uint8_t  flags;
+} sl_icm42688p_fifo_sample_t;
+
+/* Size of the packet introduced by header, or 0 if it marks an empty FIFO */
+size_t sl_icm42688p_fifo_packet_size(uint8_t header);
+
+/* Size of the packets produced by the given format */
+size_t sl_icm42688p_fifo_packet_type_size(sl_icm42688p_fifo_packet_t packet);
+
+/* Parse big-endian FIFO bytes into samples. Stops at an empty-FIFO header, a
+   truncated packet or when max_samples is reached. Returns the number of
+   samples written; *consumed (optional) receives the bytes parsed. */
+size_t sl_icm42688p_fifo_parse(const uint8_t *buf,
+                               size_t len,
+                               sl_icm42688p_fifo_sample_t *samples,
+                               size_t max_samples,
+                               size_t *consumed);
+
+/* TMST of a packet 3 or 4; false if the packet has none or its timestamp
+   field holds something else */
+bool sl_icm42688p_fifo_packet_tmst(const uint8_t *pkt, uint16_t *tmst);
+
+/* FSYNC delta of a packet 3 or 4 tagged as the first after an FSYNC edge:
+   TMST LSBs from the edge to the packet's sample. false for other packets,
+   whose timestamp field holds TMST or nothing. */
+bool sl_icm42688p_fifo_packet_fsync(const uint8_t *pkt, uint16_t *delta);
+
+/* Parsed packet to the raw sample layout. Absent axes keep the invalid
+   marker of their packet type. */
+void sl_icm42688p_fifo_to_raw(const sl_icm42688p_fifo_sample_t *sample, sl_icm42688p_raw_sample_t *raw);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_ICM42688P_FIFO_H
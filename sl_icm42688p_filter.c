@@ -0,0 +1,212 @@
+/***************************************************************************//**
+ * @file
+ * @brief On-sensor filter settings for the TDK InvenSense ICM42688P sensor
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ ******************************************************************************/
+
+#include "sl_icm42688p_filter.h"
+#include "sl_icm42688p_defs.h"
+#include <math.h>
+#include <stddef.h>
+
+/* Ratio between two positive bandwidths, >= 1 */
+#define FILTER_RATIO(a, b)   (((a) > (b)) ? (a) / (b) : (b) / (a))
+
+/* ----- UI filter ----- */
+/* Code 0 is ODR / 2; codes 1 to 7 divide max(400 Hz, ODR) */
+static const uint8_t ui_bw_divisor[] = { 2U, 4U, 5U, 8U, 10U, 16U, 20U, 40U };
+
+uint8_t sl_icm42688p_ui_filter_bw_code(float bw_hz, uint32_t odr_period_ns, float *actual_hz)
+{
+  float odr = 1.0e9f / (float)odr_period_ns;
+  float best_bw = 0.0f;
+  float best_ratio = 0.0f;
+  uint8_t best = ICM42688P_UI_FILT_BW_LOW_LATENCY;
+
+  if (bw_hz > 0.0f) {
+    for (uint8_t code = 0; code < sizeof(ui_bw_divisor); ++code) {
+      float base = (code == 0 || odr > 400.0f) ? odr : 400.0f;
+      float bw = base / (float)ui_bw_divisor[code];
+      float ratio = FILTER_RATIO(bw, bw_hz);
+
+      if (code == 0 || ratio < best_ratio) {
+        best = code;
+        best_bw = bw;
+        best_ratio = ratio;
+      }
+    }
+  }
+
+  if (actual_hz) {
+    *actual_hz = best_bw;
+  }
+  return best;
+}
+
+/* ----- Anti-alias filter ----- */
+/* Datasheet table, indexed by AAF_DELT - 1 */
+typedef struct {
+  uint16_t bw_hz;
+  uint16_t deltsqr;
+  uint8_t  bitshift;
+} filter_aaf_entry_t;
+
+static const filter_aaf_entry_t aaf_table[SL_ICM42688P_AAF_DELT_MAX] = {
+  {   42U,    1U, 15U }, {   84U,    4U, 13U }, {  126U,    9U, 12U }, {  170U,   16U, 11U },
+  {  213U,   25U, 10U }, {  258U,   36U, 10U }, {  303U,   49U,  9U }, {  348U,   64U,  9U },
+  {  394U,   81U,  9U }, {  441U,  100U,  8U }, {  488U,  122U,  8U }, {  536U,  144U,  8U },
+  {  585U,  170U,  8U }, {  634U,  196U,  7U }, {  684U,  224U,  7U }, {  734U,  256U,  7U },
+  {  785U,  288U,  7U }, {  837U,  324U,  7U }, {  890U,  360U,  6U }, {  943U,  400U,  6U },
+  {  997U,  440U,  6U }, { 1051U,  488U,  6U }, { 1107U,  528U,  6U }, { 1163U,  576U,  6U },
+  { 1220U,  624U,  6U }, { 1277U,  680U,  6U }, { 1336U,  736U,  5U }, { 1395U,  784U,  5U },
+  { 1454U,  848U,  5U }, { 1515U,  896U,  5U }, { 1577U,  960U,  5U }, { 1639U, 1024U,  5U },
+  { 1702U, 1088U,  5U }, { 1766U, 1152U,  5U }, { 1830U, 1232U,  5U }, { 1896U, 1296U,  5U },
+  { 1962U, 1376U,  4U }, { 2029U, 1440U,  4U }, { 2097U, 1536U,  4U }, { 2166U, 1600U,  4U },
+  { 2235U, 1696U,  4U }, { 2306U, 1760U,  4U }, { 2377U, 1856U,  4U }, { 2449U, 1952U,  4U },
+  { 2522U, 2016U,  4U }, { 2596U, 2112U,  4U }, { 2671U, 2208U,  4U }, { 2746U, 2304U,  4U },
+  { 2823U, 2400U,  4U }, { 2900U, 2496U,  4U }, { 2978U, 2592U,  4U }, { 3057U, 2720U,  4U },
+  { 3137U, 2816U,  3U }, { 3217U, 2944U,  3U }, { 3299U, 3008U,  3U }, { 3381U, 3136U,  3U },
+  { 3464U, 3264U,  3U }, { 3548U, 3392U,  3U }, { 3633U, 3456U,  3U }, { 3718U, 3584U,  3U },
+  { 3805U, 3712U,  3U }, { 3892U, 3840U,  3U }, { 3979U, 3968U,  3U },
+};
+
+uint8_t sl_icm42688p_aaf_delt(float bw_hz, uint16_t *deltsqr, uint8_t *bitshift, float *actual_hz)
+{
+  uint8_t best = 0;
+  float best_ratio = 0.0f;
+
+  if (!(bw_hz > 0.0f)) {
+    bw_hz = (float)aaf_table[0].bw_hz;
+  }
+
+  for (uint8_t i = 0; i < SL_ICM42688P_AAF_DELT_MAX; ++i) {
+    float ratio = FILTER_RATIO((float)aaf_table[i].bw_hz, bw_hz);
+    if (i == 0 || ratio < best_ratio) {
+      best = i;
+      best_ratio = ratio;
+    }
+  }
+
+  if (deltsqr) {
+    *deltsqr = aaf_table[best].deltsqr;
+  }
+  if (bitshift) {
+    *bitshift = aaf_table[best].bitshift;
+  }
+  if (actual_hz) {
+    *actual_hz = (float)aaf_table[best].bw_hz;
+  }
+  return (uint8_t)(best + SL_ICM42688P_AAF_DELT_MIN);
+}
+
+/* ----- Gyro notch filter ----- */
+static const uint16_t notch_bw_hz[] = { 1449U, 680U, 329U, 162U, 80U, 40U, 20U, 10U };
+
+bool sl_icm42688p_notch_coswz(float center_hz, uint16_t *coswz, bool *coswz_sel)
+{
+  /* The notch runs at 32 kHz; near 1 kHz cos() is close to 1, so the
+     sensor takes 8 * (1 - |cos|) instead for resolution */
+  float c;
+  int32_t value;
+
+  if (!(center_hz >= SL_ICM42688P_NOTCH_MIN_HZ && center_hz <= SL_ICM42688P_NOTCH_MAX_HZ)) {
+    return false;
+  }
+
+  c = cosf(2.0f * 3.14159265f * center_hz / 32000.0f);
+  if (fabsf(c) <= 0.875f) {
+    value = (int32_t)lroundf(c * 256.0f);
+    *coswz_sel = false;
+  } else if (c > 0.0f) {
+    value = (int32_t)lroundf(8.0f * (1.0f - c) * 256.0f);
+    *coswz_sel = true;
+  } else {
+    value = (int32_t)lroundf(-8.0f * (1.0f + c) * 256.0f);
+    *coswz_sel = true;
+  }
+
+  *coswz = (uint16_t)((uint32_t)value & 0x1FFU);
+  return true;
+}
+
+uint8_t sl_icm42688p_notch_bw_sel(float bw_hz, float *actual_hz)
+{
+  uint8_t best = 0;
+  float best_ratio = 0.0f;
+
+  if (!(bw_hz > 0.0f)) {
+    bw_hz = (float)notch_bw_hz[0];
+  }
+
+  for (uint8_t i = 0; i < sizeof(notch_bw_hz) / sizeof(notch_bw_hz[0]); ++i) {
+    float ratio = FILTER_RATIO((float)notch_bw_hz[i], bw_hz);
+    if (i == 0 || ratio < best_ratio) {
+      best = i;
+      best_ratio = ratio;
+    }
+  }
+
+  if (actual_hz) {
+    *actual_hz = (float)notch_bw_hz[best];
+  }
+  return best;
+}
+
+/* ----- Complete configuration ----- */
+static void filter_encode_aaf(sl_icm42688p_filter_sensor_t *sensor, bool *dis,
+                              uint8_t *delt, uint16_t *deltsqr, uint8_t *bitshift)
+{
+  float actual;
+
+  *dis = !(sensor->aaf_bw_hz > 0.0f);
+  *delt = sl_icm42688p_aaf_delt(sensor->aaf_bw_hz, deltsqr, bitshift, &actual);
+  sensor->aaf_bw_hz = *dis ? 0.0f : actual;
+}
+
+bool sl_icm42688p_filter_encode(sl_icm42688p_filter_config_t *config,
+                                uint32_t accel_period_ns, uint32_t gyro_period_ns,
+                                sl_icm42688p_filter_regs_t *regs)
+{
+  /* The notch is enabled for all three axes or none */
+  bool notch = (config && (config->notch_hz[0] != 0.0f || config->notch_hz[1] != 0.0f
+                           || config->notch_hz[2] != 0.0f));
+  sl_icm42688p_filter_regs_t out = { 0 };
+
+  if (!config || !regs || accel_period_ns == 0 || gyro_period_ns == 0
+      || config->accel.ui_order < 1U || config->accel.ui_order > 3U
+      || config->gyro.ui_order < 1U || config->gyro.ui_order > 3U) {
+    return false;
+  }
+
+  for (uint8_t axis = 0; notch && axis < 3U; ++axis) {
+    bool sel = false;
+
+    if (!sl_icm42688p_notch_coswz(config->notch_hz[axis], &out.nf_coswz[axis], &sel)) {
+      return false;
+    }
+    out.nf_coswz_sel |= (uint8_t)((sel ? 1U : 0U) << axis);
+  }
+
+  /* Register codes are order - 1 */
+  out.accel_ui_ord = (uint8_t)(config->accel.ui_order - 1U);
+  out.gyro_ui_ord = (uint8_t)(config->gyro.ui_order - 1U);
+  out.accel_ui_bw = sl_icm42688p_ui_filter_bw_code(config->accel.ui_bw_hz, accel_period_ns, &config->accel.ui_bw_hz);
+  out.gyro_ui_bw = sl_icm42688p_ui_filter_bw_code(config->gyro.ui_bw_hz, gyro_period_ns, &config->gyro.ui_bw_hz);
+
+  filter_encode_aaf(&config->accel, &out.accel_aaf_dis, &out.accel_aaf_delt,
+                    &out.accel_aaf_deltsqr, &out.accel_aaf_bitshift);
+  filter_encode_aaf(&config->gyro, &out.gyro_aaf_dis, &out.gyro_aaf_delt,
+                    &out.gyro_aaf_deltsqr, &out.gyro_aaf_bitshift);
+
+  out.nf_dis = !notch;
+  out.nf_bw_sel = sl_icm42688p_notch_bw_sel(config->notch_bw_hz, &config->notch_bw_hz);
+  if (!notch) {
+    config->notch_bw_hz = 0.0f;
+  }
+
+  *regs = out;
+  return true;
+}
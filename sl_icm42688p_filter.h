@@ -0,0 +1,94 @@
+/***************************************************************************//**
+ * @file
+ * @brief On-sensor filter settings for the TDK InvenSense ICM42688P sensor
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Bandwidths in Hz to register codes for the three filters in the sensor's
+ * signal path: the anti-alias filter (AAF) after the ADC, the gyro notch
+ * filter, and the UI filter in front of the data registers and FIFO. Each
+ * request is mapped to the nearest setting the sensor supports, and the
+ * bandwidth actually set is written back.
+ *
+ * Plain C, no SDK dependencies: builds unchanged on a Linux host.
+ ******************************************************************************/
+
+#ifndef SL_ICM42688P_FILTER_H
+#define SL_ICM42688P_FILTER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* AAF_DELT range; the -3 dB bandwidth goes from 42 Hz to 3979 Hz */
+#define SL_ICM42688P_AAF_DELT_MIN     1U
+#define SL_ICM42688P_AAF_DELT_MAX     63U
+
+/* Notch centre frequency range, Hz */
+#define SL_ICM42688P_NOTCH_MIN_HZ     1000.0f
+#define SL_ICM42688P_NOTCH_MAX_HZ     3000.0f
+
+/* Filters of one sensor */
+typedef struct {
+  uint8_t ui_order;         /* UI filter order, 1 to 3 */
+  float   ui_bw_hz;         /* UI filter -3 dB bandwidth; 0 = low latency, no UI filter */
+  float   aaf_bw_hz;        /* anti-alias filter -3 dB bandwidth; 0 = bypassed */
+} sl_icm42688p_filter_sensor_t;
+
+typedef struct {
+  sl_icm42688p_filter_sensor_t accel;
+  sl_icm42688p_filter_sensor_t gyro;
+  float notch_hz[3];        /* gyro notch centre per axis, 1 kHz to 3 kHz; all 0 = off */
+  float notch_bw_hz;        /* notch bandwidth, shared by the three axes */
+} sl_icm42688p_filter_config_t;
+
+/* Register fields for a filter configuration */
+typedef struct {
+  uint8_t  accel_ui_ord;    /* ACCEL_UI_FILT_ORD */
+  uint8_t  gyro_ui_ord;     /* GYRO_UI_FILT_ORD */
+  uint8_t  accel_ui_bw;     /* ACCEL_UI_FILT_BW */
+  uint8_t  gyro_ui_bw;      /* GYRO_UI_FILT_BW */
+  bool     accel_aaf_dis;
+  uint8_t  accel_aaf_delt;
+  uint16_t accel_aaf_deltsqr;
+  uint8_t  accel_aaf_bitshift;
+  bool     gyro_aaf_dis;
+  uint8_t  gyro_aaf_delt;
+  uint16_t gyro_aaf_deltsqr;
+  uint8_t  gyro_aaf_bitshift;
+  bool     nf_dis;
+  uint16_t nf_coswz[3];     /* 9-bit two's complement */
+  uint8_t  nf_coswz_sel;    /* bit per axis, X in bit 0 */
+  uint8_t  nf_bw_sel;       /* GYRO_NF_BW_SEL */
+} sl_icm42688p_filter_regs_t;
+
+/* UI filter bandwidth code nearest bw_hz, by ratio, at the given ODR
+   (low-noise mode). actual_hz may be NULL. */
+uint8_t sl_icm42688p_ui_filter_bw_code(float bw_hz, uint32_t odr_period_ns, float *actual_hz);
+
+/* AAF_DELT nearest bw_hz, by ratio, with its DELTSQR and BITSHIFT */
+uint8_t sl_icm42688p_aaf_delt(float bw_hz, uint16_t *deltsqr, uint8_t *bitshift, float *actual_hz);
+
+/* Notch coefficient for a centre frequency in range; false otherwise */
+bool sl_icm42688p_notch_coswz(float center_hz, uint16_t *coswz, bool *coswz_sel);
+
+/* GYRO_NF_BW_SEL nearest bw_hz, by ratio */
+uint8_t sl_icm42688p_notch_bw_sel(float bw_hz, float *actual_hz);
+
+/* Every field for config at the given accel and gyro ODRs. The bandwidths
+   set are written back into config. false if an order or notch frequency
+   is out of range, in which case neither config nor regs is touched. */
+bool sl_icm42688p_filter_encode(sl_icm42688p_filter_config_t *config,
+                                uint32_t accel_period_ns, uint32_t gyro_period_ns,
+                                sl_icm42688p_filter_regs_t *regs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_ICM42688P_FILTER_H
@@ -0,0 +1,206 @@
+/***************************************************************************//**
+ * @file
+ * @brief Time-aligned merge of accel and gyro streams for the ICM42688P driver
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ ******************************************************************************/
+
+#include "sl_icm42688p_merge.h"
+#include <string.h>
+
+#define MERGE_FIELDS   2U
+
+/* Field layout: accel then gyro, three words each */
+static const uint8_t merge_first_word[MERGE_FIELDS] = { SL_ICM42688P_RAW_ACCEL_X, SL_ICM42688P_RAW_GYRO_X };
+static const uint8_t merge_fresh[MERGE_FIELDS] = { SL_ICM42688P_SAMPLE_ACCEL_FRESH, SL_ICM42688P_SAMPLE_GYRO_FRESH };
+static const uint8_t merge_interp[MERGE_FIELDS] = { SL_ICM42688P_SAMPLE_ACCEL_INTERP, SL_ICM42688P_SAMPLE_GYRO_INTERP };
+
+static void merge_hold(const sl_icm42688p_merge_t *merge, sl_icm42688p_merge_slot_t *slot, uint8_t f)
+{
+  memcpy(&slot->record.raw.data[merge_first_word[f]], merge->field[f].value, sizeof(merge->field[f].value));
+  slot->unresolved &= (uint8_t)~(1U << f);
+}
+
+/* Put out resolved records from the head; force = hold whatever is left */
+static uint32_t merge_emit(sl_icm42688p_merge_t *merge, bool force,
+                           sl_icm42688p_merge_output_t output, void *context)
+{
+  uint32_t count = 0;
+
+  while (merge->count > 0) {
+    sl_icm42688p_merge_slot_t *slot = &merge->pending[merge->head];
+
+    if (slot->unresolved) {
+      if (!force) {
+        break;
+      }
+      for (uint8_t f = 0; f < MERGE_FIELDS; ++f) {
+        if (slot->unresolved & (1U << f)) {
+          merge_hold(merge, slot, f);
+        }
+      }
+      merge->forced++;
+    }
+
+    output(&slot->record, context);
+    merge->head = (uint8_t)((merge->head + 1U) % SL_ICM42688P_MERGE_PENDING);
+    merge->count--;
+    merge->outputs++;
+    count++;
+  }
+
+  return count;
+}
+
+/* Queue the record for grid point t_q16 from the fields as they stand */
+static uint32_t merge_create(sl_icm42688p_merge_t *merge, uint64_t t_q16,
+                             sl_icm42688p_merge_output_t output, void *context)
+{
+  uint32_t count = 0;
+  sl_icm42688p_merge_slot_t *slot;
+
+  if (merge->count == SL_ICM42688P_MERGE_PENDING) {
+    /* Only the head needs to go; holding it resolves it */
+    sl_icm42688p_merge_slot_t *head = &merge->pending[merge->head];
+    for (uint8_t f = 0; f < MERGE_FIELDS; ++f) {
+      if (head->unresolved & (1U << f)) {
+        merge_hold(merge, head, f);
+      }
+    }
+    merge->forced++;
+    count += merge_emit(merge, false, output, context);
+  }
+
+  slot = &merge->pending[(merge->head + merge->count) % SL_ICM42688P_MERGE_PENDING];
+  merge->count++;
+
+  slot->t_q16 = t_q16;
+  slot->unresolved = 0;
+  slot->record.timestamp = (t_q16 + 0x8000U) >> 16;
+  slot->record.flags = 0;
+  slot->record.fsync_q16 = 0;
+  slot->record.raw.data[SL_ICM42688P_RAW_TEMP] = merge->temperature;
+
+  if (merge->fsync_pending && t_q16 >= merge->fsync_edge_q16) {
+    slot->record.flags |= SL_ICM42688P_SAMPLE_FSYNC;
+    slot->record.fsync_q16 = (uint32_t)(t_q16 - merge->fsync_edge_q16);
+    merge->fsync_pending = false;
+  }
+
+  for (uint8_t f = 0; f < MERGE_FIELDS; ++f) {
+    sl_icm42688p_merge_field_t *field = &merge->field[f];
+
+    if (field->fresh) {
+      slot->record.flags |= merge_fresh[f];
+      field->fresh = false;
+    }
+
+    /* Interpolated fields keep the held value until the next measurement */
+    merge_hold(merge, slot, f);
+    if (merge->mode == SL_ICM42688P_MERGE_INTERPOLATE && field->t_q16 != t_q16) {
+      slot->unresolved |= (uint8_t)(1U << f);
+    }
+  }
+
+  return count;
+}
+
+/* Measurement of field f at t_q16: fills the records waiting for it */
+static void merge_apply(sl_icm42688p_merge_t *merge, uint8_t f, uint64_t t_q16, const int32_t *value)
+{
+  sl_icm42688p_merge_field_t *field = &merge->field[f];
+  uint64_t span = t_q16 - field->t_q16;
+
+  for (uint8_t i = 0; i < merge->count; ++i) {
+    sl_icm42688p_merge_slot_t *slot = &merge->pending[(merge->head + i) % SL_ICM42688P_MERGE_PENDING];
+    int32_t *out = &slot->record.raw.data[merge_first_word[f]];
+    int64_t frac;
+
+    if (!(slot->unresolved & (1U << f))) {
+      continue;
+    }
+
+    /* Position of the grid point between the two measurements, Q16 */
+    frac = (span > 0) ? (int64_t)(((slot->t_q16 - field->t_q16) << 16) / span) : 0x10000;
+    for (uint8_t k = 0; k < 3U; ++k) {
+      int32_t a = field->value[k];
+      int32_t b = value[k];
+      out[k] = a + (int32_t)((((int64_t)b - a) * frac + 0x8000) >> 16);
+    }
+    slot->record.flags |= merge_interp[f];
+    slot->unresolved &= (uint8_t)~(1U << f);
+  }
+
+  field->valid = true;
+  field->fresh = true;
+  field->t_q16 = t_q16;
+  memcpy(field->value, value, sizeof(field->value));
+}
+
+void sl_icm42688p_merge_init(sl_icm42688p_merge_t *merge, uint32_t tick_hz, uint32_t period_ns,
+                             sl_icm42688p_merge_mode_t mode)
+{
+  memset(merge, 0, sizeof(*merge));
+  merge->mode = mode;
+  merge->step_q16 = (((uint64_t)period_ns * tick_hz) << 16) / 1000000000U;
+  if (merge->step_q16 == 0) {
+    merge->step_q16 = 1U;
+  }
+}
+
+uint32_t sl_icm42688p_merge_push(sl_icm42688p_merge_t *merge,
+                                 const sl_icm42688p_stamped_sample_t *sample,
+                                 sl_icm42688p_merge_output_t output,
+                                 void *context)
+{
+  uint64_t t_q16 = sample->timestamp << 16;
+  uint32_t count = 0;
+
+  merge->inputs++;
+
+  if (merge->primed && (t_q16 < merge->last_q16
+                        || t_q16 - merge->last_q16 > SL_ICM42688P_MERGE_MAX_GAP * merge->step_q16)) {
+    /* Out of order or a long gap: finish what is queued and start over */
+    count += merge_emit(merge, true, output, context);
+    merge->primed = false;
+    merge->fsync_pending = false;
+    merge->gaps++;
+  }
+
+  /* The edge came before this read, possibly before records still to be
+     made for earlier grid points */
+  if (sample->flags & SL_ICM42688P_SAMPLE_FSYNC) {
+    merge->fsync_pending = true;
+    merge->fsync_edge_q16 = t_q16 - sample->fsync_q16;
+  }
+
+  /* Records strictly before this read see the fields as they were */
+  if (merge->primed) {
+    while (merge->next_q16 < t_q16) {
+      count += merge_create(merge, merge->next_q16, output, context);
+      merge->next_q16 += merge->step_q16;
+    }
+  }
+
+  for (uint8_t f = 0; f < MERGE_FIELDS; ++f) {
+    if ((sample->flags & merge_fresh[f]) || !merge->field[f].valid) {
+      merge_apply(merge, f, t_q16, &sample->raw.data[merge_first_word[f]]);
+    }
+  }
+  merge->temperature = sample->raw.data[SL_ICM42688P_RAW_TEMP];
+  merge->last_q16 = t_q16;
+
+  /* The grid starts at the first read */
+  if (!merge->primed) {
+    merge->primed = true;
+    merge->next_q16 = t_q16;
+  }
+  while (merge->next_q16 <= t_q16) {
+    count += merge_create(merge, merge->next_q16, output, context);
+    merge->next_q16 += merge->step_q16;
+  }
+
+  return count + merge_emit(merge, false, output, context);
+}
@@ -0,0 +1,98 @@
+/***************************************************************************//**
+ * @file
+ * @brief Time-aligned merge of accel and gyro streams for the ICM42688P driver
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * With accel and gyro at different ODRs every read carries both fields, but
+ * only the ones flagged fresh hold a new measurement. The merge puts out one
+ * record per output period, on a grid of sleeptimer time, with each field
+ * either held at its last measurement or interpolated between the two
+ * around the grid point. Interpolation waits for the next measurement of
+ * the field, so records are queued until every field is resolved; a full
+ * queue puts the oldest record out with held values.
+ *
+ * Pure integer logic with no hardware access, so it runs on a host.
+ ******************************************************************************/
+
+#ifndef SL_ICM42688P_MERGE_H
+#define SL_ICM42688P_MERGE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sl_icm42688p_sample.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Records waiting for the next measurement of an interpolated field */
+#ifndef SL_ICM42688P_MERGE_PENDING
+#define SL_ICM42688P_MERGE_PENDING   16U
+#endif
+
+/* A gap between inputs longer than this many output periods restarts the
+   grid */
+#define SL_ICM42688P_MERGE_MAX_GAP   16U
+
+typedef enum {
+  SL_ICM42688P_MERGE_HOLD = 0,          /* last measurement at or before the grid point */
+  SL_ICM42688P_MERGE_INTERPOLATE = 1,   /* linear between the measurements around it */
+} sl_icm42688p_merge_mode_t;
+
+typedef void (*sl_icm42688p_merge_output_t)(const sl_icm42688p_stamped_sample_t *record, void *context);
+
+/* Last measurement of one field */
+typedef struct {
+  bool     valid;
+  bool     fresh;           /* measured since the last record */
+  uint64_t t_q16;
+  int32_t  value[3];
+} sl_icm42688p_merge_field_t;
+
+typedef struct {
+  sl_icm42688p_stamped_sample_t record;
+  uint64_t t_q16;
+  uint8_t  unresolved;      /* fields waiting for their next measurement */
+} sl_icm42688p_merge_slot_t;
+
+typedef struct {
+  uint64_t step_q16;        /* output period, ticks Q16 */
+  sl_icm42688p_merge_mode_t mode;
+  sl_icm42688p_merge_field_t field[2];   /* accel, gyro */
+  int32_t  temperature;
+  bool     fsync_pending;   /* FSYNC edge not yet on a record */
+  uint64_t fsync_edge_q16;
+  bool     primed;
+  uint64_t last_q16;        /* last input */
+  uint64_t next_q16;        /* next grid point */
+  sl_icm42688p_merge_slot_t pending[SL_ICM42688P_MERGE_PENDING];
+  uint8_t  head;
+  uint8_t  count;
+
+  /* Counters */
+  uint32_t inputs;
+  uint32_t outputs;
+  uint32_t forced;          /* records put out held because the queue was full */
+  uint32_t gaps;            /* grid restarts after a long gap */
+} sl_icm42688p_merge_t;
+
+void sl_icm42688p_merge_init(sl_icm42688p_merge_t *merge, uint32_t tick_hz, uint32_t period_ns,
+                             sl_icm42688p_merge_mode_t mode);
+
+/* Feed the next read in time order, with SL_ICM42688P_SAMPLE_xxx_FRESH set
+   on the fields it measured. An FSYNC tag moves to the first record at or
+   after the edge. output is called for every record resolved. Returns the
+   number of records. */
+uint32_t sl_icm42688p_merge_push(sl_icm42688p_merge_t *merge,
+                                 const sl_icm42688p_stamped_sample_t *sample,
+                                 sl_icm42688p_merge_output_t output,
+                                 void *context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_ICM42688P_MERGE_H
@@ -0,0 +1,138 @@
+/***************************************************************************//**
+ * @file
+ * @brief ODR and full-scale tables for the TDK InvenSense ICM42688P sensor
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ ******************************************************************************/
+
+#include "sl_icm42688p_odr.h"
+#include "sl_icm42688p_defs.h"
+#include <stddef.h>
+
+/* ----- ODR ----- */
+/* Rates follow from the exact periods. Per-sample noise is the density
+   squared over the noise bandwidth of the default UI filter,
+   max(400 Hz, ODR) / 4. */
+#define ODR_RATE_HZ(period_ns)    (1.0e9f / (float)(period_ns))
+#define ODR_NOISE_BW(period_ns)   (((period_ns) < 2500000U ? ODR_RATE_HZ(period_ns) : 400.0f) / 4.0f)
+
+#define ODR_ENTRY(code_, period_ns_, modes_)                                             \
+  [code_] = {                                                                            \
+    .code = (code_),                                                                     \
+    .modes = (modes_),                                                                   \
+    .period_ns = (period_ns_),                                                           \
+    .rate_hz = ODR_RATE_HZ(period_ns_),                                                  \
+    .accel_noise_var = ICM42688P_ACCEL_NOISE_DENSITY * ICM42688P_ACCEL_NOISE_DENSITY     \
+                       * ODR_NOISE_BW(period_ns_),                                       \
+    .gyro_noise_var = ICM42688P_GYRO_NOISE_DENSITY * ICM42688P_GYRO_NOISE_DENSITY        \
+                      * ODR_NOISE_BW(period_ns_),                                        \
+  }
+
+#define ODR_LN_ONLY    SL_ICM42688P_ODR_LN
+#define ODR_ANY        (SL_ICM42688P_ODR_LN | SL_ICM42688P_ODR_ACCEL_LP)
+
+static const sl_icm42688p_odr_info_t odr_table[ICM42688P_ODR_CODES] = {
+  ODR_ENTRY(ICM42688P_ODR_CODE_32KHZ,        31250U, ODR_LN_ONLY),
+  ODR_ENTRY(ICM42688P_ODR_CODE_16KHZ,        62500U, ODR_LN_ONLY),
+  ODR_ENTRY(ICM42688P_ODR_CODE_8KHZ,        125000U, ODR_LN_ONLY),
+  ODR_ENTRY(ICM42688P_ODR_CODE_4KHZ,        250000U, ODR_LN_ONLY),
+  ODR_ENTRY(ICM42688P_ODR_CODE_2KHZ,        500000U, ODR_LN_ONLY),
+  ODR_ENTRY(ICM42688P_ODR_CODE_1KHZ,       1000000U, ODR_LN_ONLY),
+  ODR_ENTRY(ICM42688P_ODR_CODE_500HZ,      2000000U, ODR_ANY),
+  ODR_ENTRY(ICM42688P_ODR_CODE_200HZ,      5000000U, ODR_ANY),
+  ODR_ENTRY(ICM42688P_ODR_CODE_100HZ,     10000000U, ODR_ANY),
+  ODR_ENTRY(ICM42688P_ODR_CODE_50HZ,      20000000U, ODR_ANY),
+  ODR_ENTRY(ICM42688P_ODR_CODE_25HZ,      40000000U, ODR_ANY),
+  ODR_ENTRY(ICM42688P_ODR_CODE_12_5HZ,    80000000U, ODR_ANY),
+  ODR_ENTRY(ICM42688P_ODR_CODE_6_25HZ,   160000000U, SL_ICM42688P_ODR_ACCEL_LP),
+  ODR_ENTRY(ICM42688P_ODR_CODE_3_125HZ,  320000000U, SL_ICM42688P_ODR_ACCEL_LP),
+  ODR_ENTRY(ICM42688P_ODR_CODE_1_5625HZ, 640000000U, SL_ICM42688P_ODR_ACCEL_LP),
+};
+
+const sl_icm42688p_odr_info_t *sl_icm42688p_odr_info(uint8_t code)
+{
+  if (code >= ICM42688P_ODR_CODES || odr_table[code].period_ns == 0) {
+    return NULL;
+  }
+  return &odr_table[code];
+}
+
+const sl_icm42688p_odr_info_t *sl_icm42688p_odr_nearest(float rate_hz, uint8_t modes)
+{
+  const sl_icm42688p_odr_info_t *best = NULL;
+  float best_ratio = 0.0f;
+
+  if (!(rate_hz > 0.0f)) {
+    return NULL;
+  }
+
+  for (uint8_t code = 0; code < ICM42688P_ODR_CODES; ++code) {
+    const sl_icm42688p_odr_info_t *info = &odr_table[code];
+    float ratio;
+
+    if (info->period_ns == 0 || (info->modes & modes) != modes) {
+      continue;
+    }
+
+    /* Rates span four decades: compare by ratio, not difference */
+    ratio = (info->rate_hz > rate_hz) ? info->rate_hz / rate_hz : rate_hz / info->rate_hz;
+    if (!best || ratio < best_ratio) {
+      best = info;
+      best_ratio = ratio;
+    }
+  }
+
+  return best;
+}
+
+/* ----- Full scale ----- */
+/* FS_SEL 0 is the widest range and every step halves it */
+#define FS_ENTRY(code_, widest_)                                                          \
+  {                                                                                      \
+    .code = (code_),                                                                     \
+    .range = (widest_) / (float)(1U << (code_)),                                         \
+    .sensitivity = 32768.0f * (float)(1U << (code_)) / (widest_),                        \
+    .scale = (widest_) / (32768.0f * (float)(1U << (code_))),                            \
+  }
+
+static const sl_icm42688p_fs_info_t accel_fs_table[ICM42688P_ACCEL_FS_CODES] = {
+  FS_ENTRY(0U, 16.0f), FS_ENTRY(1U, 16.0f), FS_ENTRY(2U, 16.0f), FS_ENTRY(3U, 16.0f),
+};
+
+static const sl_icm42688p_fs_info_t gyro_fs_table[ICM42688P_GYRO_FS_CODES] = {
+  FS_ENTRY(0U, 2000.0f), FS_ENTRY(1U, 2000.0f), FS_ENTRY(2U, 2000.0f), FS_ENTRY(3U, 2000.0f),
+  FS_ENTRY(4U, 2000.0f), FS_ENTRY(5U, 2000.0f), FS_ENTRY(6U, 2000.0f), FS_ENTRY(7U, 2000.0f),
+};
+
+static const sl_icm42688p_fs_info_t *fs_for_range(const sl_icm42688p_fs_info_t *table, uint8_t codes, float range)
+{
+  /* Narrowest first */
+  for (uint8_t i = codes; i > 0; --i) {
+    if (table[i - 1U].range >= range) {
+      return &table[i - 1U];
+    }
+  }
+  return &table[0];
+}
+
+const sl_icm42688p_fs_info_t *sl_icm42688p_accel_fs_info(uint8_t code)
+{
+  return (code < ICM42688P_ACCEL_FS_CODES) ? &accel_fs_table[code] : NULL;
+}
+
+const sl_icm42688p_fs_info_t *sl_icm42688p_gyro_fs_info(uint8_t code)
+{
+  return (code < ICM42688P_GYRO_FS_CODES) ? &gyro_fs_table[code] : NULL;
+}
+
+const sl_icm42688p_fs_info_t *sl_icm42688p_accel_fs_for_range(float range)
+{
+  return fs_for_range(accel_fs_table, ICM42688P_ACCEL_FS_CODES, range);
+}
+
+const sl_icm42688p_fs_info_t *sl_icm42688p_gyro_fs_for_range(float range)
+{
+  return fs_for_range(gyro_fs_table, ICM42688P_GYRO_FS_CODES, range);
+}
@@ -0,0 +1,67 @@
+/***************************************************************************//**
+ * @file
+ * @brief ODR and full-scale tables for the TDK InvenSense ICM42688P sensor
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Every ODR and FS_SEL code with the figures derived from it: period,
+ * sensitivity and per-sample noise. The tables are constant initialisers,
+ * so all of it is computed by the compiler.
+ *
+ * Plain C, no SDK dependencies: builds unchanged on a Linux host.
+ ******************************************************************************/
+
+#ifndef SL_ICM42688P_ODR_H
+#define SL_ICM42688P_ODR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Which sensor an ODR code is valid for, in which power mode */
+#define SL_ICM42688P_ODR_ACCEL_LN    (1U << 0)
+#define SL_ICM42688P_ODR_ACCEL_LP    (1U << 1)
+#define SL_ICM42688P_ODR_GYRO        (1U << 2)   /* low-noise mode */
+#define SL_ICM42688P_ODR_LN          (SL_ICM42688P_ODR_ACCEL_LN | SL_ICM42688P_ODR_GYRO)
+
+typedef struct {
+  uint8_t  code;
+  uint8_t  modes;             /* SL_ICM42688P_ODR_xxx */
+  uint32_t period_ns;         /* exact sample period */
+  float    rate_hz;           /* exact in float for every code */
+  float    accel_noise_var;   /* per-sample accel noise, g^2 */
+  float    gyro_noise_var;    /* per-sample gyro noise, dps^2 */
+} sl_icm42688p_odr_info_t;
+
+typedef struct {
+  uint8_t code;               /* FS_SEL */
+  float   range;              /* +/- full scale, g or dps */
+  float   sensitivity;        /* LSB per g or dps */
+  float   scale;              /* g or dps per LSB */
+} sl_icm42688p_fs_info_t;
+
+/* Table entry for an ODR code; NULL for reserved codes */
+const sl_icm42688p_odr_info_t *sl_icm42688p_odr_info(uint8_t code);
+
+/* Supported ODR nearest to rate_hz, by ratio, among the codes valid in all
+   of the given modes. NULL if none is. */
+const sl_icm42688p_odr_info_t *sl_icm42688p_odr_nearest(float rate_hz, uint8_t modes);
+
+/* Table entries for FS_SEL codes; NULL for reserved codes */
+const sl_icm42688p_fs_info_t *sl_icm42688p_accel_fs_info(uint8_t code);
+const sl_icm42688p_fs_info_t *sl_icm42688p_gyro_fs_info(uint8_t code);
+
+/* Narrowest range that still covers range (g or dps); the widest if none */
+const sl_icm42688p_fs_info_t *sl_icm42688p_accel_fs_for_range(float range);
+const sl_icm42688p_fs_info_t *sl_icm42688p_gyro_fs_for_range(float range);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_ICM42688P_ODR_H
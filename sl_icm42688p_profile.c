@@ -0,0 +1,49 @@
+/***************************************************************************//**
+ * @file
+ * @brief Precompiled register profiles for the TDK InvenSense ICM42688P sensor
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ ******************************************************************************/
+
+#include "sl_icm42688p_profile.h"
+#include "sl_icm42688p_fifo.h"
+
+/* Capture watermark: one drain block of packet 3 */
+#define CAPTURE_WATERMARK   (SL_ICM42688P_FIFO_DRAIN_PACKETS * SL_ICM42688P_FIFO_PACKET3_SIZE)
+
+static const sl_icm42688p_reg_setting_t idle_settings[] = {
+  SL_ICM42688P_PROFILE_SETTINGS(ICM42688P_PWR_MGMT0_ACCEL_MODE_LOWPOWER | ICM42688P_PWR_MGMT0_GYRO_MODE_OFF
+                                | ICM42688P_PWR_MGMT0_TEMP_DIS,
+                                ICM42688P_ACCEL_CONFIG0_FS_2G, ICM42688P_ODR_CODE_50HZ,
+                                ICM42688P_GYRO_CONFIG0_FS_250DPS, ICM42688P_ODR_CODE_50HZ,
+                                ICM42688P_GYRO_ACCEL_CONFIG0_DEFAULT,
+                                ICM42688P_FIFO_CONFIG_MODE_BYPASS, 0x00U, 0U,
+                                0x00U),
+};
+
+static const sl_icm42688p_reg_setting_t measurement_settings[] = {
+  SL_ICM42688P_PROFILE_SETTINGS(ICM42688P_PWR_MGMT0_ACCEL_MODE_LOWNOISE | ICM42688P_PWR_MGMT0_GYRO_MODE_LOWNOISE,
+                                ICM42688P_ACCEL_CONFIG0_FS_2G, ICM42688P_ODR_CODE_1KHZ,
+                                ICM42688P_GYRO_CONFIG0_FS_250DPS, ICM42688P_ODR_CODE_1KHZ,
+                                ICM42688P_GYRO_ACCEL_CONFIG0_DEFAULT,
+                                ICM42688P_FIFO_CONFIG_MODE_BYPASS, 0x00U, 0U,
+                                ICM42688P_INT_SOURCE0_UI_DRDY_INT1_EN),
+};
+
+static const sl_icm42688p_reg_setting_t capture_settings[] = {
+  SL_ICM42688P_PROFILE_SETTINGS(ICM42688P_PWR_MGMT0_ACCEL_MODE_LOWNOISE | ICM42688P_PWR_MGMT0_GYRO_MODE_LOWNOISE,
+                                ICM42688P_ACCEL_CONFIG0_FS_16G, ICM42688P_GYRO_ODR_8KHZ,
+                                ICM42688P_GYRO_CONFIG0_FS_2000DPS, ICM42688P_GYRO_ODR_8KHZ,
+                                ICM42688P_GYRO_ACCEL_CONFIG0_DEFAULT,
+                                ICM42688P_FIFO_CONFIG_MODE_STREAM,
+                                ICM42688P_FIFO_CONFIG1_ACCEL_EN | ICM42688P_FIFO_CONFIG1_GYRO_EN
+                                | ICM42688P_FIFO_CONFIG1_TEMP_EN | ICM42688P_FIFO_CONFIG1_TMST_FSYNC_EN,
+                                CAPTURE_WATERMARK,
+                                ICM42688P_INT_SOURCE0_FIFO_THS_INT1_EN),
+};
+
+const sl_icm42688p_profile_t sl_icm42688p_profile_idle        = SL_ICM42688P_PROFILE("idle", idle_settings);
+const sl_icm42688p_profile_t sl_icm42688p_profile_measurement = SL_ICM42688P_PROFILE("measurement", measurement_settings);
+const sl_icm42688p_profile_t sl_icm42688p_profile_capture     = SL_ICM42688P_PROFILE("capture", capture_settings);
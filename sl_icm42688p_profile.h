@@ -0,0 +1,79 @@
+/***************************************************************************//**
+ * @file
+ * @brief Precompiled register profiles for the TDK InvenSense ICM42688P sensor
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * A profile is a const table of (bank, register, value) settings, applied in
+ * table order by sl_icm42688p_apply_profile(). Entries at consecutive
+ * addresses of the same bank are written in one auto-increment burst, and
+ * entries the register shadow already holds are skipped.
+ ******************************************************************************/
+
+#ifndef SL_ICM42688P_PROFILE_H
+#define SL_ICM42688P_PROFILE_H
+
+#include <stdint.h>
+#include "sl_icm42688p_defs.h"
+#include "sl_icm42688p_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+  uint8_t bank;
+  uint8_t reg;
+  uint8_t value;
+} sl_icm42688p_reg_setting_t;
+
+typedef struct {
+  const char *name;
+  const sl_icm42688p_reg_setting_t *settings;
+  uint16_t count;
+} sl_icm42688p_profile_t;
+
+/* Wrap a settings array into a profile */
+#define SL_ICM42688P_PROFILE(profile_name, table) \
+  { .name = (profile_name), .settings = (table), .count = (uint16_t)(sizeof(table) / sizeof((table)[0])) }
+
+/* Interrupt pins: active-high, push-pull, pulsed; short pulses without the
+   de-assert hold-off so DRDY and FIFO_THS keep up with multi-kHz ODRs */
+#define SL_ICM42688P_PROFILE_INT_CONFIG \
+  (ICM42688P_INT1_POLARITY | ICM42688P_INT1_DRIVE_CIRCUIT | ICM42688P_INT2_POLARITY | ICM42688P_INT2_DRIVE_CIRCUIT)
+#define SL_ICM42688P_PROFILE_INT_CONFIG1 \
+  (ICM42688P_INT_CONFIG1_TPULSE_DURATION | ICM42688P_INT_CONFIG1_TDEASSERT_DISABLE)
+
+/* Complete bank 0 sensor setup from FS/ODR/filter/FIFO choices, in write
+   order: GYRO_CONFIG0..ACCEL_CONFIG1 and FIFO_CONFIG1..3 go out as bursts,
+   the FIFO mode once its format is set, and PWR_MGMT0 last because the
+   sensor ignores writes for 200 us after a power mode change. */
+#define SL_ICM42688P_PROFILE_SETTINGS(pwr_mgmt0, accel_fs, accel_odr, gyro_fs, gyro_odr,            \
+                                      ui_filt_bw, fifo_mode, fifo_config1, fifo_watermark,           \
+                                      int_source0)                                                   \
+  { ICM42688P_BANK_0, ICM42688P_REG_INT_CONFIG,         SL_ICM42688P_PROFILE_INT_CONFIG },           \
+  { ICM42688P_BANK_0, ICM42688P_REG_GYRO_CONFIG0,       (uint8_t)((gyro_fs) | (gyro_odr)) },         \
+  { ICM42688P_BANK_0, ICM42688P_REG_ACCEL_CONFIG0,      (uint8_t)((accel_fs) | (accel_odr)) },       \
+  { ICM42688P_BANK_0, ICM42688P_REG_GYRO_CONFIG1,       ICM42688P_GYRO_CONFIG1_DEFAULT },            \
+  { ICM42688P_BANK_0, ICM42688P_REG_GYRO_ACCEL_CONFIG0, (uint8_t)(ui_filt_bw) },                     \
+  { ICM42688P_BANK_0, ICM42688P_REG_ACCEL_CONFIG1,      ICM42688P_ACCEL_CONFIG1_DEFAULT },           \
+  { ICM42688P_BANK_0, ICM42688P_REG_FIFO_CONFIG1,       (uint8_t)(fifo_config1) },                   \
+  { ICM42688P_BANK_0, ICM42688P_REG_FIFO_CONFIG2,       (uint8_t)((fifo_watermark) & 0xFFU) },       \
+  { ICM42688P_BANK_0, ICM42688P_REG_FIFO_CONFIG3,       (uint8_t)(((fifo_watermark) >> 8) & 0x0FU) },\
+  { ICM42688P_BANK_0, ICM42688P_REG_INT_CONFIG1,        SL_ICM42688P_PROFILE_INT_CONFIG1 },          \
+  { ICM42688P_BANK_0, ICM42688P_REG_INT_SOURCE0,        (uint8_t)(int_source0) },                    \
+  { ICM42688P_BANK_0, ICM42688P_REG_FIFO_CONFIG,        (uint8_t)(fifo_mode) },                      \
+  { ICM42688P_BANK_0, ICM42688P_REG_PWR_MGMT0,          (uint8_t)(pwr_mgmt0) }
+
+/* Named profiles */
+extern const sl_icm42688p_profile_t sl_icm42688p_profile_idle;         /* low-power accel at 50 Hz, gyro off */
+extern const sl_icm42688p_profile_t sl_icm42688p_profile_measurement;  /* 1 kHz, 2 g / 250 dps, DRDY on INT1 */
+extern const sl_icm42688p_profile_t sl_icm42688p_profile_capture;      /* 8 kHz, 16 g / 2000 dps, FIFO packet 3 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_ICM42688P_PROFILE_H
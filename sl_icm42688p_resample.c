@@ -0,0 +1,92 @@
+/***************************************************************************//**
+ * @file
+ * @brief Linear resampling onto the nominal ODR grid for the ICM42688P driver
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ ******************************************************************************/
+
+#include "sl_icm42688p_resample.h"
+#include <string.h>
+
+static void resample_restart(sl_icm42688p_resample_t *rs,
+                             const sl_icm42688p_stamped_sample_t *sample,
+                             sl_icm42688p_resample_output_t output,
+                             void *context)
+{
+  rs->primed = true;
+  rs->fresh = 0;
+  rs->fsync_pending = false;
+  rs->prev = *sample;
+  rs->next_q16 = (sample->timestamp << 16) + rs->step_q16;
+  rs->outputs++;
+  output(sample, context);
+}
+
+void sl_icm42688p_resample_init(sl_icm42688p_resample_t *rs, uint32_t tick_hz, uint32_t period_ns)
+{
+  memset(rs, 0, sizeof(*rs));
+  rs->step_q16 = (((uint64_t)period_ns * tick_hz) << 16) / 1000000000U;
+  if (rs->step_q16 == 0) {
+    rs->step_q16 = 1U;
+  }
+}
+
+uint32_t sl_icm42688p_resample_push(sl_icm42688p_resample_t *rs,
+                                    const sl_icm42688p_stamped_sample_t *sample,
+                                    sl_icm42688p_resample_output_t output,
+                                    void *context)
+{
+  uint64_t prev_q16 = rs->prev.timestamp << 16;
+  uint64_t cur_q16 = sample->timestamp << 16;
+  uint64_t span_q16;
+  uint32_t count = 0;
+
+  rs->inputs++;
+
+  if (!rs->primed || cur_q16 < prev_q16
+      || cur_q16 - prev_q16 > SL_ICM42688P_RESAMPLE_MAX_GAP * rs->step_q16) {
+    if (rs->primed) {
+      rs->gaps++;
+    }
+    resample_restart(rs, sample, output, context);
+    return 1U;
+  }
+
+  /* Fresh fields go out with the next output, even when an input has none */
+  rs->fresh |= sample->flags & SL_ICM42688P_SAMPLE_FRESH;
+  if (sample->flags & SL_ICM42688P_SAMPLE_FSYNC) {
+    rs->fsync_pending = true;
+    rs->fsync_edge_q16 = cur_q16 - sample->fsync_q16;
+  }
+  span_q16 = cur_q16 - prev_q16;
+  while (span_q16 > 0 && rs->next_q16 <= cur_q16) {
+    sl_icm42688p_stamped_sample_t out;
+    /* Position of the grid point between the two inputs, Q16 */
+    int64_t frac = (int64_t)(((rs->next_q16 - prev_q16) << 16) / span_q16);
+
+    for (uint8_t i = 0; i < SL_ICM42688P_RAW_WORDS; ++i) {
+      int32_t a = rs->prev.raw.data[i];
+      int32_t b = sample->raw.data[i];
+      out.raw.data[i] = a + (int32_t)((((int64_t)b - a) * frac + 0x8000) >> 16);
+    }
+    out.timestamp = (rs->next_q16 + 0x8000U) >> 16;
+    out.flags = (uint8_t)(rs->fresh | SL_ICM42688P_SAMPLE_INTERP);
+    out.fsync_q16 = 0;
+    rs->fresh = 0;
+    if (rs->fsync_pending && rs->next_q16 >= rs->fsync_edge_q16) {
+      out.flags |= SL_ICM42688P_SAMPLE_FSYNC;
+      out.fsync_q16 = (uint32_t)(rs->next_q16 - rs->fsync_edge_q16);
+      rs->fsync_pending = false;
+    }
+
+    output(&out, context);
+    rs->outputs++;
+    count++;
+    rs->next_q16 += rs->step_q16;
+  }
+
+  rs->prev = *sample;
+  return count;
+}
@@ -0,0 +1,64 @@
+/***************************************************************************//**
+ * @file
+ * @brief Linear resampling onto the nominal ODR grid for the ICM42688P driver
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Timestamped samples at the sensor's actual rate in, samples at exactly
+ * the nominal rate of sleeptimer time out. The grid starts at the first
+ * input and advances in Q16 ticks, so it does not accumulate rounding; each
+ * output is interpolated between the two inputs around its grid point and
+ * stamped with the grid point rounded to a tick.
+ *
+ * Pure integer logic with no hardware access, so it runs on a host.
+ ******************************************************************************/
+
+#ifndef SL_ICM42688P_RESAMPLE_H
+#define SL_ICM42688P_RESAMPLE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sl_icm42688p_sample.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A gap between inputs longer than this many grid steps restarts the grid
+   instead of interpolating across it */
+#define SL_ICM42688P_RESAMPLE_MAX_GAP   16U
+
+typedef void (*sl_icm42688p_resample_output_t)(const sl_icm42688p_stamped_sample_t *sample, void *context);
+
+typedef struct {
+  uint64_t step_q16;        /* grid spacing, ticks Q16 */
+  bool     primed;
+  sl_icm42688p_stamped_sample_t prev;
+  uint64_t next_q16;        /* next grid point, ticks Q16 */
+  uint8_t  fresh;           /* fresh fields not yet put out */
+  bool     fsync_pending;   /* FSYNC edge not yet put out */
+  uint64_t fsync_edge_q16;  /* its time, ticks Q16 */
+
+  /* Counters */
+  uint32_t inputs;
+  uint32_t outputs;
+  uint32_t gaps;            /* grid restarts after a long gap */
+} sl_icm42688p_resample_t;
+
+void sl_icm42688p_resample_init(sl_icm42688p_resample_t *rs, uint32_t tick_hz, uint32_t period_ns);
+
+/* Feed the next input in time order; output is called for every grid point
+   up to it. An FSYNC tag moves to the first output at or after the edge,
+   with the offset taken from there. Returns the number of outputs. */
+uint32_t sl_icm42688p_resample_push(sl_icm42688p_resample_t *rs,
+                                    const sl_icm42688p_stamped_sample_t *sample,
+                                    sl_icm42688p_resample_output_t output,
+                                    void *context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_ICM42688P_RESAMPLE_H
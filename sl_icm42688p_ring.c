@@ -0,0 +1,84 @@
+/***************************************************************************//**
+ * @file
+ * @brief Single-producer/single-consumer sample ring for the ICM42688P driver
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ ******************************************************************************/
+
+#include "sl_icm42688p_ring.h"
+#include <stddef.h>
+
+/* Full barrier: DMB on Cortex-M, a sequentially consistent fence elsewhere */
+#if defined(__ARM_ARCH)
+#include "cmsis_compiler.h"
+#define RING_BARRIER()   __DMB()
+#else
+#include <stdatomic.h>
+#define RING_BARRIER()   atomic_thread_fence(memory_order_seq_cst)
+#endif
+
+sl_status_t sl_icm42688p_ring_init(sl_icm42688p_ring_t *ring, sl_icm42688p_ring_entry_t *entries, uint32_t capacity)
+{
+  if (!ring || !entries || capacity == 0 || (capacity & (capacity - 1U)) != 0) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  ring->entries = entries;
+  ring->mask = capacity - 1U;
+  ring->head = 0;
+  ring->tail = 0;
+  ring->overflows = 0;
+
+  return SL_STATUS_OK;
+}
+
+bool sl_icm42688p_ring_push(sl_icm42688p_ring_t *ring, const sl_icm42688p_ring_entry_t *entry)
+{
+  uint32_t head = ring->head;
+  uint32_t tail = ring->tail;
+
+  if (head - tail > ring->mask) {
+    ring->overflows++;
+    return false;
+  }
+
+  /* tail read before the slot is overwritten */
+  RING_BARRIER();
+  ring->entries[head & ring->mask] = *entry;
+
+  /* slot written before it is published */
+  RING_BARRIER();
+  ring->head = head + 1U;
+
+  return true;
+}
+
+bool sl_icm42688p_ring_pop(sl_icm42688p_ring_t *ring, sl_icm42688p_ring_entry_t *entry)
+{
+  uint32_t tail = ring->tail;
+  uint32_t head = ring->head;
+
+  if (head == tail) {
+    return false;
+  }
+
+  /* head read before the slot it publishes */
+  RING_BARRIER();
+  *entry = ring->entries[tail & ring->mask];
+
+  /* slot read before it is handed back */
+  RING_BARRIER();
+  ring->tail = tail + 1U;
+
+  return true;
+}
+
+uint32_t sl_icm42688p_ring_count(const sl_icm42688p_ring_t *ring)
+{
+  uint32_t tail = ring->tail;
+  uint32_t head = ring->head;
+
+  return head - tail;
+}
@@ -0,0 +1,54 @@
+/***************************************************************************//**
+ * @file
+ * @brief Single-producer/single-consumer sample ring for the ICM42688P driver
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Lock-free: the producer (LDMA or GPIO IRQ) only writes head, the consumer
+ * (super loop) only writes tail, and memory barriers order the slot accesses
+ * against the index updates. No critical sections, so it also runs between
+ * two threads on a host build.
+ ******************************************************************************/
+
+#ifndef SL_ICM42688P_RING_H
+#define SL_ICM42688P_RING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sl_status.h"
+#include "sl_icm42688p_sample.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef sl_icm42688p_stamped_sample_t sl_icm42688p_ring_entry_t;
+
+/* head and tail run freely and wrap at 2^32; the slot is index & mask */
+typedef struct {
+  sl_icm42688p_ring_entry_t *entries;
+  uint32_t mask;                      /* capacity - 1 */
+  volatile uint32_t head;             /* written by the producer only */
+  volatile uint32_t tail;             /* written by the consumer only */
+  volatile uint32_t overflows;        /* pushes refused on a full ring, producer only */
+} sl_icm42688p_ring_t;
+
+/* capacity must be a power of two */
+sl_status_t sl_icm42688p_ring_init(sl_icm42688p_ring_t *ring, sl_icm42688p_ring_entry_t *entries, uint32_t capacity);
+
+/* Producer side. A full ring keeps its contents and counts the overflow. */
+bool sl_icm42688p_ring_push(sl_icm42688p_ring_t *ring, const sl_icm42688p_ring_entry_t *entry);
+
+/* Consumer side. false when empty. */
+bool sl_icm42688p_ring_pop(sl_icm42688p_ring_t *ring, sl_icm42688p_ring_entry_t *entry);
+
+/* Entries waiting; exact from either side, a snapshot from anywhere else */
+uint32_t sl_icm42688p_ring_count(const sl_icm42688p_ring_t *ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_ICM42688P_RING_H
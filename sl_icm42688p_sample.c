@@ -0,0 +1,62 @@
+/***************************************************************************//**
+ * @file
+ * @brief Raw samples and unit conversion for the TDK InvenSense ICM42688P sensor
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ ******************************************************************************/
+
+#include "sl_icm42688p_sample.h"
+#include "sl_icm42688p_defs.h"
+#include "sl_icm42688p_odr.h"
+
+/* ----- Scale descriptor ----- */
+void sl_icm42688p_scale_from_config(uint8_t accel_config0, uint8_t gyro_config0, sl_icm42688p_scale_t *scale)
+{
+  const sl_icm42688p_fs_info_t *accel_fs = sl_icm42688p_accel_fs_info(
+    (uint8_t)((accel_config0 & ICM42688P_ACCEL_CONFIG0_MASK_FS_SEL) >> ICM42688P_ACCEL_CONFIG0_SHIFT_FS_SEL));
+  const sl_icm42688p_fs_info_t *gyro_fs = sl_icm42688p_gyro_fs_info(
+    (uint8_t)((gyro_config0 & ICM42688P_GYRO_CONFIG0_MASK_FS_SEL) >> ICM42688P_GYRO_CONFIG0_SHIFT_FS_SEL));
+
+  if (!accel_fs) {
+    accel_fs = sl_icm42688p_accel_fs_info(0);   /* reserved codes */
+  }
+
+  scale->accel = accel_fs->scale;
+  scale->gyro  = gyro_fs->scale;
+  scale->temperature = 1.0f / ICM42688P_TEMP_SENSITIVITY;
+  scale->temperature_offset = ICM42688P_TEMP_OFFSET;
+}
+
+void sl_icm42688p_scale_hires(sl_icm42688p_scale_t *scale)
+{
+  scale->accel = 1.0f / ICM42688P_HIRES_ACCEL_SENSITIVITY;
+  scale->gyro  = 1.0f / ICM42688P_HIRES_GYRO_SENSITIVITY;
+  scale->temperature = 1.0f / ICM42688P_TEMP_SENSITIVITY;
+  scale->temperature_offset = ICM42688P_TEMP_OFFSET;
+}
+
+/* ----- Decoding and conversion ----- */
+void sl_icm42688p_raw_from_be(const uint8_t *buf, sl_icm42688p_raw_sample_t *raw)
+{
+  for (size_t i = 0; i < SL_ICM42688P_RAW_WORDS; ++i) {
+    raw->data[i] = (int16_t)(((uint16_t)buf[2 * i] << 8) | buf[2 * i + 1]);
+  }
+}
+
+void sl_icm42688p_convert_samples(const sl_icm42688p_raw_sample_t *raw,
+                                  size_t count,
+                                  const sl_icm42688p_scale_t *scale,
+                                  sl_icm42688p_sample_t *out)
+{
+  for (size_t n = 0; n < count; ++n) {
+    const int32_t *d = raw[n].data;
+
+    out[n].temperature = (float)d[SL_ICM42688P_RAW_TEMP] * scale->temperature + scale->temperature_offset;
+    for (size_t i = 0; i < 3; ++i) {
+      out[n].accel[i] = (float)d[SL_ICM42688P_RAW_ACCEL_X + i] * scale->accel;
+      out[n].gyro[i]  = (float)d[SL_ICM42688P_RAW_GYRO_X + i] * scale->gyro;
+    }
+  }
+}
@@ -0,0 +1,95 @@
+/***************************************************************************//**
+ * @file
+ * @brief Raw samples and unit conversion for the TDK InvenSense ICM42688P sensor
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Plain C, no SDK dependencies: builds unchanged on a Linux host.
+ ******************************************************************************/
+
+#ifndef SL_ICM42688P_SAMPLE_H
+#define SL_ICM42688P_SAMPLE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Word order of a raw sample: the TEMP_DATA1..GYRO_DATA_Z0 register order */
+enum {
+  SL_ICM42688P_RAW_TEMP    = 0,
+  SL_ICM42688P_RAW_ACCEL_X = 1,
+  SL_ICM42688P_RAW_ACCEL_Y = 2,
+  SL_ICM42688P_RAW_ACCEL_Z = 3,
+  SL_ICM42688P_RAW_GYRO_X  = 4,
+  SL_ICM42688P_RAW_GYRO_Y  = 5,
+  SL_ICM42688P_RAW_GYRO_Z  = 6,
+  SL_ICM42688P_RAW_WORDS   = 7,
+};
+
+/* Sensor sample as read, in LSBs. temperature is on the TEMP_DATA scale.
+   32-bit words hold both the 16-bit registers and 20-bit FIFO packet 4. */
+typedef struct {
+  int32_t data[SL_ICM42688P_RAW_WORDS];
+} sl_icm42688p_raw_sample_t;
+
+/* Stamped sample flags: which fields hold a new measurement, which were
+   interpolated onto the sample time rather than measured at it, the
+   first sample after an FSYNC edge, and the first after acquisition was
+   paused */
+#define SL_ICM42688P_SAMPLE_ACCEL_FRESH    (1U << 0)
+#define SL_ICM42688P_SAMPLE_GYRO_FRESH     (1U << 1)
+#define SL_ICM42688P_SAMPLE_ACCEL_INTERP   (1U << 2)
+#define SL_ICM42688P_SAMPLE_GYRO_INTERP    (1U << 3)
+#define SL_ICM42688P_SAMPLE_FSYNC          (1U << 4)
+#define SL_ICM42688P_SAMPLE_GAP            (1U << 5)
+#define SL_ICM42688P_SAMPLE_FRESH          (SL_ICM42688P_SAMPLE_ACCEL_FRESH | SL_ICM42688P_SAMPLE_GYRO_FRESH)
+#define SL_ICM42688P_SAMPLE_INTERP         (SL_ICM42688P_SAMPLE_ACCEL_INTERP | SL_ICM42688P_SAMPLE_GYRO_INTERP)
+
+/* Raw sample with the time it was taken */
+typedef struct {
+  sl_icm42688p_raw_sample_t raw;
+  uint64_t timestamp;       /* 64-bit sleeptimer ticks, see sl_icm42688p_timestamp.h */
+  uint8_t  flags;           /* SL_ICM42688P_SAMPLE_xxx */
+  uint32_t fsync_q16;       /* with SL_ICM42688P_SAMPLE_FSYNC: FSYNC edge to timestamp, ticks Q16 */
+} sl_icm42688p_stamped_sample_t;
+
+/* Coherent temperature + accel + gyro sample in physical units */
+typedef struct {
+  float temperature;   /* degC */
+  float accel[3];      /* g */
+  float gyro[3];       /* dps */
+} sl_icm42688p_sample_t;
+
+/* LSB to physical unit factors for the configured full-scale ranges */
+typedef struct {
+  float accel;              /* g per LSB */
+  float gyro;               /* dps per LSB */
+  float temperature;        /* degC per LSB */
+  float temperature_offset; /* degC at a raw value of 0 */
+} sl_icm42688p_scale_t;
+
+/* Scale descriptor for the FS_SEL fields of ACCEL_CONFIG0 and GYRO_CONFIG0 */
+void sl_icm42688p_scale_from_config(uint8_t accel_config0, uint8_t gyro_config0, sl_icm42688p_scale_t *scale);
+
+/* Scale descriptor for 20-bit FIFO packet 4, which ignores FS_SEL */
+void sl_icm42688p_scale_hires(sl_icm42688p_scale_t *scale);
+
+/* Decode the big-endian TEMP_DATA1..GYRO_DATA_Z0 burst */
+void sl_icm42688p_raw_from_be(const uint8_t *buf, sl_icm42688p_raw_sample_t *raw);
+
+/* Convert count raw samples to physical units */
+void sl_icm42688p_convert_samples(const sl_icm42688p_raw_sample_t *raw,
+                                  size_t count,
+                                  const sl_icm42688p_scale_t *scale,
+                                  sl_icm42688p_sample_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_ICM42688P_SAMPLE_H
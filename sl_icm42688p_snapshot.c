@@ -0,0 +1,68 @@
+/***************************************************************************//**
+ * @file
+ * @brief Seqlock-protected latest-sample slot for the ICM42688P driver
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ ******************************************************************************/
+
+#include "sl_icm42688p_snapshot.h"
+#include <string.h>
+
+/* Full barrier: DMB on Cortex-M, a sequentially consistent fence elsewhere */
+#if defined(__ARM_ARCH)
+#include "cmsis_compiler.h"
+#define SNAPSHOT_BARRIER()   __DMB()
+#else
+#include <stdatomic.h>
+#define SNAPSHOT_BARRIER()   atomic_thread_fence(memory_order_seq_cst)
+#endif
+
+/* A reader collides with a write at most once per sample period; more
+   failed attempts than this mean it preempted the writer */
+#define SNAPSHOT_READ_ATTEMPTS   8U
+
+void sl_icm42688p_snapshot_init(sl_icm42688p_snapshot_t *snapshot)
+{
+  memset(snapshot, 0, sizeof(*snapshot));
+}
+
+void sl_icm42688p_snapshot_write(sl_icm42688p_snapshot_t *snapshot, const sl_icm42688p_stamped_sample_t *sample)
+{
+  uint32_t sequence = snapshot->sequence;
+
+  snapshot->sequence = sequence + 1U;
+  SNAPSHOT_BARRIER();
+
+  snapshot->sample = *sample;
+
+  SNAPSHOT_BARRIER();
+  snapshot->sequence = sequence + 2U;
+  snapshot->valid = true;
+}
+
+bool sl_icm42688p_snapshot_read(const sl_icm42688p_snapshot_t *snapshot, sl_icm42688p_stamped_sample_t *sample)
+{
+  if (!snapshot->valid) {
+    return false;
+  }
+
+  for (uint32_t attempt = 0; attempt < SNAPSHOT_READ_ATTEMPTS; ++attempt) {
+    uint32_t before = snapshot->sequence;
+
+    if (before & 1U) {
+      continue;
+    }
+
+    SNAPSHOT_BARRIER();
+    *sample = snapshot->sample;
+    SNAPSHOT_BARRIER();
+
+    if (snapshot->sequence == before) {
+      return true;
+    }
+  }
+
+  return false;
+}
@@ -0,0 +1,46 @@
+/***************************************************************************//**
+ * @file
+ * @brief Seqlock-protected latest-sample slot for the ICM42688P driver
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * One writer (the acquisition IRQ) replaces the sample; any number of
+ * readers copy it without locks and retry if a write overlapped the copy.
+ * Readers must not preempt the writer: on a single core a reader that
+ * interrupts a write in progress would never see it finish, so reads give
+ * up after a bounded number of attempts instead of spinning.
+ ******************************************************************************/
+
+#ifndef SL_ICM42688P_SNAPSHOT_H
+#define SL_ICM42688P_SNAPSHOT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sl_icm42688p_sample.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+  volatile uint32_t sequence;         /* odd while a write is in progress */
+  volatile bool valid;                /* set by the first write */
+  sl_icm42688p_stamped_sample_t sample;
+} sl_icm42688p_snapshot_t;
+
+void sl_icm42688p_snapshot_init(sl_icm42688p_snapshot_t *snapshot);
+
+/* Writer side */
+void sl_icm42688p_snapshot_write(sl_icm42688p_snapshot_t *snapshot, const sl_icm42688p_stamped_sample_t *sample);
+
+/* Reader side. false if nothing was written yet or no attempt got a
+   coherent copy. */
+bool sl_icm42688p_snapshot_read(const sl_icm42688p_snapshot_t *snapshot, sl_icm42688p_stamped_sample_t *sample);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_ICM42688P_SNAPSHOT_H
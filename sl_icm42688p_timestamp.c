@@ -0,0 +1,172 @@
+/***************************************************************************//**
+ * @file
+ * @brief Sample timestamp reconstruction for the ICM42688P driver
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ ******************************************************************************/
+
+#include "sl_icm42688p_timestamp.h"
+#include <string.h>
+
+/* Local helpers */
+static inline uint64_t timestamp_span_us(const sl_icm42688p_timestamp_t *ts)
+{
+  return (uint64_t)65536U * ts->tmst_lsb_us;
+}
+
+/* Sensor us to ticks, Q16, with the rate applied. Only ever called on the
+   distance to the last anchor, which keeps the products within 64 bits. */
+static int64_t timestamp_map_q16(const sl_icm42688p_timestamp_t *ts, int64_t delta_us)
+{
+  int64_t nominal = (delta_us * (int64_t)ts->tick_hz * 65536) / 1000000;
+  int64_t skew = (int64_t)ts->rate_q30 - (int64_t)SL_ICM42688P_TIMESTAMP_RATE_ONE;
+
+  return nominal + ((nominal * skew) / (int64_t)SL_ICM42688P_TIMESTAMP_RATE_ONE);
+}
+
+static uint64_t timestamp_monotonic(sl_icm42688p_timestamp_t *ts, uint64_t ticks)
+{
+  if (ticks < ts->last_output) {
+    ts->clamped++;
+    return ts->last_output;
+  }
+  ts->last_output = ticks;
+  return ticks;
+}
+
+/* ----- Setup ----- */
+void sl_icm42688p_timestamp_init(sl_icm42688p_timestamp_t *ts, uint32_t tick_hz,
+                                 uint32_t tmst_lsb_us, uint32_t period_us, uint8_t relax_shift)
+{
+  memset(ts, 0, sizeof(*ts));
+  ts->tick_hz = tick_hz;
+  ts->tmst_lsb_us = tmst_lsb_us ? tmst_lsb_us : 1U;
+  ts->period_us = period_us;
+  ts->rate_q30 = SL_ICM42688P_TIMESTAMP_RATE_ONE;
+  ts->relax_shift = relax_shift;
+}
+
+void sl_icm42688p_timestamp_set_period(sl_icm42688p_timestamp_t *ts, uint32_t period_us)
+{
+  ts->period_us = period_us;
+}
+
+void sl_icm42688p_timestamp_set_rate(sl_icm42688p_timestamp_t *ts, uint32_t rate_q30)
+{
+  ts->rate_q30 = rate_q30;
+}
+
+/* ----- Extension ----- */
+uint64_t sl_icm42688p_timestamp_extend_tmst(sl_icm42688p_timestamp_t *ts, uint16_t tmst)
+{
+  uint64_t span = timestamp_span_us(ts);
+  uint64_t delta;
+
+  if (!ts->tmst_valid) {
+    ts->tmst_valid = true;
+    ts->last_tmst = tmst;
+    return ts->sensor_us;
+  }
+
+  delta = (uint64_t)(uint16_t)(tmst - ts->last_tmst) * ts->tmst_lsb_us;
+  if (tmst < ts->last_tmst) {
+    ts->tmst_wraps++;
+  }
+
+  /* The counter can only show the gap modulo one wrap; whole wraps come
+     from the nominal period, rounded to the nearest */
+  if (ts->period_us > delta + span / 2U) {
+    uint64_t wraps = (ts->period_us - delta + span / 2U) / span;
+    delta += wraps * span;
+    ts->tmst_wraps += (uint32_t)wraps;
+  }
+
+  ts->last_tmst = tmst;
+  ts->sensor_us += delta;
+  return ts->sensor_us;
+}
+
+uint64_t sl_icm42688p_timestamp_extend_period(sl_icm42688p_timestamp_t *ts)
+{
+  if (ts->tmst_valid) {
+    ts->sensor_us += ts->period_us;
+  }
+  ts->tmst_valid = true;
+  ts->last_tmst = (uint16_t)(ts->last_tmst + ts->period_us / ts->tmst_lsb_us);
+
+  return ts->sensor_us;
+}
+
+uint64_t sl_icm42688p_timestamp_extend_capture(sl_icm42688p_timestamp_t *ts, uint32_t capture)
+{
+  if (!ts->capture_valid) {
+    ts->capture_valid = true;
+    ts->capture_ticks = capture;
+  } else {
+    ts->capture_ticks += (uint32_t)(capture - ts->last_capture);
+  }
+  ts->last_capture = capture;
+
+  return ts->capture_ticks;
+}
+
+/* ----- Mapping ----- */
+void sl_icm42688p_timestamp_anchor(sl_icm42688p_timestamp_t *ts, uint64_t sensor_us, uint32_t capture)
+{
+  int64_t observed = (int64_t)(sl_icm42688p_timestamp_extend_capture(ts, capture) << 16);
+  int64_t predicted;
+  int64_t error;
+
+  ts->anchors++;
+
+  if (!ts->anchored) {
+    ts->anchored = true;
+    ts->ref_sensor_us = sensor_us;
+    ts->ref_ticks_q16 = observed;
+    return;
+  }
+
+  predicted = ts->ref_ticks_q16 + timestamp_map_q16(ts, (int64_t)(sensor_us - ts->ref_sensor_us));
+  error = observed - predicted;
+
+  /* Latency only delays a capture: follow earlier ones at once and drift
+     slowly towards later ones */
+  if (error < 0) {
+    predicted = observed;
+  } else {
+    predicted += error >> ts->relax_shift;
+  }
+
+  ts->ref_sensor_us = sensor_us;
+  ts->ref_ticks_q16 = predicted;
+}
+
+uint64_t sl_icm42688p_timestamp_to_ticks(sl_icm42688p_timestamp_t *ts, uint64_t sensor_us)
+{
+  int64_t ticks_q16;
+
+  if (!ts->anchored) {
+    return 0;
+  }
+
+  ticks_q16 = ts->ref_ticks_q16 + timestamp_map_q16(ts, (int64_t)(sensor_us - ts->ref_sensor_us));
+  if (ticks_q16 < 0) {
+    ticks_q16 = 0;
+  }
+
+  return timestamp_monotonic(ts, (uint64_t)ticks_q16 >> 16);
+}
+
+uint64_t sl_icm42688p_timestamp_from_capture(sl_icm42688p_timestamp_t *ts, uint32_t capture)
+{
+  return timestamp_monotonic(ts, sl_icm42688p_timestamp_extend_capture(ts, capture));
+}
+
+uint32_t sl_icm42688p_timestamp_interval_q16(const sl_icm42688p_timestamp_t *ts, uint16_t delta)
+{
+  int64_t q16 = timestamp_map_q16(ts, (int64_t)delta * ts->tmst_lsb_us);
+
+  return (q16 > (int64_t)UINT32_MAX) ? UINT32_MAX : (uint32_t)q16;
+}
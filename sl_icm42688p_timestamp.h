@@ -0,0 +1,102 @@
+/***************************************************************************//**
+ * @file
+ * @brief Sample timestamp reconstruction for the ICM42688P driver
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Combines the sensor's 16-bit TMST counter, carried in FIFO packets 3/4,
+ * with captures of the interrupt edge on the 32-bit sleeptimer counter into
+ * a monotonic 64-bit time in sleeptimer ticks:
+ *
+ *  - TMST is extended to 64 bits. Rollovers are resolved from the nominal
+ *    sample period, so gaps of more than one wrap (low ODRs, 1 us TMST
+ *    resolution) still extend correctly.
+ *  - Sensor time maps to ticks through a rate (nominal 1.0, refined by a
+ *    drift estimator) from the last anchored packet. Capture latency only
+ *    ever delays an edge, so anchoring follows a lower envelope: an earlier
+ *    capture is taken at once, a later one is approached by 1/2^relax_shift
+ *    per anchor.
+ *  - Output never goes backwards.
+ *
+ * Pure integer logic with no hardware access, so rollover and jitter traces
+ * can be replayed on a host.
+ ******************************************************************************/
+
+#ifndef SL_ICM42688P_TIMESTAMP_H
+#define SL_ICM42688P_TIMESTAMP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Sensor to tick rate scale: Q30, 1.0 = nominal */
+#define SL_ICM42688P_TIMESTAMP_RATE_ONE   (1UL << 30)
+
+typedef struct {
+  /* Configuration */
+  uint32_t tick_hz;         /* sleeptimer frequency */
+  uint32_t tmst_lsb_us;     /* TMST resolution: 1 or 16 us */
+  uint32_t period_us;       /* nominal sample period, resolves multi-wrap gaps */
+  uint32_t rate_q30;        /* ticks per nominal tick, Q30 */
+  uint8_t  relax_shift;     /* offset tracking speed towards later captures */
+
+  /* Extension state */
+  bool     tmst_valid;
+  uint16_t last_tmst;
+  uint64_t sensor_us;       /* extended TMST, us since the first packet */
+  bool     capture_valid;
+  uint32_t last_capture;
+  uint64_t capture_ticks;   /* extended capture counter */
+
+  /* Mapping state: the last anchored packet and its estimated time */
+  bool     anchored;
+  uint64_t ref_sensor_us;
+  int64_t  ref_ticks_q16;
+  uint64_t last_output;
+
+  /* Counters */
+  uint32_t anchors;
+  uint32_t tmst_wraps;
+  uint32_t clamped;         /* outputs held back to stay monotonic */
+} sl_icm42688p_timestamp_t;
+
+void sl_icm42688p_timestamp_init(sl_icm42688p_timestamp_t *ts, uint32_t tick_hz,
+                                 uint32_t tmst_lsb_us, uint32_t period_us, uint8_t relax_shift);
+
+/* Nominal sample period after an ODR change */
+void sl_icm42688p_timestamp_set_period(sl_icm42688p_timestamp_t *ts, uint32_t period_us);
+
+/* Sensor clock rate relative to nominal, Q30 */
+void sl_icm42688p_timestamp_set_rate(sl_icm42688p_timestamp_t *ts, uint32_t rate_q30);
+
+/* Extend the TMST of the next packet, in packet order; returns sensor us */
+uint64_t sl_icm42688p_timestamp_extend_tmst(sl_icm42688p_timestamp_t *ts, uint16_t tmst);
+
+/* Packet without TMST: one nominal period after the previous; returns sensor us */
+uint64_t sl_icm42688p_timestamp_extend_period(sl_icm42688p_timestamp_t *ts);
+
+/* Extend a 32-bit capture of the sleeptimer counter; returns 64-bit ticks */
+uint64_t sl_icm42688p_timestamp_extend_capture(sl_icm42688p_timestamp_t *ts, uint32_t capture);
+
+/* The packet at sensor_us raised the interrupt edge captured at capture */
+void sl_icm42688p_timestamp_anchor(sl_icm42688p_timestamp_t *ts, uint64_t sensor_us, uint32_t capture);
+
+/* Sleeptimer ticks of the packet at sensor_us; 0 until the first anchor */
+uint64_t sl_icm42688p_timestamp_to_ticks(sl_icm42688p_timestamp_t *ts, uint64_t sensor_us);
+
+/* Edge-only path (no TMST): extended capture, kept monotonic */
+uint64_t sl_icm42688p_timestamp_from_capture(sl_icm42688p_timestamp_t *ts, uint32_t capture);
+
+/* Interval of delta TMST LSBs, such as the FSYNC delta, in ticks Q16 */
+uint32_t sl_icm42688p_timestamp_interval_q16(const sl_icm42688p_timestamp_t *ts, uint16_t delta);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_ICM42688P_TIMESTAMP_H
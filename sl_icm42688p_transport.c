@@ -0,0 +1,135 @@
+/***************************************************************************//**
+ * @file
+ * @brief Asynchronous SPI transfer queue for the ICM42688P driver
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ ******************************************************************************/
+
+#include "sl_icm42688p_transport.h"
+#include <stddef.h>
+
+/* Local helpers */
+static void transport_lock(const sl_icm42688p_transport_t *t)
+{
+  if (t->backend->lock) {
+    t->backend->lock();
+  }
+}
+
+static void transport_unlock(const sl_icm42688p_transport_t *t)
+{
+  if (t->backend->unlock) {
+    t->backend->unlock();
+  }
+}
+
+static sl_status_t transport_start_head(sl_icm42688p_transport_t *t)
+{
+  const sl_icm42688p_transfer_t *x = &t->queue[t->head];
+  return t->backend->start(x->tx, x->rx, x->len, t->backend->context);
+}
+
+/* ----- Public API ----- */
+void sl_icm42688p_transport_init(sl_icm42688p_transport_t *transport,
+                                 const sl_icm42688p_transport_backend_t *backend)
+{
+  transport->backend = backend;
+  transport->head = 0;
+  transport->count = 0;
+  transport->submitted = 0;
+  transport->completed = 0;
+  transport->errors = 0;
+}
+
+sl_status_t sl_icm42688p_transport_submit(sl_icm42688p_transport_t *transport,
+                                          const uint8_t *tx,
+                                          uint8_t *rx,
+                                          uint16_t len,
+                                          sl_icm42688p_transfer_callback_t callback,
+                                          void *context)
+{
+  bool start_now;
+
+  if (!transport || !transport->backend || len == 0) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  transport_lock(transport);
+
+  if (transport->count >= SL_ICM42688P_TRANSFER_QUEUE_DEPTH) {
+    transport_unlock(transport);
+    return SL_STATUS_FULL;
+  }
+
+  sl_icm42688p_transfer_t *x = &transport->queue[(transport->head + transport->count) % SL_ICM42688P_TRANSFER_QUEUE_DEPTH];
+  x->tx = tx;
+  x->rx = rx;
+  x->len = len;
+  x->callback = callback;
+  x->context = context;
+
+  transport->count++;
+  transport->submitted++;
+  start_now = (transport->count == 1);
+
+  transport_unlock(transport);
+
+  /* Idle bus: nothing can complete until this start, so no lock is needed.
+     A transfer the backend refused is finished here so the queue moves on. */
+  if (start_now) {
+    sl_status_t status = transport_start_head(transport);
+    if (status != SL_STATUS_OK) {
+      sl_icm42688p_transport_complete(transport, status);
+    }
+  }
+
+  return SL_STATUS_OK;
+}
+
+void sl_icm42688p_transport_complete(sl_icm42688p_transport_t *transport, sl_status_t status)
+{
+  sl_icm42688p_transfer_t done;
+  sl_status_t start_status = SL_STATUS_OK;
+  bool start_next;
+
+  transport_lock(transport);
+
+  if (transport->count == 0) {
+    transport_unlock(transport);
+    return;
+  }
+
+  done = transport->queue[transport->head];
+  transport->head = (uint8_t)((transport->head + 1U) % SL_ICM42688P_TRANSFER_QUEUE_DEPTH);
+  transport->count--;
+  transport->completed++;
+  if (status != SL_STATUS_OK) {
+    transport->errors++;
+  }
+  start_next = (transport->count > 0);
+
+  transport_unlock(transport);
+
+  /* Launch the next burst before running the callback so processing of this
+     result overlaps the following transfer. Transfers submitted from the
+     callback queue behind the ones already waiting. */
+  if (start_next) {
+    start_status = transport_start_head(transport);
+  }
+
+  if (done.callback) {
+    done.callback(status, done.context);
+  }
+
+  /* Refused by the backend: report it only after the earlier callback */
+  if (start_status != SL_STATUS_OK) {
+    sl_icm42688p_transport_complete(transport, start_status);
+  }
+}
+
+bool sl_icm42688p_transport_busy(const sl_icm42688p_transport_t *transport)
+{
+  return transport->count > 0;
+}
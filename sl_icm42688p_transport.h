@@ -0,0 +1,77 @@
+/***************************************************************************//**
+ * @file
+ * @brief Asynchronous SPI transfer queue for the ICM42688P driver
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Queueing, completion ordering and callback dispatch only. The bus work is
+ * done by a backend (LDMA on target, a simulated DMA on a host build), which
+ * reports each finished transfer through sl_icm42688p_transport_complete().
+ ******************************************************************************/
+
+#ifndef SL_ICM42688P_TRANSPORT_H
+#define SL_ICM42688P_TRANSPORT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sl_status.h"
+#include "sl_icm42688p_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef SL_ICM42688P_TRANSFER_QUEUE_DEPTH
+#define SL_ICM42688P_TRANSFER_QUEUE_DEPTH   4U
+#endif
+
+/* Called once per transfer, in submission order, from the completion context */
+typedef void (*sl_icm42688p_transfer_callback_t)(sl_status_t status, void *context);
+
+/* Bus backend. start() must only launch the transfer; completion is reported
+   later. lock()/unlock() mask the completion context and every context that
+   submits, so neither can re-enter the queue while it is being changed; they
+   may be NULL when all of them are the same context. */
+typedef struct {
+  sl_status_t (*start)(const uint8_t *tx, uint8_t *rx, uint16_t len, void *context);
+  void (*lock)(void);
+  void (*unlock)(void);
+  void *context;
+} sl_icm42688p_transport_backend_t;
+
+typedef struct {
+  const uint8_t *tx;     /* NULL: clock out zeros */
+  uint8_t *rx;           /* NULL: discard received bytes */
+  uint16_t len;
+  sl_icm42688p_transfer_callback_t callback;
+  void *context;
+} sl_icm42688p_transfer_t;
+
+typedef struct {
+  const sl_icm42688p_transport_backend_t *backend;
+  sl_icm42688p_transfer_t queue[SL_ICM42688P_TRANSFER_QUEUE_DEPTH];
+  uint8_t head;          /* in-flight transfer while count > 0 */
+  uint8_t count;
+  uint32_t submitted;
+  uint32_t completed;
+  uint32_t errors;
+} sl_icm42688p_transport_t;
+
+void        sl_icm42688p_transport_init(sl_icm42688p_transport_t *transport,
+                                        const sl_icm42688p_transport_backend_t *backend);
+sl_status_t sl_icm42688p_transport_submit(sl_icm42688p_transport_t *transport,
+                                          const uint8_t *tx,
+                                          uint8_t *rx,
+                                          uint16_t len,
+                                          sl_icm42688p_transfer_callback_t callback,
+                                          void *context);
+void        sl_icm42688p_transport_complete(sl_icm42688p_transport_t *transport, sl_status_t status);
+bool        sl_icm42688p_transport_busy(const sl_icm42688p_transport_t *transport);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_ICM42688P_TRANSPORT_H
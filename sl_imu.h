@@ -16,6 +16,8 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "sl_status.h"
+#include "sl_icm42688p_filter.h"
+#include "sl_icm42688p_calib.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -31,8 +33,43 @@ extern "C" {
 #define IMU_STATE_CALIBRATING      0x03
 /**@}*/
 
+/***************************************************************************//**
+ * @brief One coherent sample in physical units.
+ ******************************************************************************/
+typedef struct {
+    float accel[3];              /**< g */
+    float gyro[3];               /**< dps */
+    float temperature;           /**< degC */
+    uint64_t timestamp;          /**< 64-bit sleeptimer ticks at the data-ready edge */
+    bool accelFresh;             /**< accel measured since the previous sample, not held */
+    bool gyroFresh;              /**< gyro measured since the previous sample, not held */
+    bool fsync;                  /**< first sample after an external FSYNC edge */
+    uint64_t fsyncTimestamp;     /**< with fsync: sleeptimer ticks of the FSYNC edge */
+    bool gap;                    /**< first sample after acquisition paused, e.g. for recalibration */
+} sl_imu_sample_t;
+
+/***************************************************************************//**
+ * @brief Data-ready and acquisition counters.
+ ******************************************************************************/
+typedef struct {
+    uint32_t dataReadyQueries;   /**< sl_imu_is_data_ready() calls */
+    uint32_t dataReadyTrue;      /**< calls that returned a sample */
+    uint32_t isrEdges;           /**< DRDY edges taken by the interrupt */
+    uint32_t isrSamples;         /**< samples read on DRDY edges */
+    uint32_t isrMissed;          /**< edges without a read */
+    uint32_t queueOverflows;     /**< samples dropped on a full ring */
+    int32_t odrErrorPpb;         /**< sensor ODR error against the sleeptimer, ppb */
+    uint32_t samplePeriodNs;     /**< measured sample period in sleeptimer time */
+    uint32_t biasWindows;        /**< windows checked by the background bias tracker */
+    uint32_t biasStillWindows;   /**< windows found still, each one a bias update */
+    bool still;                  /**< last window was still */
+} sl_imu_stats_t;
+
 /***************************************************************************//**
  * @brief Initialize and calibrate the IMU chip.
+ *        A calibration stored in flash is reused when it was taken near the
+ *        current die temperature; otherwise the gyro bias is measured and
+ *        stored.
  ******************************************************************************/ 
 sl_status_t sl_imu_init(void);
 
@@ -48,29 +85,104 @@ uint8_t sl_imu_get_state(void);
 
 /***************************************************************************//**
  * @brief Configure IMU sample rate and sensor settings.
+ *        The nearest supported ODR is used, 12.5 Hz to 32 kHz.
  ******************************************************************************/ 
 void sl_imu_configure(float sampleRate);
 
 /***************************************************************************//**
- * @brief Retrieve raw acceleration data from the IMU.
+ * @brief Configure accel and gyro sample rates separately.
+ *        Each sensor runs at its nearest supported ODR. With outputRate > 0
+ *        samples are merged into records aligned at that rate, the slower
+ *        sensor held at its last value or, with interpolate, interpolated
+ *        between its two measurements around the record time.
+ ******************************************************************************/ 
+void sl_imu_configure_rates(float accelRate, float gyroRate, float outputRate, bool interpolate);
+
+/***************************************************************************//**
+ * @brief Configure the on-sensor UI, anti-alias and notch filters.
+ *        Bandwidths are in Hz and mapped to the nearest supported setting,
+ *        which is written back into config. The configuration is applied
+ *        again by every later sl_imu_configure().
+ ******************************************************************************/ 
+sl_status_t sl_imu_configure_filters(sl_icm42688p_filter_config_t *config);
+
+/***************************************************************************//**
+ * @brief Tag samples with an external FSYNC trigger on the sensor's pin 9.
+ *        The first sample after each edge has fsync set and the time of the
+ *        edge in fsyncTimestamp. Kept across later sl_imu_configure().
+ ******************************************************************************/ 
+sl_status_t sl_imu_configure_fsync(bool enable, bool fallingEdge);
+
+/***************************************************************************//**
+ * @brief Retrieve the latest acceleration, from the shared snapshot.
  ******************************************************************************/ 
 void sl_imu_get_acceleration(float avec[3]);
 
 /***************************************************************************//**
- * @brief Retrieve raw gyroscope data from the IMU.
+ * @brief Retrieve the latest angular rate, from the shared snapshot.
  ******************************************************************************/ 
 void sl_imu_get_gyro(float gvec[3]);
 
+/***************************************************************************//**
+ * @brief Retrieve accel, gyro, temperature and timestamp of the latest sample
+ *        as one coherent snapshot. Lock-free, no SPI access, any caller that
+ *        does not preempt the acquisition interrupt.
+ ******************************************************************************/ 
+bool sl_imu_get_latest(sl_imu_sample_t *sample);
+
+/***************************************************************************//**
+ * @brief Retrieve the sample taken by the last sl_imu_is_data_ready() that
+ *        returned true.
+ ******************************************************************************/ 
+bool sl_imu_get_sample(sl_imu_sample_t *sample);
+
 /***************************************************************************//**
  * @brief Perform gyroscope calibration to cancel bias.
+ *        Always measures, and replaces the stored calibration. Once
+ *        configured the sensor is not reset: a short burst at a raised gyro
+ *        ODR is read through the FIFO, the stream resumes and its first
+ *        sample has gap set. Returns SL_STATUS_ABORT, bias unchanged, if
+ *        the window showed motion.
  ******************************************************************************/ 
 sl_status_t sl_imu_calibrate_gyro(void);
 
 /***************************************************************************//**
- * @brief Check if new accel/gyro data is available.
+ * @brief Retrieve the calibration applied to samples.
+ ******************************************************************************/ 
+void sl_imu_get_calibration(sl_icm42688p_calib_record_t *record);
+
+/***************************************************************************//**
+ * @brief Apply a calibration, e.g. accel bias and scale from a multi-position
+ *        procedure, and store it. Only the parts flagged in valid are used.
+ ******************************************************************************/ 
+sl_status_t sl_imu_set_calibration(const sl_icm42688p_calib_record_t *record);
+
+/***************************************************************************//**
+ * @brief Take the next sample queued by the data-ready interrupt, if any.
  ******************************************************************************/ 
 bool sl_imu_is_data_ready(void);
 
+/***************************************************************************//**
+ * @brief Return the number of samples waiting to be taken.
+ ******************************************************************************/ 
+uint32_t sl_imu_get_pending_count(void);
+
+/***************************************************************************//**
+ * @brief Return the time of the data-ready edge of the current sample, in
+ *        sleeptimer ticks extended to 64 bits so it never wraps.
+ ******************************************************************************/ 
+uint64_t sl_imu_get_timestamp(void);
+
+/***************************************************************************//**
+ * @brief Return data-ready query, interrupt and queue counters.
+ ******************************************************************************/ 
+void sl_imu_get_stats(sl_imu_stats_t *stats);
+
+/***************************************************************************//**
+ * @brief Return the average number of SPI bytes clocked per acquired sample.
+ ******************************************************************************/ 
+float sl_imu_get_spi_bytes_per_sample(void);
+
 #ifdef __cplusplus
 }
 #endif
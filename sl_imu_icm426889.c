@@ -12,19 +12,84 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <math.h>
 
 #include "sl_icm42688p.h"
 #include "sl_icm42688p_defs.h"
+#include "sl_icm42688p_bias.h"
 #include "sl_imu.h"
 #include "sl_sleeptimer.h"
+#include "sl_common.h"
+#include "sl_core.h"
+
+#if (SL_ICM42688P_SAMPLE_RING_SIZE & (SL_ICM42688P_SAMPLE_RING_SIZE - 1U)) != 0
+#error "SL_ICM42688P_SAMPLE_RING_SIZE must be a power of two"
+#endif
+
+/* Retained copy of the sensor configuration, "IMUW" */
+#define IMU_WARM_MAGIC       0x494D5557UL
+#define IMU_WARM_SETTINGS    16U
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+typedef struct {
+    uint32_t magic;
+    uint16_t count;
+    sl_icm42688p_reg_setting_t settings[IMU_WARM_SETTINGS];
+    uint32_t crc;
+} IMU_WarmState_t;
+/** @endcond */
 
 /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
 static uint8_t IMU_state = IMU_STATE_DISABLED;
-static float sensorsSampleRate = 0;
+static float sensorsAccelRate = 0;
+static float sensorsGyroRate = 0;
+static float sensorsOutputRate = 0;
+static bool sensorsInterpolate = false;
+static sl_icm42688p_filter_config_t sensorsFilters;
+static bool sensorsFiltersValid = false;
+static bool sensorsFsync = false;
+static bool sensorsFsyncFalling = false;
 static uint32_t IMU_isDataReadyQueryCount = 0;
 static uint32_t IMU_isDataReadyTrueCount = 0;
+static sl_icm42688p_stamped_sample_t IMU_sample;
+static bool IMU_sampleValid = false;
+static uint32_t IMU_sampleCount = 0;
+static sl_icm42688p_ring_entry_t IMU_ringEntries[SL_ICM42688P_SAMPLE_RING_SIZE];
+static sl_icm42688p_ring_t IMU_ring;
+static sl_icm42688p_snapshot_t IMU_latest;
+/* IMU_calib.gyro_bias, .valid and IMU_gyroCorrection are also written by
+   IMU_trackBias() in the DRDY IRQ: read them through IMU_getCalibration()
+   and IMU_getGyroCorrection() while acquisition runs */
+static sl_icm42688p_calib_record_t IMU_calib;
+static float IMU_gyroCorrection[3];     /* bias left to the MCU, dps */
+static float IMU_accelCorrection[3];    /* bias left to the MCU, g */
+static float IMU_gyroOnSensor[3];       /* bias cancelled by the user offsets, dps */
+static sl_icm42688p_bias_t IMU_biasTracker;
+static bool IMU_biasTracking = false;
+static bool IMU_forceCalibration = false;
+static volatile bool IMU_gapPending = false;
+/* Not cleared by an MCU-only reset: what the sensor was last configured to */
+static IMU_WarmState_t IMU_warmState SL_ATTRIBUTE_SECTION(".noinit");
+static sl_icm42688p_profile_t IMU_warmProfile;
 /** @endcond */
 
+static bool IMU_readLatest(sl_imu_sample_t *sample);
+static void IMU_convert(const sl_icm42688p_stamped_sample_t *stamped, sl_imu_sample_t *sample);
+static void IMU_onDataReady(const sl_icm42688p_stamped_sample_t *sample, void *context);
+static sl_status_t IMU_calibrate(bool force);
+static void IMU_applyCalibration(const sl_icm42688p_calib_record_t *record);
+static sl_status_t IMU_updateGyroBias(const sl_icm42688p_gyro_bias_t *bias);
+static void IMU_configureBiasTracking(float accelRate, float gyroRate, float outputRate);
+static void IMU_applyMeasurementProfile(float accelRate, float gyroRate);
+static void IMU_saveWarmState(void);
+static const sl_icm42688p_profile_t *IMU_loadWarmState(void);
+static void IMU_trackBias(const sl_icm42688p_stamped_sample_t *stamped);
+static void IMU_getCalibration(sl_icm42688p_calib_record_t *record);
+static void IMU_getGyroCorrection(float correction[3]);
+#if SL_ICM42688P_CALIB_PERSIST_ENABLE
+static sl_status_t IMU_storeCalibration(void);
+#endif
+
 /***************************************************************************//**
  * Initialize and calibrate the IMU.
  ******************************************************************************/
@@ -32,12 +97,21 @@ sl_status_t sl_imu_init(void)
 {
     sl_status_t status;
     uint8_t devid;
-    float gyroBiasScaled[3];
+    bool force = IMU_forceCalibration;
 
     IMU_state = IMU_STATE_INITIALIZING;
-
-    /* Initialize ICM42688P driver */
+    IMU_forceCalibration = false;
+    IMU_biasTracking = false;
+    sl_icm42688p_calib_init(&IMU_calib);
+
+    /* Initialize ICM42688P driver; after an MCU-only reset a sensor still
+       configured the way sl_imu_configure_rates() left it, at any rate, is
+       kept without reset or power-up */
+#if SL_ICM42688P_WARM_RESTART_ENABLE
+    status = sl_icm42688p_init_warm(IMU_loadWarmState());
+#else
     status = sl_icm42688p_init();
+#endif
     if (status != SL_STATUS_OK) {
         goto cleanup;
     }
@@ -47,9 +121,8 @@ sl_status_t sl_imu_init(void)
         goto cleanup;
     }
 
-    /* Gyro calibration */
-    IMU_state = IMU_STATE_CALIBRATING;
-    status = sl_icm42688p_calibrate_gyro(gyroBiasScaled);
+    /* Stored calibration, or gyro calibration when there is none usable */
+    status = IMU_calibrate(force);
     if (status != SL_STATUS_OK) {
         goto cleanup;
     }
@@ -73,6 +146,8 @@ sl_status_t sl_imu_deinit(void)
     sl_status_t status;
 
     IMU_state = IMU_STATE_DISABLED;
+    IMU_warmState.magic = 0;
+    sl_icm42688p_drdy_stop();
     status = sl_icm42688p_deinit();
 
     return status;
@@ -90,60 +165,193 @@ uint8_t sl_imu_get_state(void)
  * Configure IMU sample rate and enable sensors.
  ******************************************************************************/
 void sl_imu_configure(float sampleRate)
+{
+    sl_imu_configure_rates(sampleRate, sampleRate, 0.0f, false);
+}
+
+/***************************************************************************//**
+ * Configure accel and gyro rates separately, optionally merged into aligned
+ * records at outputRate, and enable sensors.
+ ******************************************************************************/
+void sl_imu_configure_rates(float accelRate, float gyroRate, float outputRate, bool interpolate)
 {
     uint32_t itStatus;
 
     IMU_state = IMU_STATE_INITIALIZING;
 
-    /* Enable accelerometer and gyroscope */
-    sl_icm42688p_enable_sensor(true, true, false);
+    /* Blocking register access below must not race DRDY reads; a reset
+       half way through must not find a warm state to keep */
+    sl_icm42688p_drdy_stop();
+    IMU_warmState.magic = 0;
 
-    /* Set sample rate */
-    sensorsSampleRate = sl_icm42688p_set_sample_rate(sampleRate);
+    /* 2 g / 250 dps, DRDY on INT1, at the requested ODRs: only registers
+       that differ from the shadow go out, merged into auto-increment bursts */
+    IMU_applyMeasurementProfile(accelRate, gyroRate);
 
-    /* Set full-scale ranges */
-    sl_icm42688p_set_full_scale_accel(ICM42688P_ACCEL_CONFIG0_FS_2G);
-    sl_icm42688p_set_full_scale_gyro(ICM42688P_GYRO_CONFIG0_FS_250DPS);
+    /* The nearest supported ODR per sensor, 12.5 Hz to 32 kHz, is kept
+       exactly; the writes are no-ops unless the profile could not hold them */
+    if (sl_icm42688p_set_sample_rates(&accelRate, &gyroRate) != SL_STATUS_OK) {
+        accelRate = gyroRate = sl_icm42688p_set_sample_rate(gyroRate);
+    }
+    sensorsAccelRate = accelRate;
+    sensorsGyroRate = gyroRate;
+
+    /* DRDY follows the faster sensor; the merge puts out one record per
+       output period with the slower one held or interpolated */
+    if (sl_icm42688p_set_merge(outputRate,
+                               interpolate ? SL_ICM42688P_MERGE_INTERPOLATE : SL_ICM42688P_MERGE_HOLD)
+        != SL_STATUS_OK) {
+        outputRate = 0.0f;
+        sl_icm42688p_set_merge(0.0f, SL_ICM42688P_MERGE_HOLD);
+    }
+    sensorsOutputRate = outputRate;
+    sensorsInterpolate = interpolate;
+
+    /* The profile put the UI filters back to their defaults; the filter
+       bandwidths follow the ODRs just set */
+    if (sensorsFiltersValid) {
+        sl_icm42688p_set_filters(&sensorsFilters);
+    }
 
-    /* Set bandwidth / ODR */
-    sl_icm42688p_accel_set_bandwidth(ICM42688P_ODR_CODE_1KHZ);   // 1 kHz accel BW
-    sl_icm42688p_gyro_set_bandwidth(ICM42688P_GYRO_ODR_200HZ);   // 200 Hz gyro BW
+    /* A reset in between put pin 9 back to INT2 */
+    if (sensorsFsync) {
+        sl_icm42688p_set_fsync(true, sensorsFsyncFalling);
+    }
 
-    sl_sleeptimer_delay_millisecond(50);
+    /* Stillness limits follow the rates just set */
+    IMU_configureBiasTracking(accelRate, gyroRate, outputRate);
 
-    /* Enable raw data ready interrupt */
-    sl_icm42688p_enable_interrupt(true);
+    /* What a warm restart compares the sensor against */
+    IMU_saveWarmState();
 
     /* Clear interrupts */
     sl_icm42688p_read_interrupt_status(&itStatus);
 
+    /* Start bus accounting from the streaming state */
+    IMU_sampleValid = false;
+    IMU_sampleCount = 0;
+    sl_icm42688p_ring_init(&IMU_ring, IMU_ringEntries, SL_ICM42688P_SAMPLE_RING_SIZE);
+    sl_icm42688p_snapshot_init(&IMU_latest);
+    IMU_isDataReadyQueryCount = 0;
+    IMU_isDataReadyTrueCount = 0;
+    sl_icm42688p_clear_spi_stats();
+
+    /* From here on samples arrive through the DRDY interrupt */
+    sl_icm42688p_drdy_start(IMU_onDataReady, NULL);
+
     IMU_state = IMU_STATE_READY;
 }
 
 /***************************************************************************//**
- * Retrieve raw acceleration data from the IMU.
+ * On-sensor filters, kept across reconfiguration.
+ ******************************************************************************/
+sl_status_t sl_imu_configure_filters(sl_icm42688p_filter_config_t *config)
+{
+    sl_status_t status;
+
+    if (!config) {
+        return SL_STATUS_NULL_POINTER;
+    }
+
+    /* Register access in banks 1 and 2 must not race DRDY reads */
+    sl_icm42688p_drdy_stop();
+    IMU_warmState.magic = 0;
+    status = sl_icm42688p_set_filters(config);
+    if (status == SL_STATUS_OK) {
+        sensorsFilters = *config;
+        sensorsFiltersValid = true;
+    }
+    if (IMU_state == IMU_STATE_READY) {
+        IMU_saveWarmState();
+    }
+    if (IMU_state == IMU_STATE_READY) {
+        sl_icm42688p_drdy_start(IMU_onDataReady, NULL);
+    }
+
+    return status;
+}
+
+/***************************************************************************//**
+ * External FSYNC tagging, kept across reconfiguration.
+ ******************************************************************************/
+sl_status_t sl_imu_configure_fsync(bool enable, bool fallingEdge)
+{
+    sl_status_t status;
+
+    /* The DRDY burst length follows the setting; a reset half way through
+       must not find a warm state to keep */
+    sl_icm42688p_drdy_stop();
+    IMU_warmState.magic = 0;
+    status = sl_icm42688p_set_fsync(enable, fallingEdge);
+    if (status == SL_STATUS_OK) {
+        sensorsFsync = enable;
+        sensorsFsyncFalling = fallingEdge;
+    }
+    if (IMU_state == IMU_STATE_READY) {
+        IMU_saveWarmState();
+        sl_icm42688p_drdy_start(IMU_onDataReady, NULL);
+    }
+
+    return status;
+}
+
+/***************************************************************************//**
+ * Retrieve the latest acceleration from the snapshot. No SPI access.
  ******************************************************************************/
 void sl_imu_get_acceleration(float avec[3])
 {
-    if (IMU_state != IMU_STATE_READY) {
+    sl_imu_sample_t sample;
+
+    if (!IMU_readLatest(&sample)) {
         avec[0] = avec[1] = avec[2] = 0;
         return;
     }
 
-    sl_icm42688p_accel_read_data(avec);
+    avec[0] = sample.accel[0];
+    avec[1] = sample.accel[1];
+    avec[2] = sample.accel[2];
 }
 
 /***************************************************************************//**
- * Retrieve raw gyroscope data from the IMU.
+ * Retrieve the latest angular rate from the snapshot. No SPI access.
  ******************************************************************************/
 void sl_imu_get_gyro(float gvec[3])
 {
-    if (IMU_state != IMU_STATE_READY) {
+    sl_imu_sample_t sample;
+
+    if (!IMU_readLatest(&sample)) {
         gvec[0] = gvec[1] = gvec[2] = 0;
         return;
     }
 
-    sl_icm42688p_gyro_read_data(gvec);
+    gvec[0] = sample.gyro[0];
+    gvec[1] = sample.gyro[1];
+    gvec[2] = sample.gyro[2];
+}
+
+/***************************************************************************//**
+ * Coherent accel + gyro + temperature + timestamp of the latest sample.
+ ******************************************************************************/
+bool sl_imu_get_latest(sl_imu_sample_t *sample)
+{
+    if (!sample) {
+        return false;
+    }
+
+    return IMU_readLatest(sample);
+}
+
+/***************************************************************************//**
+ * The sample taken by the last successful sl_imu_is_data_ready().
+ ******************************************************************************/
+bool sl_imu_get_sample(sl_imu_sample_t *sample)
+{
+    if (!sample || IMU_state != IMU_STATE_READY || !IMU_sampleValid) {
+        return false;
+    }
+
+    IMU_convert(&IMU_sample, sample);
+    return true;
 }
 
 /***************************************************************************//**
@@ -151,34 +359,559 @@ void sl_imu_get_gyro(float gvec[3])
  ******************************************************************************/
 sl_status_t sl_imu_calibrate_gyro(void)
 {
+    sl_icm42688p_gyro_bias_t bias;
+    bool running = (IMU_state == IMU_STATE_READY);
     sl_status_t status;
 
-    /* Disable interrupts during calibration */
-    sl_icm42688p_enable_interrupt(false);
-    sl_imu_deinit();
-    status = sl_imu_init();
-    sl_imu_configure(sensorsSampleRate);
+    /* Not brought up: full init with a forced calibration. A failed init
+       has deinitialised the sensor; rates are only restored when
+       sl_imu_configure_rates() has set some (the rates start at 0). */
+    if (IMU_state == IMU_STATE_DISABLED) {
+        IMU_forceCalibration = true;
+        status = sl_imu_init();
+        if (status != SL_STATUS_OK) {
+            return status;
+        }
+        if (sensorsGyroRate > 0.0f) {
+            sl_imu_configure_rates(sensorsAccelRate, sensorsGyroRate, sensorsOutputRate, sensorsInterpolate);
+        }
+        return SL_STATUS_OK;
+    }
+
+    /* In place: the sensor keeps its configuration and the stream pauses
+       for the burst window only */
+    sl_icm42688p_drdy_stop();
+    IMU_state = IMU_STATE_CALIBRATING;
+
+    status = sl_icm42688p_measure_gyro_bias(SL_ICM42688P_RECAL_SAMPLES, &bias);
+    if (status == SL_STATUS_OK) {
+        status = IMU_updateGyroBias(&bias);
+    }
+
+    /* Samples already queued stay; the first new one carries the gap */
+    IMU_state = IMU_STATE_INITIALIZING;
+    if (running) {
+        IMU_gapPending = true;
+        sl_icm42688p_drdy_start(IMU_onDataReady, NULL);
+        IMU_state = IMU_STATE_READY;
+    }
+
+#if SL_ICM42688P_CALIB_PERSIST_ENABLE
+    /* Off the critical path: the stream is already running again */
+    if (status == SL_STATUS_OK) {
+        (void)IMU_storeCalibration();
+    }
+#endif
 
     return status;
 }
 
 /***************************************************************************//**
- * Check if new accel/gyro data is available.
+ * Calibration currently applied to samples.
  ******************************************************************************/
-bool sl_imu_is_data_ready(void)
+void sl_imu_get_calibration(sl_icm42688p_calib_record_t *record)
 {
-    bool ready;
+    if (record) {
+        IMU_getCalibration(record);
+    }
+}
+
+/***************************************************************************//**
+ * Apply a calibration measured elsewhere and keep it for the next boots.
+ ******************************************************************************/
+sl_status_t sl_imu_set_calibration(const sl_icm42688p_calib_record_t *record)
+{
+    bool running = (IMU_state == IMU_STATE_READY);
+
+    if (!record) {
+        return SL_STATUS_INVALID_PARAMETER;
+    }
+
+    /* The user offsets are in bank 4: acquisition pauses while they change */
+    sl_icm42688p_drdy_stop();
+    IMU_applyCalibration(record);
+    if (running) {
+        sl_imu_configure_rates(sensorsAccelRate, sensorsGyroRate, sensorsOutputRate, sensorsInterpolate);
+    }
+#if SL_ICM42688P_CALIB_PERSIST_ENABLE
+    return IMU_storeCalibration();
+#else
+    return SL_STATUS_OK;
+#endif
+}
 
+/***************************************************************************//**
+ * Take the oldest sample queued by the DRDY interrupt, if any. No SPI access.
+ ******************************************************************************/
+bool sl_imu_is_data_ready(void)
+{
     if (IMU_state != IMU_STATE_READY) {
         return false;
     }
 
-    ready = sl_icm42688p_is_data_ready();
     IMU_isDataReadyQueryCount++;
 
-    if (ready) {
-        IMU_isDataReadyTrueCount++;
+    if (!sl_icm42688p_ring_pop(&IMU_ring, &IMU_sample)) {
+        return false;
+    }
+
+    IMU_isDataReadyTrueCount++;
+    IMU_sampleValid = true;
+
+    return true;
+}
+
+/***************************************************************************//**
+ * Number of samples waiting in the ring.
+ ******************************************************************************/
+uint32_t sl_imu_get_pending_count(void)
+{
+    return sl_icm42688p_ring_count(&IMU_ring);
+}
+
+/***************************************************************************//**
+ * 64-bit sleeptimer time of the DRDY edge of the current sample.
+ ******************************************************************************/
+uint64_t sl_imu_get_timestamp(void)
+{
+    return IMU_sample.timestamp;
+}
+
+/***************************************************************************//**
+ * Data-ready polling, interrupt and queue counters.
+ ******************************************************************************/
+void sl_imu_get_stats(sl_imu_stats_t *stats)
+{
+    sl_icm42688p_drdy_stats_t drdy;
+    sl_icm42688p_drift_stats_t drift;
+
+    if (!stats) {
+        return;
+    }
+
+    sl_icm42688p_get_drdy_stats(&drdy);
+    sl_icm42688p_get_drift_stats(&drift);
+
+    stats->dataReadyQueries = IMU_isDataReadyQueryCount;
+    stats->dataReadyTrue = IMU_isDataReadyTrueCount;
+    stats->isrEdges = drdy.edges;
+    stats->isrSamples = drdy.samples;
+    stats->isrMissed = drdy.missed;
+    stats->queueOverflows = IMU_ring.overflows;
+    stats->odrErrorPpb = drift.error_ppb;
+    stats->samplePeriodNs = drift.period_ns;
+    stats->biasWindows = IMU_biasTracker.windows;
+    stats->biasStillWindows = IMU_biasTracker.still_windows;
+    stats->still = IMU_biasTracking && IMU_biasTracker.still;
+}
+
+/***************************************************************************//**
+ * Average SPI bytes clocked per acquired sample, polling included.
+ ******************************************************************************/
+float sl_imu_get_spi_bytes_per_sample(void)
+{
+    sl_icm42688p_spi_stats_t stats;
+
+    if (IMU_sampleCount == 0) {
+        return 0.0f;
     }
 
-    return ready;
+    sl_icm42688p_get_spi_stats(&stats);
+
+    return (float)stats.bytes / (float)IMU_sampleCount;
+}
+
+/***************************************************************************//**
+ * LDMA IRQ: queue the sample read after a DRDY edge; a full ring counts an
+ * overflow and keeps the older samples.
+ ******************************************************************************/
+static void IMU_onDataReady(const sl_icm42688p_stamped_sample_t *sample, void *context)
+{
+    sl_icm42688p_stamped_sample_t marked;
+
+    (void)context;
+
+    if (IMU_gapPending) {
+        marked = *sample;
+        marked.flags |= SL_ICM42688P_SAMPLE_GAP;
+        sample = &marked;
+        IMU_gapPending = false;
+    }
+
+    if (IMU_biasTracking) {
+        IMU_trackBias(sample);
+    }
+
+    sl_icm42688p_snapshot_write(&IMU_latest, sample);
+    if (sl_icm42688p_ring_push(&IMU_ring, sample)) {
+        IMU_sampleCount++;
+    }
+}
+
+/***************************************************************************//**
+ * Copy and convert the latest sample without locking the writer out.
+ ******************************************************************************/
+static bool IMU_readLatest(sl_imu_sample_t *sample)
+{
+    sl_icm42688p_stamped_sample_t stamped;
+
+    if (IMU_state != IMU_STATE_READY || !sl_icm42688p_snapshot_read(&IMU_latest, &stamped)) {
+        return false;
+    }
+
+    IMU_convert(&stamped, sample);
+    return true;
+}
+
+/***************************************************************************//**
+ * Use the stored calibration when it was taken near the current temperature;
+ * measure the gyro bias otherwise, or always with force, and store the
+ * result. Accel bias and scale only come from sl_imu_set_calibration() and
+ * are kept across gyro calibrations.
+ ******************************************************************************/
+static sl_status_t IMU_calibrate(bool force)
+{
+    sl_icm42688p_calib_record_t record;
+    sl_icm42688p_calib_result_t result = SL_ICM42688P_CALIB_MISSING;
+    float temperature;
+    sl_status_t status;
+
+#if SL_ICM42688P_CALIB_PERSIST_ENABLE
+    sl_icm42688p_load_calibration(&record, &result);
+#else
+    sl_icm42688p_calib_init(&record);
+#endif
+
+    /* The temperature registers are valid with the first sample */
+    status = sl_icm42688p_wait_data_ready(SL_ICM42688P_STARTUP_TIMEOUT_MS);
+    if (status != SL_STATUS_OK) {
+        return status;
+    }
+    status = sl_icm42688p_read_temperature(&temperature);
+    if (status != SL_STATUS_OK) {
+        return status;
+    }
+
+    if (!force && result == SL_ICM42688P_CALIB_OK && (record.valid & SL_ICM42688P_CALIB_GYRO)
+        && !sl_icm42688p_calib_is_stale(&record, temperature, (float)SL_ICM42688P_CALIB_MAX_TEMP_DELTA)) {
+        IMU_applyCalibration(&record);
+        return SL_STATUS_OK;
+    }
+
+    /* Offsets left on the sensor would only leave the residual to measure */
+    IMU_state = IMU_STATE_CALIBRATING;
+    status = sl_icm42688p_set_user_offsets(NULL, NULL);
+    if (status != SL_STATUS_OK) {
+        return status;
+    }
+    status = sl_icm42688p_calibrate_gyro(record.gyro_bias);
+    if (status != SL_STATUS_OK) {
+        return status;
+    }
+    record.valid |= SL_ICM42688P_CALIB_GYRO;
+    record.temperature = temperature;
+    IMU_applyCalibration(&record);
+
+#if SL_ICM42688P_CALIB_PERSIST_ENABLE
+    /* A failed store leaves the calibration applied; the next boot measures
+       again */
+    (void)IMU_storeCalibration();
+#endif
+
+    return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Take a burst bias measurement as the new gyro bias unless it shows motion:
+ * a variance well above the sensor noise, or a bias no sensor at rest has.
+ * The measurement includes what the user offsets already cancel.
+ ******************************************************************************/
+static sl_status_t IMU_updateGyroBias(const sl_icm42688p_gyro_bias_t *bias)
+{
+    sl_icm42688p_calib_record_t record = IMU_calib;
+    float temperature;
+    sl_status_t status;
+
+    for (int i = 0; i < 3; i++) {
+        float total = bias->mean[i] + IMU_gyroOnSensor[i];
+
+        if (bias->variance[i] > (float)SL_ICM42688P_RECAL_MOTION_FACTOR * bias->noise_variance
+            || fabsf(total) > (float)SL_ICM42688P_RECAL_MAX_BIAS_DPS) {
+            return SL_STATUS_ABORT;
+        }
+        record.gyro_bias[i] = total;
+    }
+
+    status = sl_icm42688p_read_temperature(&temperature);
+    if (status != SL_STATUS_OK) {
+        return status;
+    }
+    record.valid |= SL_ICM42688P_CALIB_GYRO;
+    record.temperature = temperature;
+    IMU_applyCalibration(&record);
+
+    return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Take record as the calibration in use, neutral for the parts it lacks.
+ * Biases go into the sensor's user offsets when they fit, so FIFO data is
+ * corrected too; otherwise the MCU subtracts them. Acquisition must be
+ * stopped.
+ ******************************************************************************/
+static void IMU_applyCalibration(const sl_icm42688p_calib_record_t *record)
+{
+    sl_icm42688p_calib_record_t neutral;
+    bool onSensor = false;
+
+    sl_icm42688p_calib_init(&neutral);
+    IMU_calib = *record;
+
+    if (!(record->valid & SL_ICM42688P_CALIB_GYRO)) {
+        for (int i = 0; i < 3; i++) {
+            IMU_calib.gyro_bias[i] = neutral.gyro_bias[i];
+        }
+    }
+    if (!(record->valid & SL_ICM42688P_CALIB_ACCEL)) {
+        for (int i = 0; i < 3; i++) {
+            IMU_calib.accel_bias[i] = neutral.accel_bias[i];
+            IMU_calib.accel_scale[i] = neutral.accel_scale[i];
+        }
+    }
+
+#if SL_ICM42688P_CALIB_ON_SENSOR
+    onSensor = (sl_icm42688p_set_user_offsets(IMU_calib.gyro_bias, IMU_calib.accel_bias) == SL_STATUS_OK);
+    if (!onSensor) {
+        /* Zero offsets are always in range; only a bus failure is left, and
+           the MCU correction below is the best there is then */
+        (void)sl_icm42688p_set_user_offsets(NULL, NULL);
+    }
+#endif
+
+    for (int i = 0; i < 3; i++) {
+        IMU_gyroOnSensor[i] = onSensor ? IMU_calib.gyro_bias[i] : 0.0f;
+        IMU_gyroCorrection[i] = onSensor ? 0.0f : IMU_calib.gyro_bias[i];
+        IMU_accelCorrection[i] = onSensor ? 0.0f : IMU_calib.accel_bias[i];
+    }
+
+    /* Tracking goes on from the new bias */
+    if (IMU_biasTracking) {
+        sl_icm42688p_bias_reset(&IMU_biasTracker, IMU_calib.gyro_bias);
+    }
+}
+
+/***************************************************************************//**
+ * The measurement profile with the ODR fields at the requested rates, so a
+ * sensor kept by a warm restart at the same rates sees no writes at all.
+ ******************************************************************************/
+static void IMU_applyMeasurementProfile(float accelRate, float gyroRate)
+{
+    const sl_icm42688p_profile_t *base = &sl_icm42688p_profile_measurement;
+    const sl_icm42688p_odr_info_t *accelOdr = sl_icm42688p_odr_nearest(accelRate, SL_ICM42688P_ODR_ACCEL_LN);
+    const sl_icm42688p_odr_info_t *gyroOdr = sl_icm42688p_odr_nearest(gyroRate, SL_ICM42688P_ODR_GYRO);
+    sl_icm42688p_reg_setting_t settings[IMU_WARM_SETTINGS];
+    sl_icm42688p_profile_t profile = SL_ICM42688P_PROFILE("measurement", settings);
+
+    if (base->count > IMU_WARM_SETTINGS) {
+        sl_icm42688p_apply_profile(base);
+        return;
+    }
+
+    profile.count = base->count;
+    for (uint16_t i = 0; i < base->count; ++i) {
+        settings[i] = base->settings[i];
+        if (settings[i].bank != ICM42688P_BANK_0) {
+            continue;
+        }
+        if (settings[i].reg == ICM42688P_REG_ACCEL_CONFIG0 && accelOdr) {
+            settings[i].value = (uint8_t)((settings[i].value & ~ICM42688P_ACCEL_ODR_MASK) | accelOdr->code);
+        } else if (settings[i].reg == ICM42688P_REG_GYRO_CONFIG0 && gyroOdr) {
+            settings[i].value = (uint8_t)((settings[i].value & ~ICM42688P_GYRO_ODR_MASK) | gyroOdr->code);
+        }
+    }
+
+    sl_icm42688p_apply_profile(&profile);
+}
+
+/***************************************************************************//**
+ * Record the current value of every measurement profile register in RAM that
+ * survives an MCU-only reset (watchdog, OTA reboot). Single-byte reads of
+ * configuration registers come from the driver shadow.
+ ******************************************************************************/
+static void IMU_saveWarmState(void)
+{
+    const sl_icm42688p_profile_t *base = &sl_icm42688p_profile_measurement;
+    sl_status_t status = SL_STATUS_OK;
+
+    IMU_warmState.magic = 0;
+    if (base->count > IMU_WARM_SETTINGS) {
+        return;
+    }
+
+    for (uint16_t i = 0; status == SL_STATUS_OK && i < base->count; ++i) {
+        sl_icm42688p_reg_setting_t *setting = &IMU_warmState.settings[i];
+
+        setting->bank = base->settings[i].bank;
+        setting->reg = base->settings[i].reg;
+        status = sl_icm42688p_set_bank(setting->bank);
+        if (status == SL_STATUS_OK) {
+            status = sl_icm42688p_read_register(setting->reg, &setting->value, 1);
+        }
+    }
+    sl_icm42688p_set_bank(ICM42688P_BANK_0);
+    if (status != SL_STATUS_OK) {
+        return;
+    }
+
+    IMU_warmState.count = base->count;
+    IMU_warmState.crc = sl_icm42688p_calib_crc32(&IMU_warmState.count,
+                                                 (uint32_t)(sizeof(IMU_warmState.count)
+                                                            + sizeof(IMU_warmState.settings)));
+    IMU_warmState.magic = IMU_WARM_MAGIC;
+}
+
+/***************************************************************************//**
+ * The profile a warm restart compares the sensor against: the retained state
+ * when it is intact, else the measurement profile at its default rate (after
+ * a power-on reset the sensor is at its reset defaults and matches neither).
+ ******************************************************************************/
+static const sl_icm42688p_profile_t *IMU_loadWarmState(void)
+{
+    uint32_t crc;
+
+    if (IMU_warmState.magic != IMU_WARM_MAGIC || IMU_warmState.count > IMU_WARM_SETTINGS) {
+        return &sl_icm42688p_profile_measurement;
+    }
+    crc = sl_icm42688p_calib_crc32(&IMU_warmState.count,
+                                   (uint32_t)(sizeof(IMU_warmState.count) + sizeof(IMU_warmState.settings)));
+    if (crc != IMU_warmState.crc) {
+        return &sl_icm42688p_profile_measurement;
+    }
+
+    IMU_warmProfile.name = "warm";
+    IMU_warmProfile.settings = IMU_warmState.settings;
+    IMU_warmProfile.count = IMU_warmState.count;
+    return &IMU_warmProfile;
+}
+
+/***************************************************************************//**
+ * Background bias tracking: windows of SL_ICM42688P_BIAS_TRACK_WINDOW_MS at
+ * the DRDY rate, sliding by half their length, still when both sensors stay
+ * within a multiple of their noise at rest at the ODRs in use.
+ ******************************************************************************/
+static void IMU_configureBiasTracking(float accelRate, float gyroRate, float outputRate)
+{
+    const sl_icm42688p_odr_info_t *accelOdr = sl_icm42688p_odr_nearest(accelRate, SL_ICM42688P_ODR_ACCEL_LN);
+    const sl_icm42688p_odr_info_t *gyroOdr = sl_icm42688p_odr_nearest(gyroRate, SL_ICM42688P_ODR_GYRO);
+    float rate = (outputRate > 0.0f) ? outputRate : ((accelRate > gyroRate) ? accelRate : gyroRate);
+    float window = rate * (float)SL_ICM42688P_BIAS_TRACK_WINDOW_MS / 1000.0f;
+    sl_icm42688p_bias_config_t config;
+
+    IMU_biasTracking = false;
+    if (!SL_ICM42688P_BIAS_TRACK_ENABLE || !accelOdr || !gyroOdr) {
+        return;
+    }
+
+    config.window = (window < 2.0f) ? 2U : (window > 65535.0f) ? 65535U : (uint16_t)window;
+    config.gyro_var_max = (float)SL_ICM42688P_BIAS_TRACK_MOTION_FACTOR * gyroOdr->gyro_noise_var;
+    config.accel_var_max = (float)SL_ICM42688P_BIAS_TRACK_MOTION_FACTOR * accelOdr->accel_noise_var;
+    config.max_deviation = (float)SL_ICM42688P_BIAS_TRACK_MAX_DEV_MDPS / 1000.0f;
+    config.smooth_shift = SL_ICM42688P_BIAS_TRACK_SMOOTH_SHIFT;
+
+    sl_icm42688p_bias_init(&IMU_biasTracker, &config, IMU_calib.gyro_bias);
+    IMU_biasTracking = true;
+}
+
+/***************************************************************************//**
+ * DRDY context: feed the tracker the gyro as the sensor measured it, before
+ * any correction. A new bias is taken over by the MCU correction; the user
+ * offsets are in bank 4, out of reach while acquisition runs, and stay
+ * until the next calibration pushes the total.
+ ******************************************************************************/
+static void IMU_trackBias(const sl_icm42688p_stamped_sample_t *stamped)
+{
+    sl_icm42688p_sample_t converted;
+    float gyro[3];
+
+    sl_icm42688p_convert_samples(&stamped->raw, 1, sl_icm42688p_get_scale(), &converted);
+    for (int i = 0; i < 3; i++) {
+        gyro[i] = converted.gyro[i] + IMU_gyroOnSensor[i];
+    }
+
+    if (sl_icm42688p_bias_push(&IMU_biasTracker, gyro, converted.accel)) {
+        for (int i = 0; i < 3; i++) {
+            IMU_calib.gyro_bias[i] = IMU_biasTracker.bias[i];
+            IMU_gyroCorrection[i] = IMU_biasTracker.bias[i] - IMU_gyroOnSensor[i];
+        }
+        IMU_calib.valid |= SL_ICM42688P_CALIB_GYRO;
+    }
+}
+
+/***************************************************************************//**
+ * Coherent copy of the calibration in use. IMU_trackBias() updates it from
+ * the DRDY IRQ, which cannot run while interrupts are masked.
+ ******************************************************************************/
+static void IMU_getCalibration(sl_icm42688p_calib_record_t *record)
+{
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+    *record = IMU_calib;
+    CORE_EXIT_ATOMIC();
+}
+
+/***************************************************************************//**
+ * Coherent copy of the gyro bias the MCU subtracts, all axes from the same
+ * IMU_trackBias() update.
+ ******************************************************************************/
+static void IMU_getGyroCorrection(float correction[3])
+{
+    CORE_DECLARE_IRQ_STATE;
+
+    CORE_ENTER_ATOMIC();
+    for (int i = 0; i < 3; i++) {
+        correction[i] = IMU_gyroCorrection[i];
+    }
+    CORE_EXIT_ATOMIC();
+}
+
+#if SL_ICM42688P_CALIB_PERSIST_ENABLE
+/***************************************************************************//**
+ * Seal and store a private copy: the store writes sequence and CRC into the
+ * record, and IMU_calib may change under it once acquisition runs.
+ ******************************************************************************/
+static sl_status_t IMU_storeCalibration(void)
+{
+    sl_icm42688p_calib_record_t record;
+
+    IMU_getCalibration(&record);
+    return sl_icm42688p_store_calibration(&record);
+}
+#endif
+
+/***************************************************************************//**
+ * Raw to physical units, with the scale of the FS currently configured and
+ * the calibration applied.
+ ******************************************************************************/
+static void IMU_convert(const sl_icm42688p_stamped_sample_t *stamped, sl_imu_sample_t *sample)
+{
+    sl_icm42688p_sample_t converted;
+    float gyroCorrection[3];
+
+    sl_icm42688p_convert_samples(&stamped->raw, 1, sl_icm42688p_get_scale(), &converted);
+    IMU_getGyroCorrection(gyroCorrection);
+
+    for (int i = 0; i < 3; i++) {
+        sample->accel[i] = (converted.accel[i] - IMU_accelCorrection[i]) * IMU_calib.accel_scale[i];
+        sample->gyro[i] = converted.gyro[i] - gyroCorrection[i];
+    }
+    sample->temperature = converted.temperature;
+    sample->timestamp = stamped->timestamp;
+    sample->accelFresh = (stamped->flags & SL_ICM42688P_SAMPLE_ACCEL_FRESH) != 0;
+    sample->gyroFresh = (stamped->flags & SL_ICM42688P_SAMPLE_GYRO_FRESH) != 0;
+    sample->fsync = (stamped->flags & SL_ICM42688P_SAMPLE_FSYNC) != 0;
+    sample->gap = (stamped->flags & SL_ICM42688P_SAMPLE_GAP) != 0;
+    sample->fsyncTimestamp = sample->fsync
+                             ? stamped->timestamp - ((stamped->fsync_q16 + 0x8000U) >> 16)
+                             : 0;
 }
@@ -0,0 +1,92 @@
+/***************************************************************************//**
+ * @file
+ * @brief RAM model of a flash page for the ICM42688P host tests
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Behaves like the MSC page the calibration store uses on target: erase
+ * sets every byte to 0xFF, programming can only clear bits, and writes must
+ * be word aligned. A write can be torn after a given number of bytes, as a
+ * reset in the middle of programming would leave it.
+ ******************************************************************************/
+
+#ifndef RAM_FLASH_H
+#define RAM_FLASH_H
+
+#include <stdint.h>
+#include <string.h>
+#include "sl_icm42688p_calib.h"
+
+#define RAM_FLASH_PAGE_SIZE   8192U
+
+typedef struct {
+  uint8_t  page[RAM_FLASH_PAGE_SIZE];
+  uint32_t erases;
+  uint32_t writes;
+  uint32_t overwrites;   /* programmed bytes that were not erased first */
+  int32_t  tear_after;   /* bytes the next write programs before failing, < 0: never */
+} ram_flash_t;
+
+static sl_status_t ram_flash_read(uint32_t offset, void *data, uint32_t len, void *context)
+{
+  ram_flash_t *flash = context;
+
+  if (offset > RAM_FLASH_PAGE_SIZE || len > RAM_FLASH_PAGE_SIZE - offset) {
+    return SL_STATUS_INVALID_RANGE;
+  }
+  memcpy(data, &flash->page[offset], len);
+  return SL_STATUS_OK;
+}
+
+static sl_status_t ram_flash_erase(void *context)
+{
+  ram_flash_t *flash = context;
+
+  memset(flash->page, 0xFF, sizeof(flash->page));
+  flash->erases++;
+  return SL_STATUS_OK;
+}
+
+static sl_status_t ram_flash_write(uint32_t offset, const void *data, uint32_t len, void *context)
+{
+  ram_flash_t *flash = context;
+  const uint8_t *src = data;
+
+  if (((offset | len) & 3U) != 0) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  if (offset > RAM_FLASH_PAGE_SIZE || len > RAM_FLASH_PAGE_SIZE - offset) {
+    return SL_STATUS_INVALID_RANGE;
+  }
+
+  flash->writes++;
+  for (uint32_t i = 0; i < len; ++i) {
+    if (flash->tear_after >= 0 && i >= (uint32_t)flash->tear_after) {
+      flash->tear_after = -1;
+      return SL_STATUS_FAIL;
+    }
+    if (flash->page[offset + i] != 0xFFU) {
+      flash->overwrites++;
+    }
+    flash->page[offset + i] &= src[i];
+  }
+  return SL_STATUS_OK;
+}
+
+/* Erased page and the backend that reaches it */
+static inline void ram_flash_init(ram_flash_t *flash, sl_icm42688p_calib_flash_t *backend)
+{
+  memset(flash, 0, sizeof(*flash));
+  memset(flash->page, 0xFF, sizeof(flash->page));
+  flash->tear_after = -1;
+
+  backend->page_size = RAM_FLASH_PAGE_SIZE;
+  backend->read = ram_flash_read;
+  backend->erase = ram_flash_erase;
+  backend->write = ram_flash_write;
+  backend->context = flash;
+}
+
+#endif // RAM_FLASH_H
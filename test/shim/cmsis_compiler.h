@@ -0,0 +1,55 @@
+/***************************************************************************//**
+ * @file
+ * @brief C models of the Cortex-M DSP intrinsics, for host tests
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Stands in for CMSIS cmsis_compiler.h when a module is built on a host with
+ * __ARM_FEATURE_DSP defined, so its DSP backend runs against the portable
+ * one. Only the intrinsics the driver uses, with the Armv7E-M semantics.
+ ******************************************************************************/
+
+#ifndef TEST_SHIM_CMSIS_COMPILER_H
+#define TEST_SHIM_CMSIS_COMPILER_H
+
+#include <stdint.h>
+
+static inline int32_t shim_sat(int64_t v, uint32_t bits)
+{
+  int64_t max = ((int64_t)1 << (bits - 1U)) - 1;
+  int64_t min = -max - 1;
+
+  return (int32_t)((v > max) ? max : (v < min) ? min : v);
+}
+
+static inline uint32_t __REV16(uint32_t v)
+{
+  return ((v & 0x00FF00FFU) << 8) | ((v >> 8) & 0x00FF00FFU);
+}
+
+static inline uint32_t __QSUB16(uint32_t a, uint32_t b)
+{
+  int32_t lo = shim_sat((int64_t)(int16_t)a - (int16_t)b, 16U);
+  int32_t hi = shim_sat((int64_t)(int16_t)(a >> 16) - (int16_t)(b >> 16), 16U);
+
+  return (uint32_t)(uint16_t)lo | ((uint32_t)(uint16_t)hi << 16);
+}
+
+/* The sum wraps on overflow, as the instruction does (it only sets Q) */
+static inline uint32_t __SMUAD(uint32_t a, uint32_t b)
+{
+  int64_t sum = (int64_t)(int16_t)a * (int16_t)b + (int64_t)(int16_t)(a >> 16) * (int16_t)(b >> 16);
+
+  return (uint32_t)sum;
+}
+
+static inline int32_t __QADD(int32_t a, int32_t b)
+{
+  return shim_sat((int64_t)a + b, 32U);
+}
+
+#define __SSAT(val, bits)   shim_sat((int64_t)(val), (bits))
+
+#endif // TEST_SHIM_CMSIS_COMPILER_H
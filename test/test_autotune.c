@@ -0,0 +1,145 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of the ICM42688P SPI bit rate search
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * The link is a simulated sensor behind an integer clock divider. Reads
+ * fail above a set rate, or once a read budget runs out.
+ ******************************************************************************/
+
+#include <stdbool.h>
+#include "sl_icm42688p_autotune.h"
+#include "sl_icm42688p_defs.h"
+#include "test_support.h"
+
+#define SIM_CLOCK_HZ       78000000U
+#define SIM_SENSOR_MAX_HZ  24000000U
+#define SIM_SAVED          0x10U
+
+typedef struct {
+  bool     round_up;        /* divider truncated, as the SDK helpers do */
+  uint32_t fail_above;      /* reads fail above this rate */
+  int32_t  read_budget;     /* reads that succeed, < 0 for no limit */
+  uint32_t bitrate;
+  uint32_t highest_programmed;
+  uint8_t  pattern_reg;
+} sim_t;
+
+static uint32_t sim_set_bitrate(uint32_t bitrate, void *context)
+{
+  sim_t *sim = context;
+  uint32_t div = sim->round_up ? SIM_CLOCK_HZ / bitrate : (SIM_CLOCK_HZ + bitrate - 1U) / bitrate;
+
+  sim->bitrate = SIM_CLOCK_HZ / (div ? div : 1U);
+  if (sim->bitrate > sim->highest_programmed) {
+    sim->highest_programmed = sim->bitrate;
+  }
+  return sim->bitrate;
+}
+
+static sl_status_t sim_read(uint8_t reg, uint8_t *data, uint16_t len, void *context)
+{
+  sim_t *sim = context;
+
+  (void)len;
+  if (sim->bitrate > sim->fail_above || sim->read_budget == 0) {
+    *data = 0xFFU;
+    return SL_STATUS_OK;
+  }
+  if (sim->read_budget > 0) {
+    sim->read_budget--;
+  }
+  *data = (reg == ICM42688P_REG_WHO_AM_I) ? ICM42688P_DEVICE_ID : sim->pattern_reg;
+  return SL_STATUS_OK;
+}
+
+static sl_status_t sim_write(uint8_t reg, uint8_t data, void *context)
+{
+  sim_t *sim = context;
+
+  if (reg == ICM42688P_REG_FIFO_CONFIG2) {
+    sim->pattern_reg = data;
+  }
+  return SL_STATUS_OK;
+}
+
+static const sl_icm42688p_autotune_config_t config = {
+  .start          = 1000000U,
+  .max            = 24000000U,
+  .step           = 1000000U,
+  .reads          = 8U,
+  .margin_percent = 10U,
+};
+
+static sl_status_t run(sim_t *sim, sl_icm42688p_autotune_result_t *result)
+{
+  const sl_icm42688p_autotune_link_t link = {
+    .set_bitrate = sim_set_bitrate,
+    .read        = sim_read,
+    .write       = sim_write,
+    .context     = sim,
+  };
+
+  sim->pattern_reg = SIM_SAVED;
+  sim->highest_programmed = 0;
+  return sl_icm42688p_autotune_run(&link, &config, result);
+}
+
+/* Divider rounding the rate down: the search stays under max and under
+   the first failing rate */
+static void check_round_down(void)
+{
+  sim_t sim = { .round_up = false, .fail_above = 13000000U, .read_budget = -1 };
+  sl_icm42688p_autotune_result_t result;
+
+  TEST_CHECK(run(&sim, &result) == SL_STATUS_OK);
+  TEST_CHECK(result.highest_ok <= 13000000U && result.highest_ok >= 11000000U);
+  TEST_CHECK(result.first_fail > 13000000U);
+  TEST_CHECK(result.bitrate <= result.highest_ok - result.highest_ok / 10U);
+  TEST_CHECK(sim.bitrate == result.bitrate);
+  TEST_CHECK(sim.pattern_reg == SIM_SAVED);
+}
+
+/* A link that overshoots: rates above max are never verified or chosen,
+   even on a sensor that would answer at any speed */
+static void check_overshoot(void)
+{
+  sim_t sim = { .round_up = true, .fail_above = UINT32_MAX, .read_budget = -1 };
+  sl_icm42688p_autotune_result_t result;
+
+  TEST_CHECK(run(&sim, &result) == SL_STATUS_OK);
+  TEST_CHECK(result.highest_ok <= config.max);
+  TEST_CHECK(result.bitrate <= config.max);
+  TEST_CHECK(sim.bitrate <= SIM_SENSOR_MAX_HZ);
+  TEST_CHECK(sim.pattern_reg == SIM_SAVED);
+}
+
+static void check_failures_restore(void)
+{
+  sl_icm42688p_autotune_result_t result;
+
+  /* Only the read of the value to restore gets through */
+  sim_t dead = { .round_up = false, .fail_above = UINT32_MAX, .read_budget = 1 };
+  TEST_CHECK(run(&dead, &result) == SL_STATUS_FAIL);
+  TEST_CHECK(dead.pattern_reg == SIM_SAVED);
+
+  /* Answers through the step-up, then not even at start during back-off */
+  for (int32_t budget = 16; budget < 400; budget += 7) {
+    sim_t flaky = { .round_up = false, .fail_above = 13000000U, .read_budget = budget };
+    sl_status_t status = run(&flaky, &result);
+    TEST_CHECK(flaky.pattern_reg == SIM_SAVED);
+    TEST_CHECK(status == SL_STATUS_FAIL || flaky.bitrate <= 13000000U);
+  }
+}
+
+int main(void)
+{
+  check_round_down();
+  check_overshoot();
+  check_failures_restore();
+
+  return test_result("test_autotune");
+}
@@ -0,0 +1,219 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of ICM42688P background gyro bias tracking
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Synthetic streams at 1 kHz with the noise of the sensor at rest: a still
+ * device whose bias drifts, handheld motion, steady rotation and a
+ * non-finite sample, replayed through the tracker.
+ ******************************************************************************/
+
+#include <math.h>
+#include "sl_icm42688p_bias.h"
+#include "test_support.h"
+
+#define WINDOW      250U
+#define GYRO_SIGMA  0.045f     /* dps */
+#define ACCEL_SIGMA 0.0011f    /* g */
+
+static uint32_t seed = 1U;
+
+/* Standard normal, Box-Muller on the deterministic generator */
+static float gauss(void)
+{
+  float u = ((float)(test_rand(&seed) >> 8) + 1.0f) / 16777217.0f;
+  float v = (float)(test_rand(&seed) >> 8) / 16777216.0f;
+
+  return sqrtf(-2.0f * logf(u)) * cosf(6.2831853f * v);
+}
+
+static void tracker_init(sl_icm42688p_bias_t *tracker)
+{
+  sl_icm42688p_bias_config_t config = {
+    .window = WINDOW,
+    .gyro_var_max = 9.0f * GYRO_SIGMA * GYRO_SIGMA,
+    .accel_var_max = 9.0f * ACCEL_SIGMA * ACCEL_SIGMA,
+    .max_deviation = 0.5f,
+    .smooth_shift = 3U,
+  };
+
+  sl_icm42688p_bias_init(tracker, &config, NULL);
+}
+
+/* Device at rest, z up, gyro reading truth plus noise */
+static bool push_still(sl_icm42688p_bias_t *tracker, const float truth[3])
+{
+  float gyro[3];
+  float accel[3];
+
+  for (uint8_t k = 0; k < 3U; ++k) {
+    gyro[k] = truth[k] + GYRO_SIGMA * gauss();
+    accel[k] = ((k == 2U) ? 1.0f : 0.0f) + ACCEL_SIGMA * gauss();
+  }
+  return sl_icm42688p_bias_push(tracker, gyro, accel);
+}
+
+static bool push_moving(sl_icm42688p_bias_t *tracker, const float truth[3], uint32_t i)
+{
+  float gyro[3];
+  float accel[3];
+
+  for (uint8_t k = 0; k < 3U; ++k) {
+    gyro[k] = truth[k] + 2.0f * sinf(0.05f * (float)i + (float)k) + GYRO_SIGMA * gauss();
+    accel[k] = ((k == 2U) ? 1.0f : 0.0f) + 0.02f * sinf(0.03f * (float)i) + ACCEL_SIGMA * gauss();
+  }
+  return sl_icm42688p_bias_push(tracker, gyro, accel);
+}
+
+/* A decision every half window once the first window is full */
+static void check_sliding(void)
+{
+  static const uint16_t windows[] = { 2U, 3U, 250U, 251U };
+
+  for (size_t w = 0; w < sizeof(windows) / sizeof(windows[0]); ++w) {
+    sl_icm42688p_bias_config_t config = { .window = windows[w], .smooth_shift = 3U };
+    sl_icm42688p_bias_t tracker;
+    const float zero[3] = { 0.0f, 0.0f, 0.0f };
+    uint32_t decisions = 0;
+    uint32_t wrong = 0;
+    uint32_t last = 0;
+
+    sl_icm42688p_bias_init(&tracker, &config, NULL);
+    for (uint32_t n = 1; n <= 4000U; ++n) {
+      uint32_t before = tracker.windows;
+
+      (void)sl_icm42688p_bias_push(&tracker, zero, zero);
+      if (tracker.windows == before) {
+        continue;
+      }
+      /* The first at window samples, then alternately floor and ceil of
+         half a window apart */
+      if (decisions == 0) {
+        wrong += (n != windows[w]);
+      } else {
+        uint32_t gap = n - last;
+        wrong += (gap != windows[w] / 2U && gap != (windows[w] + 1U) / 2U);
+      }
+      TEST_CHECK(tracker.windows == before + 1U);
+      decisions++;
+      last = n;
+    }
+    TEST_CHECK(wrong == 0);
+    TEST_CHECK(decisions >= (4000U - windows[w]) / ((windows[w] + 1U) / 2U));
+  }
+}
+
+/* Still for 20 s with a slow drift: the bias follows to within noise */
+static void check_still(void)
+{
+  sl_icm42688p_bias_t tracker;
+  float truth[3] = { 0.3f, -0.2f, 0.1f };
+
+  tracker_init(&tracker);
+  for (uint32_t i = 0; i < 20000U; ++i) {
+    for (uint8_t k = 0; k < 3U; ++k) {
+      truth[k] += 1e-6f;
+    }
+    (void)push_still(&tracker, truth);
+  }
+  for (uint8_t k = 0; k < 3U; ++k) {
+    TEST_CHECK(fabsf(tracker.bias[k] - truth[k]) < 0.01f);
+  }
+  TEST_CHECK(tracker.windows == (20000U - WINDOW) / (WINDOW / 2U) + 1U);
+  TEST_CHECK(tracker.still_windows >= tracker.windows - 2U);
+}
+
+/* Neither handheld motion nor steady rotation moves the bias */
+static void check_motion(void)
+{
+  sl_icm42688p_bias_t tracker;
+  const float truth[3] = { 0.3f, -0.2f, 0.1f };
+  float before[3];
+  uint32_t still_before;
+
+  tracker_init(&tracker);
+  for (uint32_t i = 0; i < 5000U; ++i) {
+    (void)push_still(&tracker, truth);
+  }
+  for (uint8_t k = 0; k < 3U; ++k) {
+    before[k] = tracker.bias[k];
+  }
+  still_before = tracker.still_windows;
+
+  for (uint32_t i = 0; i < 5000U; ++i) {
+    TEST_CHECK(!push_moving(&tracker, truth, i));
+  }
+
+  /* 10 dps about z: no variance, but far from the bias */
+  for (uint32_t i = 0; i < 5000U; ++i) {
+    const float rotating[3] = { truth[0], truth[1], truth[2] + 10.0f };
+    TEST_CHECK(!push_still(&tracker, rotating));
+  }
+
+  TEST_CHECK(tracker.still_windows == still_before);
+  for (uint8_t k = 0; k < 3U; ++k) {
+    TEST_CHECK(tracker.bias[k] == before[k]);
+  }
+}
+
+/* Back at rest, the first still window ends within a window and a half:
+   the window slides, so it does not wait for a boundary after the motion */
+static void check_latency(void)
+{
+  const float truth[3] = { 0.3f, -0.2f, 0.1f };
+  uint32_t worst = 0;
+
+  for (uint32_t offset = 0; offset < WINDOW; offset += 25U) {
+    sl_icm42688p_bias_t tracker;
+    uint32_t latency = 0;
+
+    tracker_init(&tracker);
+    for (uint32_t i = 0; i < 2U * WINDOW + offset; ++i) {
+      (void)push_moving(&tracker, truth, i);
+    }
+    while (latency < 4U * WINDOW && !push_still(&tracker, truth)) {
+      latency++;
+    }
+    latency++;
+    worst = (latency > worst) ? latency : worst;
+  }
+  TEST_CHECK(worst <= WINDOW + WINDOW / 2U);
+}
+
+/* Non-finite input is never still; a reset drops the windows in progress */
+static void check_nan_and_reset(void)
+{
+  sl_icm42688p_bias_t tracker;
+  const float gyro[3] = { NAN, 0.0f, 0.0f };
+  const float accel[3] = { 0.0f, 0.0f, 1.0f };
+  const float bias[3] = { 1.0f, 2.0f, 3.0f };
+  uint32_t windows;
+
+  tracker_init(&tracker);
+  for (uint32_t i = 0; i < 4U * WINDOW; ++i) {
+    TEST_CHECK(!sl_icm42688p_bias_push(&tracker, gyro, accel));
+  }
+  TEST_CHECK(!tracker.still && tracker.windows > 0);
+  TEST_CHECK(tracker.bias[0] == 0.0f);
+
+  sl_icm42688p_bias_reset(&tracker, bias);
+  TEST_CHECK(tracker.bias[0] == 1.0f && tracker.bias[2] == 3.0f);
+  windows = tracker.windows;
+  for (uint32_t i = 0; i < WINDOW - 1U; ++i) {
+    (void)sl_icm42688p_bias_push(&tracker, accel, accel);
+  }
+  TEST_CHECK(tracker.windows == windows);
+}
+
+int main(void)
+{
+  check_sliding();
+  check_still();
+  check_motion();
+  check_latency();
+  check_nan_and_reset();
+  return test_result("test_bias");
+}
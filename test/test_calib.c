@@ -0,0 +1,285 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of the ICM42688P calibration record store
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Record format, CRC and validation against a RAM model of the flash page:
+ * appends until the page wraps, a write torn by a reset, damaged records,
+ * a record of another version and temperature staleness. OFFSET_USER
+ * encoding with in-range, out-of-range and non-finite biases.
+ ******************************************************************************/
+
+#include <math.h>
+#include <stddef.h>
+#include "sl_icm42688p_calib.h"
+#include "ram_flash.h"
+#include "test_support.h"
+
+#define SLOTS   (RAM_FLASH_PAGE_SIZE / (uint32_t)sizeof(sl_icm42688p_calib_record_t))
+
+static void make_record(sl_icm42688p_calib_record_t *record, float gyro_x)
+{
+  sl_icm42688p_calib_init(record);
+  record->valid = SL_ICM42688P_CALIB_GYRO;
+  record->gyro_bias[0] = gyro_x;
+  record->gyro_bias[1] = -0.25f;
+  record->gyro_bias[2] = 0.125f;
+  record->temperature = 25.0f;
+}
+
+/* Load and report the result, with the status folded in */
+static sl_icm42688p_calib_result_t load(const sl_icm42688p_calib_flash_t *backend,
+                                        sl_icm42688p_calib_record_t *record)
+{
+  sl_icm42688p_calib_result_t result = SL_ICM42688P_CALIB_OK;
+
+  TEST_CHECK(sl_icm42688p_calib_load(backend, record, &result) == SL_STATUS_OK);
+  return result;
+}
+
+/* Check value of the IEEE CRC-32 and the layout the page is written in */
+static void check_format(void)
+{
+  sl_icm42688p_calib_record_t record;
+
+  TEST_CHECK(sl_icm42688p_calib_crc32("123456789", 9) == 0xCBF43926U);
+  TEST_CHECK(sl_icm42688p_calib_crc32("", 0) == 0x00000000U);
+
+  TEST_CHECK(sizeof(record) == 60U);
+  TEST_CHECK(offsetof(sl_icm42688p_calib_record_t, crc) == sizeof(record) - 4U);
+
+  make_record(&record, 1.0f);
+  sl_icm42688p_calib_seal(&record);
+  TEST_CHECK(record.magic == SL_ICM42688P_CALIB_MAGIC);
+  TEST_CHECK(record.version == SL_ICM42688P_CALIB_VERSION);
+  TEST_CHECK(record.length == sizeof(record));
+  TEST_CHECK(record.crc == sl_icm42688p_calib_crc32(&record, offsetof(sl_icm42688p_calib_record_t, crc)));
+  TEST_CHECK(sl_icm42688p_calib_check(&record) == SL_ICM42688P_CALIB_OK);
+
+  /* Any single bit flip is caught */
+  for (uint32_t bit = 0; bit < 8U * sizeof(record); ++bit) {
+    sl_icm42688p_calib_record_t damaged = record;
+
+    ((uint8_t *)&damaged)[bit / 8U] ^= (uint8_t)(1U << (bit % 8U));
+    TEST_CHECK(sl_icm42688p_calib_check(&damaged) != SL_ICM42688P_CALIB_OK);
+  }
+}
+
+/* Nothing stored: defaults and MISSING */
+static void check_empty(void)
+{
+  ram_flash_t flash;
+  sl_icm42688p_calib_flash_t backend;
+  sl_icm42688p_calib_record_t record;
+
+  ram_flash_init(&flash, &backend);
+  record.accel_scale[0] = 0.0f;
+  TEST_CHECK(load(&backend, &record) == SL_ICM42688P_CALIB_MISSING);
+  TEST_CHECK(record.valid == 0);
+  TEST_CHECK(record.accel_scale[0] == 1.0f && record.gyro_bias[0] == 0.0f);
+
+  TEST_CHECK(sl_icm42688p_calib_load(NULL, &record, NULL) == SL_STATUS_INVALID_PARAMETER);
+  TEST_CHECK(sl_icm42688p_calib_store(&backend, NULL) == SL_STATUS_INVALID_PARAMETER);
+}
+
+/* Appends never reprogram a written byte; the page is erased only when it
+   is full, and the newest record always wins */
+static void check_page_wrap(void)
+{
+  ram_flash_t flash;
+  sl_icm42688p_calib_flash_t backend;
+  sl_icm42688p_calib_record_t record;
+  sl_icm42688p_calib_record_t loaded;
+  uint32_t stores = 2U * SLOTS + 5U;
+  uint32_t wrong = 0;
+
+  ram_flash_init(&flash, &backend);
+  for (uint32_t n = 0; n < stores; ++n) {
+    make_record(&record, (float)n);
+    TEST_CHECK(sl_icm42688p_calib_store(&backend, &record) == SL_STATUS_OK);
+    if (load(&backend, &loaded) != SL_ICM42688P_CALIB_OK
+        || loaded.sequence != n || loaded.gyro_bias[0] != (float)n) {
+      wrong++;
+    }
+  }
+  TEST_CHECK(wrong == 0);
+  TEST_CHECK(flash.erases == 2U);
+  TEST_CHECK(flash.writes == stores);
+  TEST_CHECK(flash.overwrites == 0);
+}
+
+/* A reset in the middle of programming leaves the previous record in
+   place, and the next store goes to the following slot */
+static void check_torn_write(void)
+{
+  static const int32_t tears[] = { 0, 4, 20, 56 };
+  ram_flash_t flash;
+  sl_icm42688p_calib_flash_t backend;
+  sl_icm42688p_calib_record_t record;
+  sl_icm42688p_calib_record_t loaded;
+
+  ram_flash_init(&flash, &backend);
+  make_record(&record, 1.5f);
+  TEST_CHECK(sl_icm42688p_calib_store(&backend, &record) == SL_STATUS_OK);
+
+  for (size_t t = 0; t < sizeof(tears) / sizeof(tears[0]); ++t) {
+    make_record(&record, 99.0f);
+    flash.tear_after = tears[t];
+    TEST_CHECK(sl_icm42688p_calib_store(&backend, &record) == SL_STATUS_FAIL);
+    TEST_CHECK(load(&backend, &loaded) == SL_ICM42688P_CALIB_OK);
+    TEST_CHECK(loaded.gyro_bias[0] == 1.5f && loaded.sequence == 0);
+  }
+
+  make_record(&record, 2.5f);
+  TEST_CHECK(sl_icm42688p_calib_store(&backend, &record) == SL_STATUS_OK);
+  TEST_CHECK(load(&backend, &loaded) == SL_ICM42688P_CALIB_OK);
+  TEST_CHECK(loaded.gyro_bias[0] == 2.5f && loaded.sequence == 1U);
+  TEST_CHECK(flash.overwrites == 0);
+
+  /* Torn while the page was being refilled after a wrap */
+  ram_flash_init(&flash, &backend);
+  for (uint32_t n = 0; n < SLOTS; ++n) {
+    make_record(&record, (float)n);
+    TEST_CHECK(sl_icm42688p_calib_store(&backend, &record) == SL_STATUS_OK);
+  }
+  make_record(&record, 99.0f);
+  flash.tear_after = 8;
+  TEST_CHECK(sl_icm42688p_calib_store(&backend, &record) == SL_STATUS_FAIL);
+  TEST_CHECK(flash.erases == 1U);
+  TEST_CHECK(load(&backend, &loaded) == SL_ICM42688P_CALIB_CORRUPT);
+  TEST_CHECK(loaded.valid == 0 && loaded.gyro_bias[0] == 0.0f);
+}
+
+/* A damaged newest record falls back to the one before it; with none
+   intact the page reads CORRUPT and the defaults are returned */
+static void check_corrupt(void)
+{
+  ram_flash_t flash;
+  sl_icm42688p_calib_flash_t backend;
+  sl_icm42688p_calib_record_t record;
+  sl_icm42688p_calib_record_t loaded;
+  uint32_t size = (uint32_t)sizeof(record);
+
+  ram_flash_init(&flash, &backend);
+  make_record(&record, 1.0f);
+  TEST_CHECK(sl_icm42688p_calib_store(&backend, &record) == SL_STATUS_OK);
+  make_record(&record, 2.0f);
+  TEST_CHECK(sl_icm42688p_calib_store(&backend, &record) == SL_STATUS_OK);
+
+  flash.page[size + offsetof(sl_icm42688p_calib_record_t, gyro_bias)] ^= 0x01U;
+  TEST_CHECK(load(&backend, &loaded) == SL_ICM42688P_CALIB_OK);
+  TEST_CHECK(loaded.gyro_bias[0] == 1.0f);
+
+  flash.page[offsetof(sl_icm42688p_calib_record_t, crc)] ^= 0x80U;
+  TEST_CHECK(load(&backend, &loaded) == SL_ICM42688P_CALIB_CORRUPT);
+  TEST_CHECK(loaded.valid == 0 && loaded.gyro_bias[0] == 0.0f);
+
+  /* A length that does not match the record, with a CRC that does */
+  ram_flash_init(&flash, &backend);
+  make_record(&record, 3.0f);
+  sl_icm42688p_calib_seal(&record);
+  record.length = (uint16_t)(size - 4U);
+  record.crc = sl_icm42688p_calib_crc32(&record, offsetof(sl_icm42688p_calib_record_t, crc));
+  TEST_CHECK(backend.write(0, &record, size, backend.context) == SL_STATUS_OK);
+  TEST_CHECK(load(&backend, &loaded) == SL_ICM42688P_CALIB_CORRUPT);
+}
+
+/* A record written by another format version is reported, not used */
+static void check_old_version(void)
+{
+  ram_flash_t flash;
+  sl_icm42688p_calib_flash_t backend;
+  sl_icm42688p_calib_record_t record;
+  sl_icm42688p_calib_record_t loaded;
+
+  ram_flash_init(&flash, &backend);
+  make_record(&record, 4.0f);
+  sl_icm42688p_calib_seal(&record);
+  record.version = (uint16_t)(SL_ICM42688P_CALIB_VERSION - 1U);
+  record.crc = sl_icm42688p_calib_crc32(&record, offsetof(sl_icm42688p_calib_record_t, crc));
+  TEST_CHECK(sl_icm42688p_calib_check(&record) == SL_ICM42688P_CALIB_OLD_VERSION);
+  TEST_CHECK(backend.write(0, &record, sizeof(record), backend.context) == SL_STATUS_OK);
+
+  TEST_CHECK(load(&backend, &loaded) == SL_ICM42688P_CALIB_OLD_VERSION);
+  TEST_CHECK(loaded.valid == 0 && loaded.gyro_bias[0] == 0.0f);
+
+  /* A current record stored after it takes over */
+  make_record(&record, 5.0f);
+  TEST_CHECK(sl_icm42688p_calib_store(&backend, &record) == SL_STATUS_OK);
+  TEST_CHECK(load(&backend, &loaded) == SL_ICM42688P_CALIB_OK);
+  TEST_CHECK(loaded.gyro_bias[0] == 5.0f && loaded.sequence == 0);
+}
+
+static void check_stale(void)
+{
+  sl_icm42688p_calib_record_t record;
+
+  make_record(&record, 0.0f);
+  TEST_CHECK(!sl_icm42688p_calib_is_stale(&record, 25.0f, 10.0f));
+  TEST_CHECK(!sl_icm42688p_calib_is_stale(&record, 35.0f, 10.0f));
+  TEST_CHECK(!sl_icm42688p_calib_is_stale(&record, 15.0f, 10.0f));
+  TEST_CHECK(sl_icm42688p_calib_is_stale(&record, 35.5f, 10.0f));
+  TEST_CHECK(sl_icm42688p_calib_is_stale(&record, 14.5f, 10.0f));
+  TEST_CHECK(sl_icm42688p_calib_is_stale(&record, NAN, 10.0f));
+
+  record.temperature = NAN;
+  TEST_CHECK(sl_icm42688p_calib_is_stale(&record, 25.0f, 10.0f));
+}
+
+/* 12-bit two's complement per axis, clamped; NaN and huge values are
+   rejected before any conversion to integer */
+static void check_offsets(void)
+{
+  static const float bad[] = { NAN, -NAN, INFINITY, -INFINITY, 1e30f, -1e30f, 3e9f };
+  const float gyro[3] = { 1.0f, -2.5f, 63.96875f };
+  const float accel[3] = { 0.0005f, -0.25f, -1.0f };
+  uint8_t regs[ICM42688P_OFFSET_USER_LEN];
+  float gyro_out[3];
+  float accel_out[3];
+
+  TEST_CHECK(sl_icm42688p_calib_offsets_encode(gyro, accel, regs));
+  sl_icm42688p_calib_offsets_decode(regs, gyro_out, accel_out);
+  for (uint8_t i = 0; i < 3U; ++i) {
+    TEST_CHECK(gyro_out[i] == gyro[i]);
+    TEST_CHECK(fabsf(accel_out[i] - accel[i]) <= 0.5f / ICM42688P_OFFSET_USER_ACCEL_LSB_PER_G);
+  }
+
+  TEST_CHECK(sl_icm42688p_calib_offsets_encode(NULL, NULL, regs));
+  for (uint8_t i = 0; i < ICM42688P_OFFSET_USER_LEN; ++i) {
+    TEST_CHECK(regs[i] == 0);
+  }
+
+  /* Just outside: clamped to the range ends */
+  {
+    const float over[3] = { -64.0f, 64.0f, 0.0f };
+
+    TEST_CHECK(!sl_icm42688p_calib_offsets_encode(over, NULL, regs));
+    sl_icm42688p_calib_offsets_decode(regs, gyro_out, NULL);
+    TEST_CHECK(gyro_out[0] == -2047.0f / ICM42688P_OFFSET_USER_GYRO_LSB_PER_DPS);
+    TEST_CHECK(gyro_out[1] == 2048.0f / ICM42688P_OFFSET_USER_GYRO_LSB_PER_DPS);
+    TEST_CHECK(gyro_out[2] == 0.0f);
+  }
+
+  for (size_t b = 0; b < sizeof(bad) / sizeof(bad[0]); ++b) {
+    float bias[3] = { 0.0f, bad[b], 0.0f };
+
+    TEST_CHECK(!sl_icm42688p_calib_offsets_encode(bias, NULL, regs));
+    TEST_CHECK(!sl_icm42688p_calib_offsets_encode(NULL, bias, regs));
+  }
+}
+
+int main(void)
+{
+  check_format();
+  check_empty();
+  check_page_wrap();
+  check_torn_write();
+  check_corrupt();
+  check_old_version();
+  check_stale();
+  check_offsets();
+  return test_result("test_calib");
+}
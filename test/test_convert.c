@@ -0,0 +1,166 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test and benchmark of the ICM42688P conversion backends
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Runs the compiled-in backend and the portable reference on the same
+ * input and requires bit-identical output, then times both. The Makefile
+ * builds this once per backend: SSE2, DSP (through test/shim) and portable.
+ ******************************************************************************/
+
+#include <string.h>
+#include "sl_icm42688p_convert.h"
+#include "test_support.h"
+
+#define MAX_COUNT     41U    /* covers every SIMD tail length */
+#define MAX_STRIDE    20U
+#define BENCH_COUNT   4096U
+#define BENCH_ROUNDS  200U
+#define BENCH_STRIDE  16U    /* FIFO packet 3 */
+
+static uint8_t src[(MAX_COUNT + 1U) * MAX_STRIDE];
+static float f_out[3 * MAX_COUNT], f_ref[3 * MAX_COUNT];
+static int16_t q15_out[3 * MAX_COUNT], q15_ref[3 * MAX_COUNT];
+static int32_t q31_out[3 * MAX_COUNT], q31_ref[3 * MAX_COUNT];
+
+static const size_t strides[] = { 6U, 14U, 16U, 20U };
+
+/* Saturation corners, then random values */
+static int16_t pick16(uint32_t *seed)
+{
+  static const int16_t corners[] = { INT16_MIN, INT16_MIN + 1, -1, 0, 1, INT16_MAX };
+  uint32_t r = test_rand(seed);
+
+  if ((r & 3U) == 0) {
+    return corners[(r >> 2) % (sizeof(corners) / sizeof(corners[0]))];
+  }
+  return (int16_t)(r >> 8);
+}
+
+static void fill_source(uint32_t *seed)
+{
+  for (size_t i = 0; i + 1U < sizeof(src); i += 2U) {
+    int16_t v = pick16(seed);
+    src[i] = (uint8_t)((uint16_t)v >> 8);
+    src[i + 1U] = (uint8_t)v;
+  }
+}
+
+static void check_same_output(uint32_t *seed)
+{
+  for (size_t s = 0; s < sizeof(strides) / sizeof(strides[0]); ++s) {
+    for (size_t count = 0; count <= MAX_COUNT; ++count) {
+      sl_icm42688p_convert_f32_t fp;
+      sl_icm42688p_convert_fixed_t xp;
+
+      fill_source(seed);
+      for (size_t i = 0; i < 3U; ++i) {
+        fp.scale[i] = (float)(int32_t)test_rand(seed) * 1e-9f;
+        fp.bias[i] = (float)pick16(seed) * 0.37f;
+        xp.gain[i] = pick16(seed);
+        xp.bias[i] = pick16(seed);
+      }
+
+      memset(f_out, 0, sizeof(f_out));
+      memset(f_ref, 0, sizeof(f_ref));
+      sl_icm42688p_convert_f32(src, strides[s], count, &fp, f_out);
+      sl_icm42688p_convert_f32_portable(src, strides[s], count, &fp, f_ref);
+      TEST_CHECK(memcmp(f_out, f_ref, sizeof(f_out)) == 0);
+
+      memset(q15_out, 0, sizeof(q15_out));
+      memset(q15_ref, 0, sizeof(q15_ref));
+      sl_icm42688p_convert_q15(src, strides[s], count, &xp, q15_out);
+      sl_icm42688p_convert_q15_portable(src, strides[s], count, &xp, q15_ref);
+      TEST_CHECK(memcmp(q15_out, q15_ref, sizeof(q15_out)) == 0);
+
+      memset(q31_out, 0, sizeof(q31_out));
+      memset(q31_ref, 0, sizeof(q31_ref));
+      sl_icm42688p_convert_q31(src, strides[s], count, &xp, q31_out);
+      sl_icm42688p_convert_q31_portable(src, strides[s], count, &xp, q31_ref);
+      TEST_CHECK(memcmp(q31_out, q31_ref, sizeof(q31_out)) == 0);
+    }
+  }
+}
+
+/* Fixed-point corners against hand-computed values */
+static void check_known_values(void)
+{
+  static const uint8_t corner[6] = { 0x80, 0x00, 0x7F, 0xFF, 0xFF, 0xFF };  /* -32768, 32767, -1 */
+  sl_icm42688p_convert_fixed_t xp;
+  int16_t q15[3];
+  int32_t q31[3];
+
+  sl_icm42688p_convert_fixed_init(&xp, -1.0f, NULL);
+  sl_icm42688p_convert_q15(corner, 6U, 1U, &xp, q15);
+  sl_icm42688p_convert_q31(corner, 6U, 1U, &xp, q31);
+  TEST_CHECK(q15[0] == INT16_MAX && q15[1] == -32767 && q15[2] == 1);
+  TEST_CHECK(q31[0] == INT32_MAX && q31[1] == -2147418112 && q31[2] == 65536);
+
+  /* Bias subtraction saturates before the gain */
+  const int16_t bias[3] = { 1, -1, 0 };
+  sl_icm42688p_convert_fixed_init(&xp, 0.5f, bias);
+  sl_icm42688p_convert_q15(corner, 6U, 1U, &xp, q15);
+  TEST_CHECK(q15[0] == -16384 && q15[1] == 16383 && q15[2] == -1);
+}
+
+typedef void (*convert_q15_fn)(const uint8_t *, size_t, size_t, const sl_icm42688p_convert_fixed_t *, int16_t *);
+typedef void (*convert_f32_fn)(const uint8_t *, size_t, size_t, const sl_icm42688p_convert_f32_t *, float *);
+
+static uint8_t bench_src[BENCH_COUNT * BENCH_STRIDE];
+static float bench_f32[3 * BENCH_COUNT];
+static int16_t bench_q15[3 * BENCH_COUNT];
+
+static double bench_f32_ns(convert_f32_fn fn, const sl_icm42688p_convert_f32_t *params)
+{
+  uint64_t start = test_now_ns();
+
+  for (uint32_t r = 0; r < BENCH_ROUNDS; ++r) {
+    fn(bench_src, BENCH_STRIDE, BENCH_COUNT, params, bench_f32);
+  }
+  return (double)(test_now_ns() - start) / ((double)BENCH_ROUNDS * BENCH_COUNT);
+}
+
+static double bench_q15_ns(convert_q15_fn fn, const sl_icm42688p_convert_fixed_t *params)
+{
+  uint64_t start = test_now_ns();
+
+  for (uint32_t r = 0; r < BENCH_ROUNDS; ++r) {
+    fn(bench_src, BENCH_STRIDE, BENCH_COUNT, params, bench_q15);
+  }
+  return (double)(test_now_ns() - start) / ((double)BENCH_ROUNDS * BENCH_COUNT);
+}
+
+static void benchmark(void)
+{
+  sl_icm42688p_convert_f32_t fp;
+  sl_icm42688p_convert_fixed_t xp;
+  uint32_t seed = 0x1234567U;
+
+  for (size_t i = 0; i < sizeof(bench_src); ++i) {
+    bench_src[i] = (uint8_t)test_rand(&seed);
+  }
+  sl_icm42688p_convert_f32_init(&fp, 1.0f / 16.4f, NULL);
+  sl_icm42688p_convert_fixed_init(&xp, 0.25f, NULL);
+
+  printf("  f32: %6.2f ns/triplet, portable %6.2f\n",
+         bench_f32_ns(sl_icm42688p_convert_f32, &fp), bench_f32_ns(sl_icm42688p_convert_f32_portable, &fp));
+  printf("  q15: %6.2f ns/triplet, portable %6.2f\n",
+         bench_q15_ns(sl_icm42688p_convert_q15, &xp), bench_q15_ns(sl_icm42688p_convert_q15_portable, &xp));
+}
+
+int main(void)
+{
+  uint32_t seed = 0xC0FFEEU;
+
+  printf("backend %s\n", sl_icm42688p_convert_backend());
+  for (int round = 0; round < 20; ++round) {
+    check_same_output(&seed);
+  }
+  check_known_values();
+  benchmark();
+
+  return test_result("test_convert");
+}
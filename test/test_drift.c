@@ -0,0 +1,105 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of ICM42688P ODR drift estimation
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * DRDY edges of a sensor whose ODR is off by a known amount, stamped by a
+ * 32768 Hz sleeptimer as the driver sees them: the estimate has to settle
+ * on the skew despite the one-tick quantization of every edge.
+ ******************************************************************************/
+
+#include <math.h>
+#include "sl_icm42688p_drift.h"
+#include "test_support.h"
+
+#define TICK_HZ     32768U
+#define PERIOD_NS   1000000U      /* 1 kHz nominal */
+#define MIN_SPAN    TICK_HZ       /* 1 s windows */
+#define SHIFT       3U
+
+/* Sleeptimer tick of edge n for a sensor running ppm fast, with a start
+   offset, truncated like a counter capture */
+static uint64_t edge_ticks(uint32_t n, double ppm, double start_ticks)
+{
+  double seconds = (double)n * (PERIOD_NS / 1e9) / (1.0 + ppm * 1e-6);
+
+  return (uint64_t)floor(start_ticks + seconds * TICK_HZ);
+}
+
+/* Runs edges [first, last) and returns the number of windows closed */
+static uint32_t run(sl_icm42688p_drift_t *drift, uint32_t first, uint32_t last, double ppm, double start_ticks)
+{
+  uint32_t closed = 0;
+
+  for (uint32_t n = first; n < last; ++n) {
+    closed += sl_icm42688p_drift_observe(drift, (uint64_t)n * PERIOD_NS, edge_ticks(n, ppm, start_ticks));
+  }
+  return closed;
+}
+
+/* Known skews either way converge to within 3 ppm in a minute */
+static void check_converge(void)
+{
+  static const double skews[] = { 0.0, 200.0, -350.0, 1500.0, -20000.0 };
+
+  for (size_t i = 0; i < sizeof(skews) / sizeof(skews[0]); ++i) {
+    sl_icm42688p_drift_t drift;
+    uint32_t closed;
+    uint32_t seconds;
+    int32_t error;
+
+    sl_icm42688p_drift_init(&drift, TICK_HZ, MIN_SPAN, SHIFT);
+    TEST_CHECK(!drift.estimated && sl_icm42688p_drift_error_ppb(&drift) == 0);
+    TEST_CHECK(sl_icm42688p_drift_period_ns(&drift, PERIOD_NS) == PERIOD_NS);
+
+    /* One window per second of sleeptimer time, give or take the last */
+    closed = run(&drift, 0, 60000U, skews[i], 12345.6);
+    seconds = (uint32_t)((edge_ticks(59999U, skews[i], 0.0)) / TICK_HZ);
+    TEST_CHECK(closed + 1U >= seconds && closed <= seconds);
+    TEST_CHECK(drift.estimated && drift.updates == closed && drift.rejected == 0);
+
+    error = sl_icm42688p_drift_error_ppb(&drift);
+    TEST_CHECK(fabs((double)error - skews[i] * 1000.0) < 3000.0);
+
+    /* The period follows the rate: shorter when the sensor runs fast */
+    TEST_CHECK(fabs((double)sl_icm42688p_drift_period_ns(&drift, PERIOD_NS)
+                    - PERIOD_NS / (1.0 + skews[i] * 1e-6)) < 4.0);
+  }
+}
+
+/* A window spanning lost samples or an ODR change is thrown away and the
+   estimate holds; the next window starts from there */
+static void check_reject(void)
+{
+  sl_icm42688p_drift_t drift;
+  uint32_t rate;
+  uint64_t ticks;
+
+  sl_icm42688p_drift_init(&drift, TICK_HZ, MIN_SPAN, SHIFT);
+  (void)run(&drift, 0, 10001U, 100.0, 0.0);
+  rate = drift.rate_q30;
+
+  /* Edges went uncounted: 2.5 s of sensor time over 2 s */
+  ticks = edge_ticks(10000U, 100.0, 0.0);
+  TEST_CHECK(!sl_icm42688p_drift_observe(&drift, 12500ULL * PERIOD_NS, ticks + 2U * TICK_HZ));
+  TEST_CHECK(drift.rejected == 1U && drift.rate_q30 == rate);
+
+  /* Sensor time going backwards restarts without counting as rejected */
+  TEST_CHECK(!sl_icm42688p_drift_observe(&drift, 5000ULL * PERIOD_NS, ticks + 3U * TICK_HZ));
+  TEST_CHECK(drift.rejected == 1U && drift.rate_q30 == rate);
+
+  /* Too long without a window: restart rather than overflow */
+  TEST_CHECK(!sl_icm42688p_drift_observe(&drift, 700000ULL * PERIOD_NS, ticks + 700U * TICK_HZ));
+  TEST_CHECK(drift.rate_q30 == rate);
+  TEST_CHECK(sl_icm42688p_drift_observe(&drift, 702000ULL * PERIOD_NS, ticks + 702U * TICK_HZ));
+}
+
+int main(void)
+{
+  check_converge();
+  check_reject();
+  return test_result("test_drift");
+}
@@ -0,0 +1,212 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test and parse benchmark of the ICM42688P FIFO parser
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Packets are built field by field, parsed back and compared, for every
+ * packet type and the 20-bit range ends. The benchmark times parsing and
+ * float conversion of packet 4 (20-bit) against packet 3 (16-bit).
+ ******************************************************************************/
+
+#include <string.h>
+#include "sl_icm42688p_fifo.h"
+#include "sl_icm42688p_convert.h"
+#include "test_support.h"
+
+#define BENCH_PACKETS  4096U
+#define BENCH_ROUNDS   200U
+
+static void put_be16(uint8_t *p, int32_t v)
+{
+  p[0] = (uint8_t)((uint32_t)v >> 8);
+  p[1] = (uint8_t)v;
+}
+
+/* Packet 4: header, accel bits 19:4, gyro bits 19:4, temp16, TMST, then
+   bits 3:0 of accel (high nibble) and gyro (low nibble) per axis */
+static void build_packet4(uint8_t *p, const int32_t accel[3], const int32_t gyro[3], int16_t temp, uint16_t tmst)
+{
+  p[0] = (uint8_t)(SL_ICM42688P_FIFO_HEADER_ACCEL | SL_ICM42688P_FIFO_HEADER_GYRO
+                   | SL_ICM42688P_FIFO_HEADER_20 | SL_ICM42688P_FIFO_HEADER_TMST);
+  for (uint32_t i = 0; i < 3U; ++i) {
+    put_be16(&p[1U + 2U * i], accel[i] >> 4);
+    put_be16(&p[7U + 2U * i], gyro[i] >> 4);
+    p[17U + i] = (uint8_t)(((uint32_t)accel[i] & 0x0FU) << 4 | ((uint32_t)gyro[i] & 0x0FU));
+  }
+  put_be16(&p[13], temp);
+  put_be16(&p[15], tmst);
+}
+
+static void build_packet3(uint8_t *p, const int16_t accel[3], const int16_t gyro[3], int8_t temp, uint16_t tmst)
+{
+  p[0] = (uint8_t)(SL_ICM42688P_FIFO_HEADER_ACCEL | SL_ICM42688P_FIFO_HEADER_GYRO | SL_ICM42688P_FIFO_HEADER_TMST);
+  for (uint32_t i = 0; i < 3U; ++i) {
+    put_be16(&p[1U + 2U * i], accel[i]);
+    put_be16(&p[7U + 2U * i], gyro[i]);
+  }
+  p[13] = (uint8_t)temp;
+  put_be16(&p[14], tmst);
+}
+
+static int32_t rand20(uint32_t *seed)
+{
+  static const int32_t corners[] = { -524287, -1, 0, 1, 15, 16, 524287 };
+  uint32_t r = test_rand(seed);
+
+  if ((r & 3U) == 0) {
+    return corners[(r >> 2) % (sizeof(corners) / sizeof(corners[0]))];
+  }
+  return (int32_t)(r >> 12) - 524288 + 1;   /* never the invalid marker */
+}
+
+static void check_packet4(void)
+{
+  uint32_t seed = 42U;
+  uint8_t pkt[SL_ICM42688P_FIFO_PACKET4_SIZE];
+  sl_icm42688p_fifo_sample_t s;
+  uint32_t wrong = 0;
+
+  for (uint32_t n = 0; n < 20000U; ++n) {
+    int32_t accel[3], gyro[3];
+    for (uint32_t i = 0; i < 3U; ++i) {
+      accel[i] = rand20(&seed);
+      gyro[i] = rand20(&seed);
+    }
+    build_packet4(pkt, accel, gyro, -1234, (uint16_t)n);
+
+    if (sl_icm42688p_fifo_parse(pkt, sizeof(pkt), &s, 1, NULL) != 1
+        || memcmp(s.accel, accel, sizeof(accel)) != 0 || memcmp(s.gyro, gyro, sizeof(gyro)) != 0
+        || s.temperature != -1234 || s.timestamp != (uint16_t)n
+        || s.flags != (SL_ICM42688P_FIFO_SAMPLE_ACCEL | SL_ICM42688P_FIFO_SAMPLE_GYRO | SL_ICM42688P_FIFO_SAMPLE_TIMESTAMP)) {
+      wrong++;
+    }
+
+    /* The float kernel reads the same fields the same way */
+    sl_icm42688p_convert_f32_t params;
+    float out[3];
+    sl_icm42688p_convert_f32_init(&params, 1.0f, NULL);
+    sl_icm42688p_convert_f32_20(&pkt[7], &pkt[17], 0U, sizeof(pkt), 1U, &params, out);
+    for (uint32_t i = 0; i < 3U; ++i) {
+      if (out[i] != (float)gyro[i]) {
+        wrong++;
+      }
+    }
+  }
+  TEST_CHECK(wrong == 0);
+
+  /* The invalid marker clears the axis flag */
+  const int32_t invalid[3] = { SL_ICM42688P_FIFO_INVALID_DATA_20, SL_ICM42688P_FIFO_INVALID_DATA_20,
+                               SL_ICM42688P_FIFO_INVALID_DATA_20 };
+  const int32_t zero[3] = { 0, 0, 0 };
+  build_packet4(pkt, invalid, zero, 0, 0);
+  TEST_CHECK(sl_icm42688p_fifo_parse(pkt, sizeof(pkt), &s, 1, NULL) == 1);
+  TEST_CHECK(s.accel[0] == SL_ICM42688P_FIFO_INVALID_DATA_20);
+  TEST_CHECK(!(s.flags & SL_ICM42688P_FIFO_SAMPLE_ACCEL) && (s.flags & SL_ICM42688P_FIFO_SAMPLE_GYRO));
+}
+
+/* Mixed packet types; the parse stops at an empty-FIFO header and at a
+   truncated packet */
+static void check_stream(void)
+{
+  uint8_t buf[64];
+  sl_icm42688p_fifo_sample_t s[8];
+  size_t consumed = 0;
+  const int16_t a[3] = { 1, -2, 3 };
+  const int16_t g[3] = { -32767, 32767, 0 };
+  uint16_t tmst;
+
+  memset(buf, 0xFF, sizeof(buf));   /* what FIFO_DATA reads when empty */
+  build_packet3(&buf[0], a, g, -3, 0xBEEF);
+  buf[16] = SL_ICM42688P_FIFO_HEADER_ACCEL;                     /* packet 1 */
+  put_be16(&buf[17], 100);
+  put_be16(&buf[19], 200);
+  put_be16(&buf[21], 300);
+  buf[23] = 5;
+  buf[24] = SL_ICM42688P_FIFO_HEADER_GYRO;                      /* packet 2 */
+  put_be16(&buf[25], -100);
+  put_be16(&buf[27], -200);
+  put_be16(&buf[29], -300);
+  buf[31] = 6;
+
+  TEST_CHECK(sl_icm42688p_fifo_parse(buf, sizeof(buf), s, 8, &consumed) == 3);
+  TEST_CHECK(consumed == 32U);
+  TEST_CHECK(s[0].accel[1] == -2 && s[0].gyro[0] == -32767 && s[0].temperature == -3 * 64);
+  TEST_CHECK(s[0].timestamp == 0xBEEF);
+  TEST_CHECK(sl_icm42688p_fifo_packet_tmst(&buf[0], &tmst) && tmst == 0xBEEF);
+  TEST_CHECK(s[1].flags == SL_ICM42688P_FIFO_SAMPLE_ACCEL && s[1].accel[2] == 300);
+  TEST_CHECK(s[1].gyro[0] == SL_ICM42688P_FIFO_INVALID_DATA);
+  TEST_CHECK(s[2].flags == SL_ICM42688P_FIFO_SAMPLE_GYRO && s[2].gyro[2] == -300);
+
+  /* Truncated: the third packet is one byte short */
+  TEST_CHECK(sl_icm42688p_fifo_parse(buf, 31U, s, 8, &consumed) == 2);
+  TEST_CHECK(consumed == 24U);
+}
+
+static uint8_t bench3[BENCH_PACKETS * SL_ICM42688P_FIFO_PACKET3_SIZE];
+static uint8_t bench4[BENCH_PACKETS * SL_ICM42688P_FIFO_PACKET4_SIZE];
+static sl_icm42688p_fifo_sample_t bench_samples[BENCH_PACKETS];
+static float bench_out[3 * BENCH_PACKETS];
+
+static void benchmark(void)
+{
+  uint32_t seed = 5U;
+  sl_icm42688p_convert_f32_t params;
+  uint64_t t[4];
+  size_t parsed = 0;
+
+  for (uint32_t n = 0; n < BENCH_PACKETS; ++n) {
+    int16_t a16[3], g16[3];
+    int32_t a20[3], g20[3];
+    for (uint32_t i = 0; i < 3U; ++i) {
+      a20[i] = rand20(&seed);
+      g20[i] = rand20(&seed);
+      a16[i] = (int16_t)(a20[i] >> 4);
+      g16[i] = (int16_t)(g20[i] >> 4);
+    }
+    build_packet3(&bench3[n * SL_ICM42688P_FIFO_PACKET3_SIZE], a16, g16, 10, (uint16_t)n);
+    build_packet4(&bench4[n * SL_ICM42688P_FIFO_PACKET4_SIZE], a20, g20, 640, (uint16_t)n);
+  }
+  sl_icm42688p_convert_f32_init(&params, 1.0f / 131.0f, NULL);
+
+  t[0] = test_now_ns();
+  for (uint32_t r = 0; r < BENCH_ROUNDS; ++r) {
+    parsed += sl_icm42688p_fifo_parse(bench3, sizeof(bench3), bench_samples, BENCH_PACKETS, NULL);
+  }
+  t[1] = test_now_ns();
+  for (uint32_t r = 0; r < BENCH_ROUNDS; ++r) {
+    parsed += sl_icm42688p_fifo_parse(bench4, sizeof(bench4), bench_samples, BENCH_PACKETS, NULL);
+  }
+  t[2] = test_now_ns();
+  TEST_CHECK(parsed == 2U * BENCH_ROUNDS * BENCH_PACKETS);
+
+  printf("  parse:   packet 3 %6.2f ns/packet, packet 4 %6.2f\n",
+         (double)(t[1] - t[0]) / (BENCH_ROUNDS * BENCH_PACKETS),
+         (double)(t[2] - t[1]) / (BENCH_ROUNDS * BENCH_PACKETS));
+
+  t[0] = test_now_ns();
+  for (uint32_t r = 0; r < BENCH_ROUNDS; ++r) {
+    sl_icm42688p_convert_f32(&bench3[7], SL_ICM42688P_FIFO_PACKET3_SIZE, BENCH_PACKETS, &params, bench_out);
+  }
+  t[1] = test_now_ns();
+  for (uint32_t r = 0; r < BENCH_ROUNDS; ++r) {
+    sl_icm42688p_convert_f32_20(&bench4[7], &bench4[17], 0U, SL_ICM42688P_FIFO_PACKET4_SIZE, BENCH_PACKETS,
+                                &params, bench_out);
+  }
+  t[2] = test_now_ns();
+
+  printf("  convert: 16-bit (%s) %6.2f ns/triplet, 20-bit %6.2f\n", sl_icm42688p_convert_backend(),
+         (double)(t[1] - t[0]) / (BENCH_ROUNDS * BENCH_PACKETS),
+         (double)(t[2] - t[1]) / (BENCH_ROUNDS * BENCH_PACKETS));
+}
+
+int main(void)
+{
+  check_packet4();
+  check_stream();
+  benchmark();
+
+  return test_result("test_fifo");
+}
@@ -0,0 +1,224 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of ICM42688P filter register encoding
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Encodings against the datasheet: AAF_DELT / AAF_DELTSQR / AAF_BITSHIFT
+ * rows of the anti-alias filter table, NF_COSWZ / NF_COSWZ_SEL worked from
+ * the notch formula at 32 kHz, GYRO_NF_BW_SEL and the UI filter bandwidth
+ * codes, then a complete configuration.
+ ******************************************************************************/
+
+#include <math.h>
+#include "sl_icm42688p_filter.h"
+#include "sl_icm42688p_defs.h"
+#include "test_support.h"
+
+/* Rows of the datasheet AAF table: DELT, 3 dB bandwidth, DELTSQR, BITSHIFT */
+static const struct {
+  uint8_t delt;
+  uint16_t bw_hz;
+  uint16_t deltsqr;
+  uint8_t bitshift;
+} aaf_rows[] = {
+  {  1U,   42U,    1U, 15U }, {  2U,   84U,    4U, 13U }, {  3U,  126U,    9U, 12U },
+  {  4U,  170U,   16U, 11U }, {  5U,  213U,   25U, 10U }, {  6U,  258U,   36U, 10U },
+  {  7U,  303U,   49U,  9U }, { 10U,  441U,  100U,  8U }, { 11U,  488U,  122U,  8U },
+  { 13U,  585U,  170U,  8U }, { 14U,  634U,  196U,  7U }, { 19U,  890U,  360U,  6U },
+  { 21U,  997U,  440U,  6U }, { 26U, 1277U,  680U,  6U }, { 27U, 1336U,  736U,  5U },
+  { 32U, 1639U, 1024U,  5U }, { 36U, 1896U, 1296U,  5U }, { 37U, 1962U, 1376U,  4U },
+  { 39U, 2097U, 1536U,  4U }, { 52U, 3057U, 2720U,  4U }, { 53U, 3137U, 2816U,  3U },
+  { 55U, 3299U, 3008U,  3U }, { 63U, 3979U, 3968U,  3U },
+};
+
+static void check_aaf(void)
+{
+  uint16_t prev_bw = 0;
+  uint8_t prev_shift = 16U;
+  uint8_t seen = 0;
+
+  /* Each row round-trips through its own bandwidth */
+  for (size_t i = 0; i < sizeof(aaf_rows) / sizeof(aaf_rows[0]); ++i) {
+    uint16_t deltsqr = 0;
+    uint8_t bitshift = 0;
+    float actual = 0.0f;
+
+    TEST_CHECK(sl_icm42688p_aaf_delt((float)aaf_rows[i].bw_hz, &deltsqr, &bitshift, &actual) == aaf_rows[i].delt);
+    TEST_CHECK(deltsqr == aaf_rows[i].deltsqr);
+    TEST_CHECK(bitshift == aaf_rows[i].bitshift);
+    TEST_CHECK(actual == (float)aaf_rows[i].bw_hz);
+  }
+
+  /* The whole table, by sweeping the request 1 Hz at a time: every DELT in
+     turn, bandwidth rising, BITSHIFT falling, DELTSQR within 1/64 of DELT
+     squared */
+  for (uint32_t hz = 1U; hz <= 4500U; ++hz) {
+    uint16_t deltsqr = 0;
+    uint8_t bitshift = 0;
+    float actual = 0.0f;
+    uint8_t delt = sl_icm42688p_aaf_delt((float)hz, &deltsqr, &bitshift, &actual);
+    uint32_t square = (uint32_t)delt * delt;
+
+    if ((uint16_t)actual == prev_bw) {
+      continue;
+    }
+    seen++;
+    TEST_CHECK(delt == seen);
+    TEST_CHECK((uint16_t)actual > prev_bw && bitshift <= prev_shift);
+    TEST_CHECK(deltsqr + square / 64U + 1U >= square && deltsqr <= square + square / 64U + 1U);
+    prev_bw = (uint16_t)actual;
+    prev_shift = bitshift;
+  }
+  TEST_CHECK(seen == SL_ICM42688P_AAF_DELT_MAX && prev_bw == 3979U);
+
+  /* Nearest by ratio, clamped at both ends; nothing asked for is the
+     narrowest */
+  TEST_CHECK(sl_icm42688p_aaf_delt(60.0f, NULL, NULL, NULL) == 2U);     /* 42 * 1.43, 84 / 1.40 */
+  TEST_CHECK(sl_icm42688p_aaf_delt(58.0f, NULL, NULL, NULL) == 1U);
+  TEST_CHECK(sl_icm42688p_aaf_delt(1.0f, NULL, NULL, NULL) == 1U);
+  TEST_CHECK(sl_icm42688p_aaf_delt(20000.0f, NULL, NULL, NULL) == 63U);
+  TEST_CHECK(sl_icm42688p_aaf_delt(0.0f, NULL, NULL, NULL) == 1U);
+  TEST_CHECK(sl_icm42688p_aaf_delt(NAN, NULL, NULL, NULL) == 1U);
+}
+
+/* NF_COSWZ, NF_COSWZ_SEL for a centre frequency, from the datasheet: with
+   COSWZ = cos(2 pi f / 32 kHz), COSWZ * 256 when |COSWZ| <= 0.875, else
+   8 (1 - |COSWZ|) * 256 with SEL set, the sign following COSWZ */
+static const struct {
+  float hz;
+  uint16_t coswz;
+  bool sel;
+} notch_rows[] = {
+  { 1000.0f,  39U, true },   /* COSWZ 0.98079 */
+  { 1500.0f,  88U, true },   /* 0.95694 */
+  { 2000.0f, 156U, true },   /* 0.92388 */
+  { 2500.0f, 242U, true },   /* 0.88192 */
+  { 2600.0f, 223U, false },  /* 0.87250, just inside the direct range */
+  { 2750.0f, 220U, false },  /* 0.85773 */
+  { 3000.0f, 213U, false },  /* 0.83147 */
+};
+
+static void check_notch(void)
+{
+  static const uint16_t bw_rows[] = { 1449U, 680U, 329U, 162U, 80U, 40U, 20U, 10U };
+
+  for (size_t i = 0; i < sizeof(notch_rows) / sizeof(notch_rows[0]); ++i) {
+    uint16_t coswz = 0xFFFFU;
+    bool sel = !notch_rows[i].sel;
+
+    TEST_CHECK(sl_icm42688p_notch_coswz(notch_rows[i].hz, &coswz, &sel));
+    TEST_CHECK(coswz == notch_rows[i].coswz && sel == notch_rows[i].sel);
+  }
+
+  /* Outside 1 kHz to 3 kHz is refused */
+  {
+    uint16_t coswz = 7U;
+    bool sel = false;
+
+    TEST_CHECK(!sl_icm42688p_notch_coswz(999.0f, &coswz, &sel));
+    TEST_CHECK(!sl_icm42688p_notch_coswz(3001.0f, &coswz, &sel));
+    TEST_CHECK(!sl_icm42688p_notch_coswz(NAN, &coswz, &sel));
+    TEST_CHECK(coswz == 7U);
+  }
+
+  /* GYRO_NF_BW_SEL codes 0 to 7 */
+  for (uint8_t code = 0; code < 8U; ++code) {
+    float actual = 0.0f;
+
+    TEST_CHECK(sl_icm42688p_notch_bw_sel((float)bw_rows[code], &actual) == code);
+    TEST_CHECK(actual == (float)bw_rows[code]);
+  }
+  TEST_CHECK(sl_icm42688p_notch_bw_sel(100000.0f, NULL) == 0U);
+  TEST_CHECK(sl_icm42688p_notch_bw_sel(1.0f, NULL) == 7U);
+  TEST_CHECK(sl_icm42688p_notch_bw_sel(0.0f, NULL) == 0U);
+}
+
+/* UI_FILT_BW: code 0 is ODR / 2, codes 1 to 7 max(400 Hz, ODR) / 4, 5, 8,
+   10, 16, 20, 40 */
+static void check_ui(void)
+{
+  static const uint8_t divisor[] = { 2U, 4U, 5U, 8U, 10U, 16U, 20U, 40U };
+  static const uint32_t periods[] = { 125000U, 1000000U, 2000000U, 5000000U, 10000000U };
+  float actual = -1.0f;
+
+  for (size_t p = 0; p < sizeof(periods) / sizeof(periods[0]); ++p) {
+    float odr = 1.0e9f / (float)periods[p];
+
+    for (uint8_t code = 0; code < 8U; ++code) {
+      float bw = ((code == 0 || odr > 400.0f) ? odr : 400.0f) / (float)divisor[code];
+      uint8_t expect = code;
+
+      /* Below 400 Hz code 0 can land on another code's bandwidth (100 Hz
+         at 200 Hz ODR, 50 Hz at 100 Hz): the lower code wins */
+      if (code > 0 && bw == odr / 2.0f) {
+        expect = 0;
+      }
+      TEST_CHECK(sl_icm42688p_ui_filter_bw_code(bw, periods[p], &actual) == expect);
+      TEST_CHECK(actual == bw);
+    }
+  }
+  TEST_CHECK(sl_icm42688p_ui_filter_bw_code(0.0f, 1000000U, &actual) == ICM42688P_UI_FILT_BW_LOW_LATENCY);
+  TEST_CHECK(actual == 0.0f);
+  TEST_CHECK(sl_icm42688p_ui_filter_bw_code(-5.0f, 1000000U, NULL) == ICM42688P_UI_FILT_BW_LOW_LATENCY);
+}
+
+/* A whole configuration: fields as above, bandwidths written back */
+static void check_encode(void)
+{
+  sl_icm42688p_filter_config_t config = {
+    .accel = { .ui_order = 2U, .ui_bw_hz = 100.0f, .aaf_bw_hz = 0.0f },
+    .gyro = { .ui_order = 3U, .ui_bw_hz = 260.0f, .aaf_bw_hz = 540.0f },
+    .notch_hz = { 1000.0f, 2000.0f, 3000.0f },
+    .notch_bw_hz = 300.0f,
+  };
+  sl_icm42688p_filter_config_t bad;
+  sl_icm42688p_filter_regs_t regs;
+  sl_icm42688p_filter_regs_t untouched = { .gyro_aaf_delt = 99U };
+
+  TEST_CHECK(sl_icm42688p_filter_encode(&config, 1000000U, 1000000U, &regs));
+  TEST_CHECK(regs.accel_ui_ord == 1U && regs.gyro_ui_ord == 2U);
+  TEST_CHECK(regs.accel_ui_bw == 4U && config.accel.ui_bw_hz == 100.0f);
+  TEST_CHECK(regs.gyro_ui_bw == 1U && config.gyro.ui_bw_hz == 250.0f);
+  TEST_CHECK(regs.accel_aaf_dis && config.accel.aaf_bw_hz == 0.0f);
+  TEST_CHECK(!regs.gyro_aaf_dis && regs.gyro_aaf_delt == 12U && regs.gyro_aaf_deltsqr == 144U
+             && regs.gyro_aaf_bitshift == 8U && config.gyro.aaf_bw_hz == 536.0f);
+  TEST_CHECK(!regs.nf_dis && regs.nf_coswz[0] == 39U && regs.nf_coswz[1] == 156U && regs.nf_coswz[2] == 213U);
+  TEST_CHECK(regs.nf_coswz_sel == 0x3U);
+  TEST_CHECK(regs.nf_bw_sel == 2U && config.notch_bw_hz == 329.0f);
+
+  /* Notch off: all three at 0 */
+  config.notch_hz[0] = config.notch_hz[1] = config.notch_hz[2] = 0.0f;
+  TEST_CHECK(sl_icm42688p_filter_encode(&config, 1000000U, 1000000U, &regs));
+  TEST_CHECK(regs.nf_dis && regs.nf_coswz_sel == 0 && config.notch_bw_hz == 0.0f);
+
+  /* Refused: nothing written either way */
+  bad = config;
+  bad.gyro.ui_order = 4U;
+  bad.accel.ui_bw_hz = 123.0f;
+  regs = untouched;
+  TEST_CHECK(!sl_icm42688p_filter_encode(&bad, 1000000U, 1000000U, &regs));
+  TEST_CHECK(regs.gyro_aaf_delt == 99U && bad.accel.ui_bw_hz == 123.0f);
+  bad.gyro.ui_order = 0;
+  TEST_CHECK(!sl_icm42688p_filter_encode(&bad, 1000000U, 1000000U, &regs));
+  bad = config;
+  bad.accel.ui_bw_hz = 123.0f;
+  bad.notch_hz[0] = 1000.0f;
+  bad.notch_hz[1] = 500.0f;
+  bad.notch_hz[2] = 3000.0f;
+  TEST_CHECK(!sl_icm42688p_filter_encode(&bad, 1000000U, 1000000U, &regs));
+  TEST_CHECK(regs.gyro_aaf_delt == 99U && bad.accel.ui_bw_hz == 123.0f);
+  TEST_CHECK(!sl_icm42688p_filter_encode(&config, 0, 1000000U, &regs));
+  TEST_CHECK(!sl_icm42688p_filter_encode(NULL, 1000000U, 1000000U, &regs));
+}
+
+int main(void)
+{
+  check_aaf();
+  check_notch();
+  check_ui();
+  check_encode();
+  return test_result("test_filter");
+}
@@ -0,0 +1,273 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of merging ICM42688P accel and gyro onto one grid
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Gyro at 2 kHz and accel at 500 Hz on a different phase, so reads carrying
+ * one, the other or both interleave in time. Each field is linear in time
+ * where it was measured and junk where it was not. Records must land on
+ * the output grid with the held or interpolated value of each field, in
+ * order, through short gaps, long gaps and a full pending queue.
+ ******************************************************************************/
+
+#include <math.h>
+#include <string.h>
+#include "sl_icm42688p_merge.h"
+#include "test_support.h"
+
+#define TICK_HZ       32768U
+#define OUT_NS        1000000U     /* 1 kHz records */
+#define GYRO_NS       500000U
+#define ACCEL_NS      2000000U
+#define ACCEL_PHASE   300000U
+#define JUNK          -12345
+#define MAX_RECORDS   2048U
+#define MAX_READS     4096U
+
+static sl_icm42688p_stamped_sample_t rec[MAX_RECORDS];
+static uint32_t recs;
+
+typedef struct {
+  uint64_t t;               /* ticks */
+  uint8_t flags;
+} read_t;
+
+static read_t reads[MAX_READS];
+static uint32_t nreads;
+
+static void collect(const sl_icm42688p_stamped_sample_t *record, void *context)
+{
+  (void)context;
+  if (recs < MAX_RECORDS) {
+    rec[recs] = *record;
+  }
+  recs++;
+}
+
+/* Field f, axis k at time ticks: within 16 bits for the first second */
+static double line(uint8_t f, uint8_t k, double ticks)
+{
+  return (f == 0U) ? 0.5 * ticks - 8000.0 + 100.0 * k : -0.25 * ticks + 1000.0 * k;
+}
+
+static uint64_t at_ns(uint64_t ns)
+{
+  return (ns * TICK_HZ + 500000000U) / 1000000000U;
+}
+
+/* Both streams from t0 for duration_ns, in time order; one read where a
+   gyro and an accel sample share a tick. Returns the reads made. */
+static uint32_t make_reads(uint64_t t0, uint64_t duration_ns, uint32_t accel_ns)
+{
+  uint64_t g = 0;
+  uint64_t a = 0;
+  uint32_t start = nreads;
+
+  while (nreads < MAX_READS) {
+    uint64_t tg = t0 + at_ns(g * GYRO_NS);
+    uint64_t ta = t0 + at_ns(a * accel_ns + (a ? ACCEL_PHASE : 0U));
+    uint64_t t = (tg < ta) ? tg : ta;
+
+    if (t - t0 > at_ns(duration_ns)) {
+      break;
+    }
+    reads[nreads].t = t;
+    reads[nreads].flags = 0;
+    if (tg == t) {
+      reads[nreads].flags |= SL_ICM42688P_SAMPLE_GYRO_FRESH;
+      g++;
+    }
+    if (ta == t) {
+      reads[nreads].flags |= SL_ICM42688P_SAMPLE_ACCEL_FRESH;
+      a++;
+    }
+    nreads++;
+  }
+  return nreads - start;
+}
+
+static void push_read(sl_icm42688p_merge_t *merge, const read_t *read)
+{
+  sl_icm42688p_stamped_sample_t sample;
+  static const uint8_t fresh[2] = { SL_ICM42688P_SAMPLE_ACCEL_FRESH, SL_ICM42688P_SAMPLE_GYRO_FRESH };
+  static const uint8_t first[2] = { SL_ICM42688P_RAW_ACCEL_X, SL_ICM42688P_RAW_GYRO_X };
+
+  memset(&sample, 0, sizeof(sample));
+  sample.timestamp = read->t;
+  sample.flags = read->flags;
+  sample.raw.data[SL_ICM42688P_RAW_TEMP] = 77;
+  for (uint8_t f = 0; f < 2U; ++f) {
+    for (uint8_t k = 0; k < 3U; ++k) {
+      sample.raw.data[first[f] + k] = (read->flags & fresh[f])
+                                      ? (int32_t)lround(line(f, k, (double)read->t)) : JUNK;
+    }
+  }
+  (void)sl_icm42688p_merge_push(merge, &sample, collect, NULL);
+}
+
+/* Time of the last measurement of field f at or before t_q16 among reads
+   [from, to) */
+static uint64_t last_measured(uint8_t f, uint64_t t_q16, uint32_t from, uint32_t to)
+{
+  uint8_t fresh = f ? SL_ICM42688P_SAMPLE_GYRO_FRESH : SL_ICM42688P_SAMPLE_ACCEL_FRESH;
+  uint64_t t = reads[from].t;
+
+  for (uint32_t i = from; i < to && (reads[i].t << 16) <= t_q16; ++i) {
+    if (reads[i].flags & fresh) {
+      t = reads[i].t;
+    }
+  }
+  return t;
+}
+
+/* Records k0.. against the grid from reads[from], up to reads[to - 1] */
+static uint32_t check_records(const sl_icm42688p_merge_t *merge, sl_icm42688p_merge_mode_t mode,
+                              uint32_t k0, uint32_t k1, uint32_t from, uint32_t to)
+{
+  static const uint8_t first[2] = { SL_ICM42688P_RAW_ACCEL_X, SL_ICM42688P_RAW_GYRO_X };
+  static const uint8_t interp[2] = { SL_ICM42688P_SAMPLE_ACCEL_INTERP, SL_ICM42688P_SAMPLE_GYRO_INTERP };
+  uint64_t origin_q16 = reads[from].t << 16;
+  uint32_t wrong = 0;
+
+  for (uint32_t k = k0; k < k1 && k < MAX_RECORDS; ++k) {
+    uint64_t grid_q16 = origin_q16 + (k - k0) * merge->step_q16;
+
+    wrong += (rec[k].timestamp != (grid_q16 + 0x8000U) >> 16);
+    wrong += (rec[k].raw.data[SL_ICM42688P_RAW_TEMP] != 77);
+    for (uint8_t f = 0; f < 2U; ++f) {
+      uint64_t held = last_measured(f, grid_q16, from, to);
+      bool exact = (held << 16) == grid_q16;
+
+      for (uint8_t k3 = 0; k3 < 3U; ++k3) {
+        double expect = (mode == SL_ICM42688P_MERGE_HOLD || exact)
+                        ? line(f, k3, (double)held) : line(f, k3, (double)grid_q16 / 65536.0);
+
+        wrong += (fabs((double)rec[k].raw.data[first[f] + k3] - expect) > 1.0);
+      }
+      if (mode == SL_ICM42688P_MERGE_HOLD || exact) {
+        wrong += ((rec[k].flags & interp[f]) != 0);
+      } else {
+        wrong += ((rec[k].flags & interp[f]) == 0);
+      }
+    }
+  }
+  return wrong;
+}
+
+static void check_interleaved(void)
+{
+  static const sl_icm42688p_merge_mode_t modes[] = { SL_ICM42688P_MERGE_HOLD, SL_ICM42688P_MERGE_INTERPOLATE };
+
+  nreads = 0;
+  (void)make_reads(500U, 500000000U, ACCEL_NS);
+
+  for (size_t m = 0; m < 2U; ++m) {
+    sl_icm42688p_merge_t merge;
+    uint32_t grid_points;
+    uint32_t accel_fresh = 0;
+
+    sl_icm42688p_merge_init(&merge, TICK_HZ, OUT_NS, modes[m]);
+    recs = 0;
+    for (uint32_t i = 0; i < nreads; ++i) {
+      push_read(&merge, &reads[i]);
+    }
+
+    /* Every grid point up to the last read, less those still waiting for
+       the next accel measurement */
+    grid_points = (uint32_t)((((reads[nreads - 1U].t - reads[0].t) << 16) / merge.step_q16) + 1U);
+    TEST_CHECK(recs == merge.outputs && recs + merge.count == grid_points);
+    TEST_CHECK(modes[m] == SL_ICM42688P_MERGE_HOLD ? merge.count == 0 : merge.count <= 2U);
+    TEST_CHECK(merge.forced == 0 && merge.gaps == 0);
+    TEST_CHECK(check_records(&merge, modes[m], 0, recs, 0, nreads) == 0);
+
+    /* Fresh marks the records after a new accel measurement: one in two */
+    for (uint32_t k = 0; k < recs; ++k) {
+      accel_fresh += (rec[k].flags & SL_ICM42688P_SAMPLE_ACCEL_FRESH) != 0;
+      TEST_CHECK((rec[k].flags & SL_ICM42688P_SAMPLE_GYRO_FRESH) != 0);
+    }
+    TEST_CHECK(accel_fresh + 1U >= recs / 2U && accel_fresh <= recs / 2U + 1U);
+  }
+}
+
+/* A gap of a few periods is filled from around it; one past
+   SL_ICM42688P_MERGE_MAX_GAP flushes what is queued and restarts the grid
+   at the first read after it */
+static void check_gaps(void)
+{
+  sl_icm42688p_merge_t merge;
+  uint32_t first_end;
+  uint32_t second;
+  uint32_t before;
+
+  nreads = 0;
+  (void)make_reads(0, 100000000U, ACCEL_NS);
+  /* Drop 5 ms worth of reads in the middle */
+  first_end = 0;
+  for (uint32_t i = 0; i < nreads; ++i) {
+    if (reads[i].t < at_ns(40000000U) || reads[i].t > at_ns(45000000U)) {
+      reads[first_end++] = reads[i];
+    }
+  }
+  nreads = first_end;
+  second = make_reads(at_ns(200000000U), 50000000U, ACCEL_NS);
+
+  sl_icm42688p_merge_init(&merge, TICK_HZ, OUT_NS, SL_ICM42688P_MERGE_INTERPOLATE);
+  recs = 0;
+  for (uint32_t i = 0; i < first_end; ++i) {
+    push_read(&merge, &reads[i]);
+  }
+  TEST_CHECK(merge.gaps == 0);
+  TEST_CHECK(check_records(&merge, SL_ICM42688P_MERGE_INTERPOLATE, 0, recs, 0, first_end) == 0);
+
+  /* The long gap: the records still waiting go out held */
+  before = recs + merge.count;
+  push_read(&merge, &reads[first_end]);
+  TEST_CHECK(merge.gaps == 1U && recs >= before);
+  TEST_CHECK(rec[before].timestamp == reads[first_end].t);
+
+  for (uint32_t i = first_end + 1U; i < first_end + second; ++i) {
+    push_read(&merge, &reads[i]);
+  }
+  TEST_CHECK(merge.gaps == 1U);
+  TEST_CHECK(check_records(&merge, SL_ICM42688P_MERGE_INTERPOLATE, before, recs, first_end, nreads) == 0);
+
+  /* Out of order restarts as well */
+  push_read(&merge, &reads[0]);
+  TEST_CHECK(merge.gaps == 2U);
+}
+
+/* Accel so slow that interpolated records outnumber the queue: the oldest
+   go out held, still in order */
+static void check_queue_full(void)
+{
+  sl_icm42688p_merge_t merge;
+  uint32_t forced_in_order = 0;
+
+  nreads = 0;
+  (void)make_reads(0, 200000000U, 40000000U);
+
+  sl_icm42688p_merge_init(&merge, TICK_HZ, OUT_NS, SL_ICM42688P_MERGE_INTERPOLATE);
+  recs = 0;
+  for (uint32_t i = 0; i < nreads; ++i) {
+    push_read(&merge, &reads[i]);
+  }
+  TEST_CHECK(merge.forced > 0 && merge.count <= SL_ICM42688P_MERGE_PENDING);
+  for (uint32_t k = 1; k < recs && k < MAX_RECORDS; ++k) {
+    forced_in_order += (rec[k].timestamp > rec[k - 1U].timestamp);
+    TEST_CHECK(rec[k].raw.data[SL_ICM42688P_RAW_ACCEL_X] != JUNK);
+  }
+  TEST_CHECK(forced_in_order == recs - 1U);
+  TEST_CHECK(recs + merge.count
+             == (uint32_t)((((reads[nreads - 1U].t - reads[0].t) << 16) / merge.step_q16) + 1U));
+}
+
+int main(void)
+{
+  check_interleaved();
+  check_gaps();
+  check_queue_full();
+  return test_result("test_merge");
+}
@@ -0,0 +1,151 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of the ICM42688P ODR and full-scale tables
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * ODR codes against the datasheet (ACCEL_CONFIG0 / GYRO_CONFIG0), rounding
+ * of requested rates to the nearest supported one by ratio, the limits of
+ * each power mode, and the FS_SEL ranges.
+ ******************************************************************************/
+
+#include <math.h>
+#include "sl_icm42688p_odr.h"
+#include "test_support.h"
+
+/* Datasheet ODR field values and their rates */
+static const struct {
+  uint8_t code;
+  float rate_hz;
+  bool gyro;              /* low-noise gyro and accel */
+  bool low_power;         /* low-power accel */
+} datasheet[] = {
+  { 1U, 32000.0f, true, false }, { 2U, 16000.0f, true, false }, { 3U, 8000.0f, true, false },
+  { 4U, 4000.0f, true, false },  { 5U, 2000.0f, true, false },  { 6U, 1000.0f, true, false },
+  { 7U, 200.0f, true, true },    { 8U, 100.0f, true, true },    { 9U, 50.0f, true, true },
+  { 10U, 25.0f, true, true },    { 11U, 12.5f, true, true },    { 12U, 6.25f, false, true },
+  { 13U, 3.125f, false, true },  { 14U, 1.5625f, false, true }, { 15U, 500.0f, true, true },
+};
+
+#define DATASHEET_CODES   (sizeof(datasheet) / sizeof(datasheet[0]))
+
+static void check_table(void)
+{
+  uint32_t listed = 0;
+
+  for (size_t i = 0; i < DATASHEET_CODES; ++i) {
+    const sl_icm42688p_odr_info_t *info = sl_icm42688p_odr_info(datasheet[i].code);
+    uint8_t modes = (uint8_t)((datasheet[i].gyro ? SL_ICM42688P_ODR_LN : 0U)
+                              | (datasheet[i].low_power ? SL_ICM42688P_ODR_ACCEL_LP : 0U));
+
+    TEST_CHECK(info != NULL);
+    if (!info) {
+      continue;
+    }
+    TEST_CHECK(info->code == datasheet[i].code);
+    TEST_CHECK(info->rate_hz == datasheet[i].rate_hz);
+    TEST_CHECK(info->period_ns == (uint32_t)lround(1e9 / datasheet[i].rate_hz));
+    TEST_CHECK(info->modes == modes);
+    TEST_CHECK(info->accel_noise_var > 0.0f && info->gyro_noise_var > 0.0f);
+  }
+
+  /* Code 0 is reserved, and nothing past the 4-bit field */
+  for (uint32_t code = 0; code < 256U; ++code) {
+    listed += (sl_icm42688p_odr_info((uint8_t)code) != NULL);
+  }
+  TEST_CHECK(sl_icm42688p_odr_info(0) == NULL);
+  TEST_CHECK(listed == DATASHEET_CODES);
+
+  /* Noise grows with the filter bandwidth, flat below 1.6 kHz ODR / 400 Hz */
+  TEST_CHECK(sl_icm42688p_odr_info(1U)->gyro_noise_var > sl_icm42688p_odr_info(6U)->gyro_noise_var);
+  TEST_CHECK(sl_icm42688p_odr_info(7U)->gyro_noise_var == sl_icm42688p_odr_info(11U)->gyro_noise_var);
+}
+
+/* Requested rate to the code it rounds to */
+static uint8_t nearest(float rate_hz, uint8_t modes)
+{
+  const sl_icm42688p_odr_info_t *info = sl_icm42688p_odr_nearest(rate_hz, modes);
+
+  return info ? info->code : 0U;
+}
+
+static void check_nearest(void)
+{
+  /* Exact rates map to themselves in every mode that has them */
+  for (size_t i = 0; i < DATASHEET_CODES; ++i) {
+    if (datasheet[i].gyro) {
+      TEST_CHECK(nearest(datasheet[i].rate_hz, SL_ICM42688P_ODR_GYRO) == datasheet[i].code);
+      TEST_CHECK(nearest(datasheet[i].rate_hz, SL_ICM42688P_ODR_LN) == datasheet[i].code);
+    }
+    if (datasheet[i].low_power) {
+      TEST_CHECK(nearest(datasheet[i].rate_hz, SL_ICM42688P_ODR_ACCEL_LP) == datasheet[i].code);
+    }
+  }
+
+  /* By ratio: 700 Hz is 1.40x from 500 Hz and 1.43x from 1 kHz */
+  TEST_CHECK(nearest(700.0f, SL_ICM42688P_ODR_LN) == 15U);
+  TEST_CHECK(nearest(720.0f, SL_ICM42688P_ODR_LN) == 6U);
+  TEST_CHECK(nearest(300.0f, SL_ICM42688P_ODR_LN) == 7U);
+  TEST_CHECK(nearest(330.0f, SL_ICM42688P_ODR_LN) == 15U);
+  TEST_CHECK(nearest(1100.0f, SL_ICM42688P_ODR_LN) == 6U);
+  TEST_CHECK(nearest(17.0f, SL_ICM42688P_ODR_LN) == 11U);
+  TEST_CHECK(nearest(18.0f, SL_ICM42688P_ODR_LN) == 10U);
+
+  /* Limits: clamped to the ends of what the modes support */
+  TEST_CHECK(nearest(1e6f, SL_ICM42688P_ODR_LN) == 1U);
+  TEST_CHECK(nearest(1.0f, SL_ICM42688P_ODR_LN) == 11U);
+  TEST_CHECK(nearest(1.0f, SL_ICM42688P_ODR_ACCEL_LP) == 14U);
+  TEST_CHECK(nearest(1e-3f, SL_ICM42688P_ODR_ACCEL_LP) == 14U);
+  TEST_CHECK(nearest(32000.0f, SL_ICM42688P_ODR_ACCEL_LP) == 15U);
+  TEST_CHECK(nearest(INFINITY, SL_ICM42688P_ODR_LN) == 1U);
+
+  /* Codes valid in all the modes asked for */
+  TEST_CHECK(nearest(1000.0f, SL_ICM42688P_ODR_GYRO | SL_ICM42688P_ODR_ACCEL_LP) == 15U);
+  TEST_CHECK(nearest(3.0f, SL_ICM42688P_ODR_GYRO | SL_ICM42688P_ODR_ACCEL_LP) == 11U);
+
+  /* Nothing to round */
+  TEST_CHECK(sl_icm42688p_odr_nearest(0.0f, SL_ICM42688P_ODR_LN) == NULL);
+  TEST_CHECK(sl_icm42688p_odr_nearest(-100.0f, SL_ICM42688P_ODR_LN) == NULL);
+  TEST_CHECK(sl_icm42688p_odr_nearest(NAN, SL_ICM42688P_ODR_LN) == NULL);
+  TEST_CHECK(sl_icm42688p_odr_nearest(100.0f, 0x80U) == NULL);
+}
+
+static void check_full_scale(void)
+{
+  static const float accel[] = { 16.0f, 8.0f, 4.0f, 2.0f };
+  static const float gyro[] = { 2000.0f, 1000.0f, 500.0f, 250.0f, 125.0f, 62.5f, 31.25f, 15.625f };
+
+  for (uint8_t code = 0; code < 4U; ++code) {
+    const sl_icm42688p_fs_info_t *info = sl_icm42688p_accel_fs_info(code);
+
+    TEST_CHECK(info->code == code && info->range == accel[code]);
+    TEST_CHECK(info->sensitivity == 32768.0f / accel[code] && fabsf(info->scale * info->sensitivity - 1.0f) < 1e-6f);
+  }
+  for (uint8_t code = 0; code < 8U; ++code) {
+    const sl_icm42688p_fs_info_t *info = sl_icm42688p_gyro_fs_info(code);
+
+    TEST_CHECK(info->code == code && info->range == gyro[code]);
+    TEST_CHECK(info->sensitivity == 32768.0f / gyro[code] && fabsf(info->scale * info->sensitivity - 1.0f) < 1e-6f);
+  }
+  TEST_CHECK(sl_icm42688p_accel_fs_info(4U) == NULL && sl_icm42688p_gyro_fs_info(8U) == NULL);
+
+  /* Narrowest range that covers the request; the widest past it */
+  TEST_CHECK(sl_icm42688p_accel_fs_for_range(2.0f)->code == 3U);
+  TEST_CHECK(sl_icm42688p_accel_fs_for_range(2.01f)->code == 2U);
+  TEST_CHECK(sl_icm42688p_accel_fs_for_range(0.0f)->code == 3U);
+  TEST_CHECK(sl_icm42688p_accel_fs_for_range(50.0f)->code == 0U);
+  TEST_CHECK(sl_icm42688p_gyro_fs_for_range(250.0f)->code == 3U);
+  TEST_CHECK(sl_icm42688p_gyro_fs_for_range(300.0f)->code == 2U);
+  TEST_CHECK(sl_icm42688p_gyro_fs_for_range(10.0f)->code == 7U);
+  TEST_CHECK(sl_icm42688p_gyro_fs_for_range(4000.0f)->code == 0U);
+}
+
+int main(void)
+{
+  check_table();
+  check_nearest();
+  check_full_scale();
+  return test_result("test_odr");
+}
@@ -0,0 +1,189 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of ICM42688P resampling onto the nominal ODR grid
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Inputs from a sensor running off its nominal rate, carrying values that
+ * are linear in time, fed in FIFO-sized blocks: every output has to land on
+ * the grid and carry the line's value there, across block boundaries, and
+ * the grid has to restart after a gap.
+ ******************************************************************************/
+
+#include <math.h>
+#include <string.h>
+#include "sl_icm42688p_resample.h"
+#include "test_support.h"
+
+#define TICK_HZ     32768U
+#define PERIOD_NS   1000000U      /* 1 kHz nominal */
+#define MAX_OUT     4096U
+
+static sl_icm42688p_stamped_sample_t out[MAX_OUT];
+static uint32_t outs;
+
+static void collect(const sl_icm42688p_stamped_sample_t *sample, void *context)
+{
+  (void)context;
+  if (outs < MAX_OUT) {
+    out[outs] = *sample;
+  }
+  outs++;
+}
+
+/* Value of word i on the line at time ticks, within 16 bits for the first
+   2 s */
+static double line(uint8_t i, double ticks)
+{
+  return ((double)i - 3.0) * ticks / 8.0 + 1000.0 * i;
+}
+
+/* Input n of a sensor running ppm fast, stamped to the nearest tick */
+static void input(sl_icm42688p_stamped_sample_t *sample, uint32_t n, double ppm, double start)
+{
+  double t = start + (double)n * (PERIOD_NS / 1e9) * TICK_HZ / (1.0 + ppm * 1e-6);
+
+  memset(sample, 0, sizeof(*sample));
+  sample->timestamp = (uint64_t)llround(t);
+  for (uint8_t i = 0; i < SL_ICM42688P_RAW_WORDS; ++i) {
+    sample->raw.data[i] = (int32_t)lround(line(i, (double)sample->timestamp));
+  }
+  sample->flags = SL_ICM42688P_SAMPLE_FRESH;
+}
+
+/* Outputs on the grid from the first input, spaced by the Q16 step, each
+   with the line's value at its timestamp */
+static void check_grid(void)
+{
+  static const double skews[] = { 0.0, 300.0, -300.0, 20000.0 };
+  static const uint32_t blocks[] = { 1U, 7U, 16U, 100U };
+
+  for (size_t s = 0; s < sizeof(skews) / sizeof(skews[0]); ++s) {
+    for (size_t b = 0; b < sizeof(blocks) / sizeof(blocks[0]); ++b) {
+      sl_icm42688p_resample_t rs;
+      sl_icm42688p_stamped_sample_t sample;
+      uint64_t origin_q16;
+      uint32_t wrong_time = 0;
+      uint32_t wrong_value = 0;
+      uint32_t returned = 0;
+
+      sl_icm42688p_resample_init(&rs, TICK_HZ, PERIOD_NS);
+      outs = 0;
+
+      /* Blocks as FIFO bursts deliver them: the grid does not care */
+      for (uint32_t n = 0; n < 2000U; n += blocks[b]) {
+        for (uint32_t k = n; k < n + blocks[b] && k < 2000U; ++k) {
+          input(&sample, k, skews[s], 1000.3);
+          returned += sl_icm42688p_resample_push(&rs, &sample, collect, NULL);
+        }
+      }
+      TEST_CHECK(returned == outs && rs.outputs == outs && rs.inputs == 2000U && rs.gaps == 0);
+
+      /* The first input goes out as is */
+      input(&sample, 0, skews[s], 1000.3);
+      TEST_CHECK(out[0].timestamp == sample.timestamp && out[0].raw.data[1] == sample.raw.data[1]);
+      origin_q16 = sample.timestamp << 16;
+
+      /* As many outputs as grid points up to the last input */
+      input(&sample, 1999U, skews[s], 1000.3);
+      TEST_CHECK(outs == (uint32_t)(((sample.timestamp << 16) - origin_q16) / rs.step_q16) + 1U);
+
+      for (uint32_t k = 1; k < outs && k < MAX_OUT; ++k) {
+        uint64_t grid_q16 = origin_q16 + k * rs.step_q16;
+
+        wrong_time += (out[k].timestamp != (grid_q16 + 0x8000U) >> 16);
+        wrong_time += ((out[k].flags & SL_ICM42688P_SAMPLE_INTERP) == 0);
+        for (uint8_t i = 0; i < SL_ICM42688P_RAW_WORDS; ++i) {
+          /* Inputs are on the line at their ticks, to rounding */
+          double expect = line(i, (double)grid_q16 / 65536.0);
+
+          wrong_value += (fabs((double)out[k].raw.data[i] - expect) > 1.0);
+        }
+      }
+      TEST_CHECK(wrong_time == 0);
+      TEST_CHECK(wrong_value == 0);
+    }
+  }
+}
+
+/* A gap past SL_ICM42688P_RESAMPLE_MAX_GAP restarts the grid at the next
+   input instead of interpolating across; a shorter one fills in */
+static void check_gap(void)
+{
+  sl_icm42688p_resample_t rs;
+  sl_icm42688p_stamped_sample_t sample;
+  uint32_t before;
+
+  sl_icm42688p_resample_init(&rs, TICK_HZ, PERIOD_NS);
+  outs = 0;
+  for (uint32_t n = 0; n < 100U; ++n) {
+    input(&sample, n, 0.0, 0.0);
+    (void)sl_icm42688p_resample_push(&rs, &sample, collect, NULL);
+  }
+
+  /* 10 periods missing: 10 grid points filled in, no restart */
+  before = outs;
+  input(&sample, 110U, 0.0, 0.0);
+  TEST_CHECK(sl_icm42688p_resample_push(&rs, &sample, collect, NULL) >= 10U);
+  TEST_CHECK(rs.gaps == 0 && outs - before >= 10U);
+
+  /* 100 periods missing: the input goes out as is and the grid restarts there */
+  before = outs;
+  input(&sample, 210U, 0.0, 0.0);
+  TEST_CHECK(sl_icm42688p_resample_push(&rs, &sample, collect, NULL) == 1U);
+  TEST_CHECK(rs.gaps == 1U && outs == before + 1U);
+  TEST_CHECK(out[before].timestamp == sample.timestamp && out[before].raw.data[1] == sample.raw.data[1]);
+
+  before = outs;
+  input(&sample, 211U, 0.0, 0.0);
+  TEST_CHECK(sl_icm42688p_resample_push(&rs, &sample, collect, NULL) == 1U);
+  TEST_CHECK(out[before].timestamp == ((((out[before - 1U].timestamp) << 16) + rs.step_q16 + 0x8000U) >> 16));
+
+  /* Time going backwards restarts too */
+  input(&sample, 5U, 0.0, 0.0);
+  TEST_CHECK(sl_icm42688p_resample_push(&rs, &sample, collect, NULL) == 1U && rs.gaps == 2U);
+}
+
+/* An FSYNC tag moves to the first output at or after the edge, with the
+   offset measured from that output */
+static void check_fsync(void)
+{
+  sl_icm42688p_resample_t rs;
+  sl_icm42688p_stamped_sample_t sample;
+  uint64_t edge_q16;
+  uint32_t tagged = 0;
+
+  sl_icm42688p_resample_init(&rs, TICK_HZ, PERIOD_NS);
+  outs = 0;
+  for (uint32_t n = 0; n < 50U; ++n) {
+    input(&sample, n, 500.0, 0.0);
+    if (n == 20U) {
+      sample.flags |= SL_ICM42688P_SAMPLE_FSYNC;
+      sample.fsync_q16 = 10U << 16;     /* edge 10 ticks before this input */
+    }
+    (void)sl_icm42688p_resample_push(&rs, &sample, collect, NULL);
+  }
+  input(&sample, 20U, 500.0, 0.0);
+  edge_q16 = (sample.timestamp - 10U) << 16;
+
+  for (uint32_t k = 0; k < outs; ++k) {
+    if (out[k].flags & SL_ICM42688P_SAMPLE_FSYNC) {
+      uint64_t grid_q16 = (out[0].timestamp << 16) + k * rs.step_q16;
+
+      tagged++;
+      TEST_CHECK(grid_q16 >= edge_q16 && grid_q16 - rs.step_q16 < edge_q16);
+      TEST_CHECK(out[k].fsync_q16 == (uint32_t)(grid_q16 - edge_q16));
+    }
+  }
+  TEST_CHECK(tagged == 1U);
+}
+
+int main(void)
+{
+  check_grid();
+  check_gap();
+  check_fsync();
+  return test_result("test_resample");
+}
@@ -0,0 +1,152 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host stress test of the ICM42688P sample ring
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * A producer and a consumer thread hammer a small ring. Every entry carries
+ * its sequence number in every field, so a torn, duplicated, lost or
+ * reordered entry shows up on the consumer side.
+ ******************************************************************************/
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include "sl_icm42688p_ring.h"
+#include "test_support.h"
+
+#define STRESS_ENTRIES    2000000U
+#define STRESS_CAPACITY   8U
+#define STRESS_TRY_EVERY  1000U   /* every n-th push is not retried: exercises overflow */
+
+static sl_icm42688p_ring_t ring;
+static sl_icm42688p_ring_entry_t entries[STRESS_CAPACITY];
+static atomic_bool producer_done;
+static uint32_t pushed;
+static uint32_t refused;
+
+static void fill_entry(sl_icm42688p_ring_entry_t *entry, uint32_t seq)
+{
+  for (uint32_t k = 0; k < SL_ICM42688P_RAW_WORDS; ++k) {
+    entry->raw.data[k] = (int32_t)(seq * (k + 1U));
+  }
+  entry->timestamp = ((uint64_t)seq << 32) | seq;
+  entry->flags = (uint8_t)seq;
+  entry->fsync_q16 = ~seq;
+}
+
+static bool entry_intact(const sl_icm42688p_ring_entry_t *entry)
+{
+  uint32_t seq = (uint32_t)entry->timestamp;
+
+  for (uint32_t k = 0; k < SL_ICM42688P_RAW_WORDS; ++k) {
+    if (entry->raw.data[k] != (int32_t)(seq * (k + 1U))) {
+      return false;
+    }
+  }
+  return (entry->timestamp >> 32) == seq && entry->flags == (uint8_t)seq && entry->fsync_q16 == ~seq;
+}
+
+static void *producer(void *arg)
+{
+  sl_icm42688p_ring_entry_t entry;
+
+  (void)arg;
+  for (uint32_t seq = 0; seq < STRESS_ENTRIES; ++seq) {
+    fill_entry(&entry, seq);
+    if (seq % STRESS_TRY_EVERY == 0) {
+      if (sl_icm42688p_ring_push(&ring, &entry)) {
+        pushed++;
+      } else {
+        refused++;
+      }
+    } else {
+      while (!sl_icm42688p_ring_push(&ring, &entry)) {
+        refused++;
+        sched_yield();
+      }
+      pushed++;
+    }
+  }
+  atomic_store(&producer_done, true);
+  return NULL;
+}
+
+static void check_two_threads(void)
+{
+  pthread_t thread;
+  sl_icm42688p_ring_entry_t entry;
+  uint32_t popped = 0;
+  uint32_t torn = 0;
+  uint32_t misordered = 0;
+  uint32_t last = 0;
+  bool first = true;
+
+  TEST_CHECK(sl_icm42688p_ring_init(&ring, entries, STRESS_CAPACITY) == SL_STATUS_OK);
+  TEST_CHECK(pthread_create(&thread, NULL, producer, NULL) == 0);
+
+  for (;;) {
+    if (sl_icm42688p_ring_pop(&ring, &entry)) {
+      uint32_t seq = (uint32_t)entry.timestamp;
+
+      if (!entry_intact(&entry)) {
+        torn++;
+      }
+      if (!first && seq <= last) {
+        misordered++;
+      }
+      first = false;
+      last = seq;
+      popped++;
+    } else if (atomic_load(&producer_done) && sl_icm42688p_ring_count(&ring) == 0) {
+      break;
+    } else {
+      sched_yield();
+    }
+  }
+  pthread_join(thread, NULL);
+
+  printf("  pushed %u, popped %u, overflows %u\n", pushed, popped, ring.overflows);
+  TEST_CHECK(torn == 0);
+  TEST_CHECK(misordered == 0);
+  TEST_CHECK(popped == pushed);
+  TEST_CHECK(ring.overflows == refused);
+  TEST_CHECK(pushed >= STRESS_ENTRIES - STRESS_ENTRIES / STRESS_TRY_EVERY);
+}
+
+/* Single thread: parameters, full ring, index wrap at 2^32 */
+static void check_single_thread(void)
+{
+  sl_icm42688p_ring_entry_t entry;
+
+  TEST_CHECK(sl_icm42688p_ring_init(&ring, entries, 6U) == SL_STATUS_INVALID_PARAMETER);
+  TEST_CHECK(sl_icm42688p_ring_init(&ring, entries, 0) == SL_STATUS_INVALID_PARAMETER);
+  TEST_CHECK(sl_icm42688p_ring_init(&ring, entries, STRESS_CAPACITY) == SL_STATUS_OK);
+  TEST_CHECK(!sl_icm42688p_ring_pop(&ring, &entry));
+
+  ring.head = ring.tail = UINT32_MAX - 3U;
+  for (uint32_t seq = 0; seq < STRESS_CAPACITY; ++seq) {
+    fill_entry(&entry, seq);
+    TEST_CHECK(sl_icm42688p_ring_push(&ring, &entry));
+  }
+  TEST_CHECK(!sl_icm42688p_ring_push(&ring, &entry));
+  TEST_CHECK(ring.overflows == 1U);
+  TEST_CHECK(sl_icm42688p_ring_count(&ring) == STRESS_CAPACITY);
+
+  for (uint32_t seq = 0; seq < STRESS_CAPACITY; ++seq) {
+    TEST_CHECK(sl_icm42688p_ring_pop(&ring, &entry));
+    TEST_CHECK(entry_intact(&entry) && (uint32_t)entry.timestamp == seq);
+  }
+  TEST_CHECK(!sl_icm42688p_ring_pop(&ring, &entry));
+  TEST_CHECK(sl_icm42688p_ring_count(&ring) == 0);
+}
+
+int main(void)
+{
+  check_single_thread();
+  check_two_threads();
+
+  return test_result("test_ring");
+}
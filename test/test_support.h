@@ -0,0 +1,53 @@
+/***************************************************************************//**
+ * @file
+ * @brief Checks and timing for the ICM42688P host tests
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ ******************************************************************************/
+
+#ifndef TEST_SUPPORT_H
+#define TEST_SUPPORT_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+static int test_failures;
+
+/* Report a failed check and carry on, so one run lists every failure */
+#define TEST_CHECK(cond)                                                       \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+      test_failures++;                                                         \
+    }                                                                          \
+  } while (0)
+
+/* Exit status of main() */
+static inline int test_result(const char *name)
+{
+  printf("%s: %s (%d failed)\n", name, test_failures ? "FAIL" : "ok", test_failures);
+  return test_failures ? 1 : 0;
+}
+
+static inline uint64_t test_now_ns(void)
+{
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint64_t)t.tv_sec * 1000000000U + (uint64_t)t.tv_nsec;
+}
+
+/* Deterministic input: xorshift32, the same sequence on every host */
+static inline uint32_t test_rand(uint32_t *state)
+{
+  uint32_t x = *state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  *state = x;
+  return x;
+}
+
+#endif // TEST_SUPPORT_H
@@ -0,0 +1,173 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of ICM42688P timestamp reconstruction
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * Synthetic traces: a sensor clock with a known rate error and TMST
+ * quantisation, interrupt edges captured late by a random latency, and the
+ * counters wrapping.
+ ******************************************************************************/
+
+#include <math.h>
+#include "sl_icm42688p_timestamp.h"
+#include "test_support.h"
+
+#define TICK_HZ      32768U
+#define RELAX_SHIFT  4U
+
+/* TMST of a packet at sensor time t us: a free-running 16-bit counter */
+static uint16_t tmst_at(uint64_t t_us, uint32_t lsb_us)
+{
+  return (uint16_t)(t_us / lsb_us);
+}
+
+/* One wrap every 65.5 ms (1 us) or 1.05 s (16 us) at 1 kHz */
+static void check_single_wraps(void)
+{
+  static const uint32_t lsbs[] = { 1U, 16U };
+
+  for (size_t l = 0; l < sizeof(lsbs) / sizeof(lsbs[0]); ++l) {
+    sl_icm42688p_timestamp_t ts;
+    uint32_t lsb = lsbs[l];
+    uint32_t wrong = 0;
+    uint64_t t0 = 40000U * (uint64_t)lsb;   /* starts mid-range */
+
+    sl_icm42688p_timestamp_init(&ts, TICK_HZ, lsb, 1000U, RELAX_SHIFT);
+    for (uint32_t i = 0; i < 300000U; ++i) {
+      uint64_t t = t0 + (uint64_t)i * 1000U;
+      uint64_t expected = (t / lsb) * lsb - (t0 / lsb) * lsb;
+
+      if (sl_icm42688p_timestamp_extend_tmst(&ts, tmst_at(t, lsb)) != expected) {
+        wrong++;
+      }
+    }
+    TEST_CHECK(wrong == 0);
+    TEST_CHECK(ts.tmst_wraps == (uint32_t)((t0 + 299999ULL * 1000U) / lsb / 65536U - t0 / lsb / 65536U));
+  }
+}
+
+/* 1.5625 Hz at 1 us: about ten wraps between packets, with the period off
+   by a few us either way */
+static void check_multiple_wraps(void)
+{
+  sl_icm42688p_timestamp_t ts;
+  uint32_t seed = 7U;
+  uint32_t wrong = 0;
+  uint64_t t = 0;
+
+  sl_icm42688p_timestamp_init(&ts, TICK_HZ, 1U, 640000U, RELAX_SHIFT);
+  (void)sl_icm42688p_timestamp_extend_tmst(&ts, tmst_at(t, 1U));
+  for (uint32_t i = 0; i < 5000U; ++i) {
+    t += 640000U - 50U + test_rand(&seed) % 101U;
+    if (sl_icm42688p_timestamp_extend_tmst(&ts, tmst_at(t, 1U)) != t) {
+      wrong++;
+    }
+  }
+  TEST_CHECK(wrong == 0);
+  TEST_CHECK(ts.tmst_wraps == (uint32_t)(t / 65536U));
+
+  /* Packets without TMST advance by the nominal period */
+  uint64_t before = ts.sensor_us;
+  TEST_CHECK(sl_icm42688p_timestamp_extend_period(&ts) == before + 640000U);
+}
+
+/* Sensor clock 2% fast, edges captured 0-5 ticks late, the capture counter
+   wrapping at 2^32 during the run. Output stays within the latency of the
+   true time and never goes backwards. */
+static void check_jitter(void)
+{
+  sl_icm42688p_timestamp_t ts;
+  const double rate = 1.02;
+  const double t0_ticks = 4294967296.0 - 20.0 * TICK_HZ;   /* wraps 20 s in */
+  uint32_t seed = 99U;
+  uint32_t backwards = 0;
+  double max_error = 0.0;
+  uint64_t previous = 0;
+
+  sl_icm42688p_timestamp_init(&ts, TICK_HZ, 1U, 1000U, RELAX_SHIFT);
+  sl_icm42688p_timestamp_set_rate(&ts, (uint32_t)(rate * SL_ICM42688P_TIMESTAMP_RATE_ONE));
+
+  for (uint32_t i = 0; i < 60000U; ++i) {
+    uint64_t t_us = (uint64_t)i * 1000U;
+    double true_ticks = t0_ticks + (double)t_us * 1e-6 * TICK_HZ * rate;
+    uint64_t sensor_us = sl_icm42688p_timestamp_extend_tmst(&ts, tmst_at(t_us, 1U));
+
+    if (i % 20U == 19U) {
+      uint32_t latency = test_rand(&seed) % 6U;
+      sl_icm42688p_timestamp_anchor(&ts, sensor_us, (uint32_t)(uint64_t)(true_ticks + latency));
+    }
+
+    uint64_t out = sl_icm42688p_timestamp_to_ticks(&ts, sensor_us);
+    if (i >= 1000U) {
+      double error = fabs((double)out - true_ticks);
+      if (error > max_error) {
+        max_error = error;
+      }
+      if (out < previous) {
+        backwards++;
+      }
+    }
+    previous = out;
+  }
+
+  printf("  jitter: max error %.2f ticks over %u anchors\n", max_error, ts.anchors);
+  TEST_CHECK(backwards == 0);
+  TEST_CHECK(max_error <= 6.0);
+  TEST_CHECK(ts.capture_ticks > UINT32_MAX);
+}
+
+/* An anchor far earlier than predicted pulls the mapping back; outputs are
+   held until time catches up */
+static void check_monotonic_clamp(void)
+{
+  sl_icm42688p_timestamp_t ts;
+  uint64_t held;
+  uint64_t out;
+
+  sl_icm42688p_timestamp_init(&ts, TICK_HZ, 1U, 1000U, RELAX_SHIFT);
+  TEST_CHECK(sl_icm42688p_timestamp_to_ticks(&ts, 0) == 0);   /* not anchored yet */
+
+  sl_icm42688p_timestamp_anchor(&ts, 0, 100000U);
+  held = sl_icm42688p_timestamp_to_ticks(&ts, 10000U);        /* 10 ms: 327 ticks */
+  TEST_CHECK(held == 100327U);
+
+  sl_icm42688p_timestamp_anchor(&ts, 20000U, 100200U);        /* 455 ticks early */
+  out = sl_icm42688p_timestamp_to_ticks(&ts, 20000U);
+  TEST_CHECK(out == held);
+  TEST_CHECK(ts.clamped == 1U);
+
+  out = sl_icm42688p_timestamp_to_ticks(&ts, 23000U);         /* 100200 + 98 */
+  TEST_CHECK(out == held);
+  TEST_CHECK(ts.clamped == 2U);
+  out = sl_icm42688p_timestamp_to_ticks(&ts, 40000U);         /* 100200 + 655 */
+  TEST_CHECK(out == 100855U);
+  TEST_CHECK(ts.clamped == 2U);
+
+  /* Edge-only path: the extended capture, through the same clamp */
+  TEST_CHECK(sl_icm42688p_timestamp_from_capture(&ts, 100500U) == 100855U);
+  TEST_CHECK(ts.clamped == 3U);
+  TEST_CHECK(sl_icm42688p_timestamp_from_capture(&ts, 101000U) == 101000U);
+}
+
+static void check_interval(void)
+{
+  sl_icm42688p_timestamp_t ts;
+
+  sl_icm42688p_timestamp_init(&ts, TICK_HZ, 16U, 1000U, RELAX_SHIFT);
+  /* 100 LSB of 16 us = 1.6 ms = 52.4288 ticks */
+  TEST_CHECK(sl_icm42688p_timestamp_interval_q16(&ts, 100U) == 3435973U);
+}
+
+int main(void)
+{
+  check_single_wraps();
+  check_multiple_wraps();
+  check_jitter();
+  check_monotonic_clamp();
+  check_interval();
+
+  return test_result("test_timestamp");
+}
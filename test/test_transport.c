@@ -0,0 +1,257 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of the ICM42688P asynchronous transfer queue
+ *******************************************************************************
+ * SPDX-License-Identifier: Zlib
+ *
+ * Copyright 2025 Silicon Laboratories Inc.
+ *
+ * A simulated DMA backend holds the transfer in flight until the test
+ * completes it, loops TX back to RX, and can refuse to start. The lock is
+ * checked to be taken and released in pairs and never nested.
+ ******************************************************************************/
+
+#include <string.h>
+#include "sl_icm42688p_transport.h"
+#include "test_support.h"
+
+#define MAX_EVENTS  32U
+
+typedef struct {
+  const uint8_t *tx;
+  uint8_t *rx;
+  uint16_t len;
+  bool in_flight;
+  uint32_t starts;
+  uint32_t refuse_next;    /* starts to refuse from now on */
+  int lock_depth;
+  uint32_t bad_locks;
+} sim_dma_t;
+
+static sim_dma_t dma;
+static sl_icm42688p_transport_t transport;
+
+/* Callback log: context tag and status, in call order */
+static uintptr_t event_tag[MAX_EVENTS];
+static sl_status_t event_status[MAX_EVENTS];
+static uint32_t events;
+
+static sl_status_t sim_start(const uint8_t *tx, uint8_t *rx, uint16_t len, void *context)
+{
+  sim_dma_t *sim = context;
+
+  if (sim->in_flight || sim->lock_depth != 0) {
+    sim->bad_locks++;
+  }
+  sim->starts++;
+  if (sim->refuse_next > 0) {
+    sim->refuse_next--;
+    return SL_STATUS_FAIL;
+  }
+  sim->tx = tx;
+  sim->rx = rx;
+  sim->len = len;
+  sim->in_flight = true;
+  return SL_STATUS_OK;
+}
+
+static void sim_lock(void)
+{
+  if (++dma.lock_depth != 1) {
+    dma.bad_locks++;
+  }
+}
+
+static void sim_unlock(void)
+{
+  if (--dma.lock_depth != 0) {
+    dma.bad_locks++;
+  }
+}
+
+static const sl_icm42688p_transport_backend_t sim_backend = {
+  .start = sim_start,
+  .lock = sim_lock,
+  .unlock = sim_unlock,
+  .context = &dma,
+};
+
+/* The DMA finishes the transfer in flight */
+static void sim_finish(sl_status_t status)
+{
+  TEST_CHECK(dma.in_flight);
+  if (dma.rx) {
+    for (uint16_t i = 0; i < dma.len; ++i) {
+      dma.rx[i] = dma.tx ? dma.tx[i] : 0U;
+    }
+  }
+  dma.in_flight = false;
+  sl_icm42688p_transport_complete(&transport, status);
+}
+
+static void on_done(sl_status_t status, void *context)
+{
+  if (events < MAX_EVENTS) {
+    event_tag[events] = (uintptr_t)context;
+    event_status[events] = status;
+  }
+  events++;
+}
+
+/* Submits tag + 100 from inside its own completion */
+static void on_done_resubmit(sl_status_t status, void *context)
+{
+  static const uint8_t tx[2] = { 0xA5, 0x5A };
+
+  on_done(status, context);
+  TEST_CHECK(sl_icm42688p_transport_submit(&transport, tx, NULL, sizeof(tx), on_done,
+                                           (void *)((uintptr_t)context + 100U)) == SL_STATUS_OK);
+}
+
+static void reset(void)
+{
+  memset(&dma, 0, sizeof(dma));
+  events = 0;
+  sl_icm42688p_transport_init(&transport, &sim_backend);
+}
+
+/* Completions in submission order, each transfer started as the previous
+   one finishes, data and contexts kept apart */
+static void check_order(void)
+{
+  uint8_t tx[3][4] = { { 1, 2, 3, 4 }, { 5, 6, 7, 8 }, { 9, 10, 11, 12 } };
+  uint8_t rx[3][4] = { { 0 } };
+
+  reset();
+  TEST_CHECK(!sl_icm42688p_transport_busy(&transport));
+  for (uintptr_t i = 0; i < 3U; ++i) {
+    TEST_CHECK(sl_icm42688p_transport_submit(&transport, tx[i], rx[i], 4, on_done, (void *)i) == SL_STATUS_OK);
+  }
+  TEST_CHECK(dma.starts == 1U && dma.tx == tx[0]);
+  TEST_CHECK(sl_icm42688p_transport_busy(&transport));
+
+  for (uintptr_t i = 0; i < 3U; ++i) {
+    TEST_CHECK(dma.tx == tx[i] && dma.rx == rx[i]);
+    sim_finish(SL_STATUS_OK);
+    TEST_CHECK(events == i + 1U && event_tag[i] == i && event_status[i] == SL_STATUS_OK);
+    TEST_CHECK(memcmp(rx[i], tx[i], 4) == 0);
+  }
+  TEST_CHECK(dma.starts == 3U && !dma.in_flight);
+  TEST_CHECK(!sl_icm42688p_transport_busy(&transport));
+  TEST_CHECK(transport.submitted == 3U && transport.completed == 3U && transport.errors == 0);
+
+  /* Errors reported by the DMA reach the right callback */
+  TEST_CHECK(sl_icm42688p_transport_submit(&transport, tx[0], NULL, 4, on_done, (void *)7U) == SL_STATUS_OK);
+  sim_finish(SL_STATUS_TRANSMIT);
+  TEST_CHECK(events == 4U && event_tag[3] == 7U && event_status[3] == SL_STATUS_TRANSMIT);
+  TEST_CHECK(transport.errors == 1U);
+
+  /* A completion with nothing queued is ignored */
+  sl_icm42688p_transport_complete(&transport, SL_STATUS_OK);
+  TEST_CHECK(events == 4U && transport.completed == 4U);
+  TEST_CHECK(dma.bad_locks == 0);
+}
+
+/* A start the backend refuses completes that transfer with the error, after
+   the callbacks before it, and the queue moves on */
+static void check_refused_start(void)
+{
+  static const uint8_t tx[1] = { 0x80 };
+
+  /* On an idle bus: reported from within submit */
+  reset();
+  dma.refuse_next = 1;
+  TEST_CHECK(sl_icm42688p_transport_submit(&transport, tx, NULL, 1, on_done, (void *)1U) == SL_STATUS_OK);
+  TEST_CHECK(events == 1U && event_tag[0] == 1U && event_status[0] == SL_STATUS_FAIL);
+  TEST_CHECK(!sl_icm42688p_transport_busy(&transport));
+
+  /* Behind a transfer in flight: the two queued after it are refused, the
+     last one still starts */
+  reset();
+  for (uintptr_t i = 0; i < 4U; ++i) {
+    TEST_CHECK(sl_icm42688p_transport_submit(&transport, tx, NULL, 1, on_done, (void *)i) == SL_STATUS_OK);
+  }
+  dma.refuse_next = 2;
+  sim_finish(SL_STATUS_OK);
+  TEST_CHECK(events == 3U);
+  TEST_CHECK(event_tag[0] == 0U && event_status[0] == SL_STATUS_OK);
+  TEST_CHECK(event_tag[1] == 1U && event_status[1] == SL_STATUS_FAIL);
+  TEST_CHECK(event_tag[2] == 2U && event_status[2] == SL_STATUS_FAIL);
+  TEST_CHECK(dma.in_flight && dma.starts == 4U);
+
+  sim_finish(SL_STATUS_OK);
+  TEST_CHECK(events == 4U && event_tag[3] == 3U && event_status[3] == SL_STATUS_OK);
+  TEST_CHECK(transport.errors == 2U && !sl_icm42688p_transport_busy(&transport));
+  TEST_CHECK(dma.bad_locks == 0);
+}
+
+/* A transfer submitted from a completion callback queues behind the ones
+   already waiting; the next one is already on the bus during the callback */
+static void check_submit_from_callback(void)
+{
+  static const uint8_t tx[1] = { 0x80 };
+
+  reset();
+  TEST_CHECK(sl_icm42688p_transport_submit(&transport, tx, NULL, 1, on_done_resubmit, (void *)1U) == SL_STATUS_OK);
+  TEST_CHECK(sl_icm42688p_transport_submit(&transport, tx, NULL, 1, on_done, (void *)2U) == SL_STATUS_OK);
+
+  sim_finish(SL_STATUS_OK);
+  TEST_CHECK(events == 1U && event_tag[0] == 1U);
+  TEST_CHECK(dma.in_flight && dma.starts == 2U);
+
+  sim_finish(SL_STATUS_OK);
+  sim_finish(SL_STATUS_OK);
+  TEST_CHECK(events == 3U && event_tag[1] == 2U && event_tag[2] == 101U);
+  TEST_CHECK(dma.len == 2U);
+  TEST_CHECK(!sl_icm42688p_transport_busy(&transport));
+
+  /* On an idle queue the resubmitted transfer starts right away */
+  reset();
+  TEST_CHECK(sl_icm42688p_transport_submit(&transport, tx, NULL, 1, on_done_resubmit, (void *)5U) == SL_STATUS_OK);
+  sim_finish(SL_STATUS_OK);
+  TEST_CHECK(dma.in_flight && dma.starts == 2U);
+  sim_finish(SL_STATUS_OK);
+  TEST_CHECK(events == 2U && event_tag[1] == 105U);
+  TEST_CHECK(dma.bad_locks == 0);
+}
+
+/* A full queue rejects without queueing or calling back, and takes new
+   transfers again once one completes */
+static void check_full(void)
+{
+  static const uint8_t tx[1] = { 0x80 };
+
+  reset();
+  for (uintptr_t i = 0; i < SL_ICM42688P_TRANSFER_QUEUE_DEPTH; ++i) {
+    TEST_CHECK(sl_icm42688p_transport_submit(&transport, tx, NULL, 1, on_done, (void *)i) == SL_STATUS_OK);
+  }
+  TEST_CHECK(sl_icm42688p_transport_submit(&transport, tx, NULL, 1, on_done, (void *)99U) == SL_STATUS_FULL);
+  TEST_CHECK(transport.submitted == SL_ICM42688P_TRANSFER_QUEUE_DEPTH && events == 0);
+
+  sim_finish(SL_STATUS_OK);
+  TEST_CHECK(sl_icm42688p_transport_submit(&transport, tx, NULL, 1, on_done, (void *)50U) == SL_STATUS_OK);
+  TEST_CHECK(sl_icm42688p_transport_submit(&transport, tx, NULL, 1, on_done, (void *)99U) == SL_STATUS_FULL);
+
+  while (dma.in_flight) {
+    sim_finish(SL_STATUS_OK);
+  }
+  TEST_CHECK(events == SL_ICM42688P_TRANSFER_QUEUE_DEPTH + 1U);
+  for (uint32_t i = 0; i < SL_ICM42688P_TRANSFER_QUEUE_DEPTH; ++i) {
+    TEST_CHECK(event_tag[i] == i);
+  }
+  TEST_CHECK(event_tag[SL_ICM42688P_TRANSFER_QUEUE_DEPTH] == 50U);
+
+  /* Bad arguments */
+  TEST_CHECK(sl_icm42688p_transport_submit(NULL, tx, NULL, 1, on_done, NULL) == SL_STATUS_INVALID_PARAMETER);
+  TEST_CHECK(sl_icm42688p_transport_submit(&transport, tx, NULL, 0, on_done, NULL) == SL_STATUS_INVALID_PARAMETER);
+  TEST_CHECK(dma.bad_locks == 0);
+}
+
+int main(void)
+{
+  check_order();
+  check_refused_start();
+  check_submit_from_callback();
+  check_full();
+  return test_result("test_transport");
+}